@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <string_view>
+
+namespace avocet::benchmarking {
+    struct num_calls {
+        std::size_t value{};
+    };
+
+    struct benchmark_result {
+        std::string_view description{};
+        std::size_t calls{};
+        std::chrono::duration<double> elapsed{};
+
+        [[nodiscard]]
+        double calls_per_second() const noexcept { return elapsed.count() > 0 ? calls / elapsed.count() : 0.0; }
+
+        [[nodiscard]]
+        double nanoseconds_per_call() const noexcept { return calls ? std::chrono::duration<double, std::nano>{elapsed}.count() / calls : 0.0; }
+    };
+
+    template<std::invocable Fn>
+    [[nodiscard]]
+    benchmark_result measure(std::string_view description, num_calls n, Fn fn) {
+        for(std::size_t i{}; i < n.value / 10; ++i) fn();
+
+        const auto start{std::chrono::steady_clock::now()};
+        for(std::size_t i{}; i < n.value; ++i) fn();
+        const auto end{std::chrono::steady_clock::now()};
+
+        return {description, n.value, end - start};
+    }
+
+    [[nodiscard]]
+    inline std::string to_string(const benchmark_result& result) {
+        return std::format("{:<48} {:>14.0f} calls/s {:>10.2f} ns/call", result.description, result.calls_per_second(), result.nanoseconds_per_call());
+    }
+}
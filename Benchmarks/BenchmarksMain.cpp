@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "Dispatch/GLFunctionBenchmark.hpp"
+#include "Engine/EngineOverheadBenchmark.hpp"
+#include "Replay/CommandReplayBenchmark.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <optional>
+
+namespace bm = avocet::benchmarking;
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        bm::run_gl_function_dispatch_benchmark(bm::num_calls{10'000'000});
+        bm::run_decoration_policy_benchmark(bm::num_calls{10'000'000});
+        bm::run_engine_overhead_benchmark(bm::num_calls{1'000'000});
+
+        const std::optional<std::filesystem::path> captureFile{argc > 1 ? std::optional<std::filesystem::path>{argv[1]} : std::nullopt};
+        bm::run_command_replay_benchmark(bm::num_calls{1'000'000}, captureFile);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what();
+    }
+    catch(...)
+    {
+        std::cerr << "Unrecognized error\n";
+    }
+}
@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "Dispatch/GLFunctionBenchmark.hpp"
+
+#include "avocet/OpenGL/Context/GLFunction.hpp"
+#include "avocet/OpenGL/Debugging/Errors.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+#include <print>
+
+namespace avocet::benchmarking {
+    namespace agl = avocet::opengl;
+
+    namespace {
+        [[nodiscard]]
+        GladGLContext stub_loader(GladGLContext ctx) {
+            ctx.VERSION_4_1 = 1;
+            ctx.GetString   = [](GLenum) -> const GLubyte* {
+                static constexpr GLubyte name[]{'S', 't', 'u', 'b', '\0'};
+                return name;
+            };
+            ctx.Enable      = [](GLenum) {};
+            ctx.Disable     = [](GLenum) {};
+            ctx.Uniform1i   = [](GLint, GLint) {};
+            ctx.GetError    = []() -> GLenum { return GL_NO_ERROR; };
+
+            return ctx;
+        }
+    }
+
+    // Uniform1i is not observed by the state shadow, so no calls are elided as redundant
+
+    void run_gl_function_dispatch_benchmark(num_calls n) {
+        const agl::fixed_decoration_context<agl::no_decoration, agl::no_decoration> ctx{agl::debugging_mode::off, stub_loader, agl::no_decoration{}, agl::no_decoration{}};
+
+        const auto dynamic{
+            measure("gl_function{&GladGLContext::Uniform1i}", n, [&ctx]() { agl::gl_function{&GladGLContext::Uniform1i}(ctx, 0, 1); })
+        };
+
+        const auto fixed{
+            measure("static_gl_function<&GladGLContext::Uniform1i>", n, [&ctx]() { agl::static_gl_function<&GladGLContext::Uniform1i>{}(ctx, 0, 1); })
+        };
+
+        std::println("{}", to_string(dynamic));
+        std::println("{}", to_string(fixed));
+        std::println("Speed-up: {:.2f}", fixed.calls_per_second() / dynamic.calls_per_second());
+    }
+
+    void run_decoration_policy_benchmark(num_calls n) {
+        const agl::standard_error_checker checker{agl::num_messages{10}, agl::default_debug_info_processor{}};
+
+        const agl::capable_context erased{agl::debugging_mode::basic, stub_loader, agl::no_decoration{}, agl::runtime_decorator{checker}, agl::attempt_to_compensate_for_driver_bugs::no};
+        const agl::capable_context policy{agl::debugging_mode::basic, stub_loader, agl::no_decoration{}, checker, agl::attempt_to_compensate_for_driver_bugs::no};
+        const agl::fixed_decoration_context<agl::no_decoration, agl::standard_error_checker<>> fixed{agl::debugging_mode::basic, stub_loader, agl::no_decoration{}, checker};
+
+        const auto erasedResult{
+            measure("runtime_decorator{standard_error_checker}", n, [&erased]() { agl::static_gl_function<&GladGLContext::Uniform1i>{}(erased, 0, 1); })
+        };
+
+        const auto policyResult{
+            measure("decoration_policy{standard_error_checker}", n, [&policy]() { agl::static_gl_function<&GladGLContext::Uniform1i>{}(policy, 0, 1); })
+        };
+
+        const auto fixedResult{
+            measure("standard_error_checker", n, [&fixed]() { agl::static_gl_function<&GladGLContext::Uniform1i>{}(fixed, 0, 1); })
+        };
+
+        std::println("{}", to_string(erasedResult));
+        std::println("{}", to_string(policyResult));
+        std::println("{}", to_string(fixedResult));
+        std::println("Speed-up: {:.2f}", fixedResult.calls_per_second() / erasedResult.calls_per_second());
+    }
+}
@@ -0,0 +1,20 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "BenchmarkUtilities.hpp"
+
+namespace avocet::benchmarking {
+    /// Compares the per-call CPU overhead of gl_function and static_gl_function,
+    /// dispatching to stubbed entry points so that only the engine's cost is measured.
+    void run_gl_function_dispatch_benchmark(num_calls n);
+
+    /// Compares a standard_error_checker epilogue which is a template parameter of the context
+    /// with the same checker selected at runtime, both by a decoration_policy and a runtime_decorator.
+    void run_decoration_policy_benchmark(num_calls n);
+}
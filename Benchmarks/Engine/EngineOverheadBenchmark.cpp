@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "Engine/EngineOverheadBenchmark.hpp"
+
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+#include <print>
+
+namespace avocet::benchmarking {
+    namespace agl = avocet::opengl;
+
+    namespace {
+        using quad_type = agl::quad<GLfloat, agl::dimensionality{2}>;
+
+        [[nodiscard]]
+        quad_type make_quad(const agl::capable_context& ctx) {
+            return quad_type{ctx, [](auto vertices) { return vertices; }, std::nullopt};
+        }
+
+        template<std::invocable Fn>
+        void report(agl::null_driver& driver, std::string_view description, num_calls n, Fn fn) {
+            driver.reset_call_counts();
+            const auto result{measure(description, n, fn)};
+            // measure warms up with an extra tenth of the calls
+            const auto driverCalls{static_cast<double>(driver.total_calls()) / (n.value + n.value / 10)};
+
+            std::println("{} {:>6.1f} gl calls/op", to_string(result), driverCalls);
+        }
+    }
+
+    void run_engine_overhead_benchmark(num_calls n) {
+        agl::null_driver driver{};
+        const agl::capable_context ctx{agl::debugging_mode::off, driver.loader(), agl::no_decoration{}, agl::no_decoration{}, agl::attempt_to_compensate_for_driver_bugs::no};
+
+        {
+            const auto q{make_quad(ctx)};
+            report(driver, "Draw quad", n, [&q]() { q.draw(); });
+        }
+
+        report(driver, "Create and destroy quad", num_calls{n.value / 10}, [&ctx]() { [[maybe_unused]] const auto q{make_quad(ctx)}; });
+
+        {
+            agl::capable_context::payload_type blended{}, depthTested{};
+            std::get<std::optional<agl::capabilities::gl_blend>>(blended)          = agl::capabilities::gl_blend{};
+            std::get<std::optional<agl::capabilities::gl_depth_test>>(depthTested) = agl::capabilities::gl_depth_test{};
+
+            bool toggle{};
+            report(driver, "Switch capability payload", n, [&]() { ctx.new_payload((toggle = !toggle) ? blended : depthTested); });
+        }
+    }
+}
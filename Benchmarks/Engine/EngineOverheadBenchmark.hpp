@@ -0,0 +1,16 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "BenchmarkUtilities.hpp"
+
+namespace avocet::benchmarking {
+    /// Measures the engine-side CPU cost of drawing, of creating resources and of switching
+    /// capability payloads, running the full avocet stack on the null driver.
+    void run_engine_overhead_benchmark(num_calls n);
+}
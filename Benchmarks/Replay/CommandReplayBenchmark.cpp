@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "Replay/CommandReplayBenchmark.hpp"
+
+#include "avocet/OpenGL/Capture/CommandCapture.hpp"
+#include "avocet/OpenGL/Capture/CommandReplay.hpp"
+#include "avocet/OpenGL/Context/GLFunction.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+#include <array>
+#include <print>
+
+namespace avocet::benchmarking {
+    namespace agl = avocet::opengl;
+
+    namespace {
+        constexpr std::size_t calls_per_draw{5};
+
+        [[nodiscard]]
+        agl::command_log capture_synthetic_stream(agl::null_driver& driver, num_calls n) {
+            constexpr std::array<GLfloat, 16> vertices{};
+            const std::size_t draws{n.value / calls_per_draw};
+
+            agl::command_capture capture{{draws * calls_per_draw, draws * sizeof(vertices)}};
+            const agl::fixed_decoration_context<agl::no_decoration, agl::capture_recorder> ctx{
+                agl::debugging_mode::off, driver.loader(), agl::no_decoration{}, agl::capture_recorder{capture}
+            };
+
+            {
+                const agl::scoped_capture scope{capture};
+                for(std::size_t i{}; i < draws; ++i) {
+                    // Alternate, so that neither bind is elided as redundant
+                    const auto name{static_cast<GLuint>(1 + i % 2)};
+                    agl::static_gl_function<&GladGLContext::UseProgram>{}(ctx, name);
+                    agl::static_gl_function<&GladGLContext::BindVertexArray>{}(ctx, name);
+                    agl::static_gl_function<&GladGLContext::Uniform4f>{}(ctx, 0, 1.0f, 0.5f, 0.25f, 1.0f);
+                    agl::static_gl_function<&GladGLContext::BufferSubData>{}(ctx, GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
+                    agl::static_gl_function<&GladGLContext::DrawElements>{}(ctx, GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+                }
+            }
+
+            return capture.release();
+        }
+    }
+
+    void run_command_replay_benchmark(num_calls n, const std::optional<std::filesystem::path>& captureFile) {
+        agl::null_driver driver{};
+        const agl::capable_context ctx{agl::debugging_mode::off, driver.loader(), agl::no_decoration{}, agl::no_decoration{}, agl::attempt_to_compensate_for_driver_bugs::no};
+
+        const agl::command_log log{captureFile ? agl::command_log::read(*captureFile) : capture_synthetic_stream(driver, n)};
+
+        // Warm up, so that the measured replay is not penalized by first-touch page faults in the log
+        [[maybe_unused]] const auto warmUp{agl::replay(ctx.glad_context(), log)};
+        const auto report{agl::replay(ctx.glad_context(), log)};
+
+        const benchmark_result result{"replay", report.replayed, report.duration};
+        std::println("{}", to_string(result));
+        std::println("Payload: {} bytes; skipped: {}; divergences: {}", log.payload_bytes(), report.skipped, report.divergences);
+    }
+}
@@ -0,0 +1,20 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "BenchmarkUtilities.hpp"
+
+#include <filesystem>
+#include <optional>
+
+namespace avocet::benchmarking {
+    /// Replays a command stream against the null driver, measuring the cost of submission
+    /// independently of the application which produced it. If no capture file is supplied,
+    /// a synthetic stream of n calls is captured first.
+    void run_command_replay_benchmark(num_calls n, const std::optional<std::filesystem::path>& captureFile);
+}
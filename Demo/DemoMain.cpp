@@ -7,18 +7,37 @@
 
 #include "Examples/PonyPolygons.hpp"
 
+#include "avocet/OpenGL/Capture/CommandCapture.hpp"
+#include "avocet/OpenGL/Profiling/CallTracer.hpp"
+
 #include "curlew/Window/GLFWWrappers.hpp"
 #include "curlew/Window/RenderingSetup.hpp"
 
 #include "GLFW/glfw3.h"
 
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
 #include <format>
+#include <optional>
 #include <print>
+#include <span>
+#include <string_view>
 
 namespace agl = avocet::opengl;
 
-int main()
+namespace {
+    [[nodiscard]]
+    std::optional<std::filesystem::path> find_path_option(std::span<char*> args, std::string_view flag) {
+        const auto found{std::ranges::find(args, flag, [](const char* arg) { return std::string_view{arg}; })};
+        if((found == args.end()) || (std::next(found) == args.end()))
+            return std::nullopt;
+
+        return std::filesystem::path{*std::next(found)};
+    }
+}
+
+int main(int argc, char** argv)
 {
     try
     {
@@ -28,40 +47,68 @@ int main()
 
         constexpr avocet::discrete_extent nominalWindowSize{.width{800}, .height{800}};
 
+        // --trace <file> opts into tracing every gl call, with the trace written on exit;
+        // --capture <file> records the setup and first frame as a replayable command log.
+        const std::span<char*> args{argv, static_cast<std::size_t>(argc)};
+        const auto tracePath{find_path_option(args, "--trace")}, capturePath{find_path_option(args, "--capture")};
+        agl::call_tracer tracer{agl::events_per_thread{tracePath ? 1'000'000uz : 0uz}};
+        agl::command_capture capture{capturePath ? agl::capture_capacity{100'000, 64 * 1024 * 1024} : agl::capture_capacity{}};
+
+        const agl::standard_error_checker errorChecker{
+            agl::num_messages{10},
+            agl::default_debug_info_processor{curlew::printed_then_ignored_warnings(renderingSetup), curlew::ignored_warnings(renderingSetup)}
+        };
+
+        // Capture is opted into by the epilogue, so that the context pays nothing for it otherwise
+        agl::decoration_policy epilogue{tracePath ? agl::decoration_policy{tracer.epilogue(errorChecker)} : agl::decoration_policy{errorChecker}};
+        if(capturePath)
+            epilogue = agl::capture_recorder{capture, epilogue};
+
         auto w{
             manager.create_window(
                 {
                     .extent{nominalWindowSize},
                     .name{"Hello Rendering Engine"},
                     .hiding{curlew::window_hiding_mode::off},
-                    .debug_mode{agl::debugging_mode::dynamic},
-                    .prologue{},
-                    .epilogue{
-                         agl::standard_error_checker{
-                             agl::num_messages{10},
-                             agl::default_debug_info_processor{curlew::printed_then_ignored_warnings(renderingSetup), curlew::ignored_warnings(renderingSetup)}
-                         }
-                     },
+                    .debug_mode{agl::debugging_mode::asynchronous},
+                    .prologue{tracePath ? agl::decoration_policy{tracer.prologue()} : agl::decoration_policy{}},
+                    .epilogue{epilogue},
                     .compensate{agl::attempt_to_compensate_for_driver_bugs::yes},
                     .samples{4}
                 }
             )
         };
         const auto& ctx{w.context()};
+        const agl::default_debug_info_processor debugInfoProcessor{curlew::printed_then_ignored_warnings(renderingSetup), curlew::ignored_warnings(renderingSetup)};
 
-        agl::testing::pony_polygons ponyPolygons{ctx};
+        std::optional<agl::scoped_capture> scopedCapture{};
+        if(capturePath)
+            scopedCapture.emplace(capture);
+
+        agl::testing::pony_polygons ponyPolygons{ctx, tracePath ? &tracer : nullptr};
 
         while(!glfwWindowShouldClose(&w.get())) {
-            agl::gl_function{&GladGLContext::ClearColor}(ctx, 0.2f, 0.3f, 0.3f, 1.0f);
-            agl::gl_function{&GladGLContext::Clear}(ctx, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            ctx.clear({.colour{0.2f, 0.3f, 0.3f, 1.0f}}, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
             if(const auto optViewport{avocet::refit(nominalWindowSize, w.get_framebuffer_extent())}; optViewport) {
                 w.update_viewport(optViewport.value());
                 ponyPolygons.draw();
+                agl::check_for_asynchronous_errors(ctx, debugInfoProcessor);
                 glfwSwapBuffers(&w.get());
+
+                if(scopedCapture) {
+                    scopedCapture.reset();
+                    capture.log().write(*capturePath);
+                }
             }
             glfwPollEvents();
         }
+
+        if(tracePath) {
+            tracer.write_chrome_trace(*tracePath);
+            if(const auto dropped{tracer.num_dropped()})
+                std::println("Call tracer: {} events dropped", dropped);
+        }
     }
     catch(const std::exception& e)
     {
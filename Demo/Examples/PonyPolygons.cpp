@@ -45,19 +45,23 @@ namespace avocet::opengl::testing {
 
         }
 
-        using payload_type = capable_context::payload_type;
-
         template<class... Caps>
         [[nodiscard]]
-        payload_type make_payload(const Caps&... caps) {
-            payload_type payload{};
+        capable_context::state_block make_state_block(const capable_context& ctx, const Caps&... caps) {
+            capable_context::payload_type payload{};
             ((std::get<std::optional<Caps>>(payload) = caps), ...);
-            return payload;
+            return ctx.make_state_block(payload);
         }
 
-        template<class... Caps>
-        void set_payload(const capable_context& ctx, const Caps&... targetCaps) {
-            ctx.new_payload(make_payload(targetCaps...));
+        [[nodiscard]]
+        capabilities::gl_stencil_test make_front_stencil_test(comparison_mode comparison, stencil_failure_mode onPass) {
+            return {
+                .front{
+                    .func{.comparison{comparison}, .reference_value{1}, .mask{255}},
+                    .op{.on_failure{stencil_failure_mode::keep}, .on_pass_with_depth_failure{stencil_failure_mode::keep}, .on_pass_without_depth_failure{onPass} },
+                    .write_mask{255}
+                }
+            };
         }
 
         constexpr GLfloat discRadius{0.4f},
@@ -98,7 +102,7 @@ namespace avocet::opengl::testing {
                 texture_2d_configurator{
                     .common_config{
                         .decoding{sampling_decoding::srgb},
-                        .parameter_setter{ [&ctx]() { gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
+                        .parameter_setter{ [](decorated_contextual_resource_view crv) { set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
                         .label{"Fluttershy"}
                      },
                     .data_view{fluttershy},
@@ -121,7 +125,7 @@ namespace avocet::opengl::testing {
                 texture_2d_configurator{
                     .common_config{
                         .decoding{sampling_decoding::srgb},
-                        .parameter_setter{ [&ctx]() { gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
+                        .parameter_setter{ [](decorated_contextual_resource_view crv) { set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
                         .label{"Hearts"}
                     },
                     .data_view{hearty},
@@ -144,7 +148,7 @@ namespace avocet::opengl::testing {
                 texture_2d_configurator{
                     .common_config{
                         .decoding{sampling_decoding::srgb},
-                        .parameter_setter{ [&ctx]() { gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
+                        .parameter_setter{ [](decorated_contextual_resource_view crv) { set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
                         .label{"Hearts"}
                     },
                     .data_view{hearty},
@@ -197,7 +201,7 @@ namespace avocet::opengl::testing {
                 texture_2d_configurator{
                     .common_config{
                         .decoding{sampling_decoding::srgb},
-                        .parameter_setter{ [&ctx](){ gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
+                        .parameter_setter{ [](decorated_contextual_resource_view crv) { set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
                         .label{"Princess TS"}
                     },
                     .data_view{twilight},
@@ -221,7 +225,7 @@ namespace avocet::opengl::testing {
                     texture_2d_configurator{
                         .common_config{
                             .decoding{sampling_decoding::srgb},
-                            .parameter_setter{ [&ctx]() { gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
+                            .parameter_setter{ [](decorated_contextual_resource_view crv) { set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
                             .label{"Twilight"}
                         },
                         .data_view{twilight},
@@ -229,7 +233,7 @@ namespace avocet::opengl::testing {
                     texture_2d_configurator{
                         .common_config{
                             .decoding{sampling_decoding::srgb},
-                            .parameter_setter{ [&ctx]() { gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
+                            .parameter_setter{ [](decorated_contextual_resource_view crv) { set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_LINEAR); }},
                             .label{"Fluttershy"} 
                         },
                         .data_view{fluttershy},
@@ -240,8 +244,41 @@ namespace avocet::opengl::testing {
         }
     }
 
-    pony_polygons::pony_polygons(const capable_context& ctx)
+    pony_polygons::pony_polygons(const capable_context& ctx, call_tracer* tracer)
         : m_Context{ctx}
+        , m_Tracer{tracer}
+        , m_Queue{ctx}
+        , m_NoCapabilities       {make_state_block(ctx)}
+        , m_DepthTest            {make_state_block(ctx, capabilities::gl_depth_test{})}
+        , m_DepthTestOffsetLines {make_state_block(ctx, capabilities::gl_depth_test{.poly_offset{.factor{}, .units{-1.0}}}, capabilities::gl_polygon_offset_line{},  capabilities::gl_rasterization{.polygon_mode{polygon_rasterization_mode::line}})}
+        , m_DepthTestOffsetPoints{make_state_block(ctx, capabilities::gl_depth_test{.poly_offset{.factor{}, .units{-2.0}}}, capabilities::gl_polygon_offset_point{}, capabilities::gl_rasterization{.polygon_mode{polygon_rasterization_mode::point}, .point_size{10}})}
+        , m_StencilReplace       {make_state_block(ctx, make_front_stencil_test(comparison_mode::greater, stencil_failure_mode::replace))}
+        , m_StencilGreater       {make_state_block(ctx, make_front_stencil_test(comparison_mode::greater, stencil_failure_mode::keep))}
+        , m_StencilEqual         {make_state_block(ctx, make_front_stencil_test(comparison_mode::equal,   stencil_failure_mode::keep))}
+        , m_Coverage{
+              make_state_block(
+                  ctx,
+                  capabilities::gl_multi_sample{},
+                  capabilities::gl_sample_coverage{.coverage_val{0.75}, .invert{invert_sample_mask::no}},
+                  capabilities::gl_sample_alpha_to_coverage{}
+              )
+          }
+        , m_Blend{
+              make_state_block(
+                  ctx,
+                  capabilities::gl_blend{
+                      .rgb{
+                          .modes{.source{blend_mode::src_alpha}, .destination{blend_mode::one_minus_src_alpha}},
+                          .algebraic_op{blend_eqn_mode::add}
+                      },
+                      .alpha{
+                          .modes{.source{blend_mode::src_alpha}, .destination{blend_mode::one_minus_src_alpha}},
+                          .algebraic_op{blend_eqn_mode::add}
+                      },
+                      .colour{}
+                  }
+              )
+          }
         , m_DiscShaderProgram2D             {ctx, get_vertex_shader_dir() / "2D" / "Disc.vs",                  get_fragment_shader_dir() / "2D"      / "Disc.fs"}
         , m_DiscShaderProgram2DTextured     {ctx, get_vertex_shader_dir() / "2D" / "DiscTextured.vs",          get_fragment_shader_dir() / "2D"      / "DiscTextured.fs"}
         , m_ShaderProgram2DTextured         {ctx, get_vertex_shader_dir() / "2D" / "IdentityTextured.vs",      get_fragment_shader_dir() / "General" / "Textured.fs"}
@@ -274,116 +311,39 @@ namespace avocet::opengl::testing {
     }
 
     void pony_polygons::draw() {
-        {
-            set_payload(m_Context);
-            m_DiscShaderProgram2DTextured.use();
-            m_Disc.draw(texture_unit{5});
-        }
-
-        {
-            set_payload(m_Context, capabilities::gl_depth_test{});
-            m_ShaderProgram2DMixedTextures.use();
-            m_Septagon.draw(std::array{texture_unit{2}, texture_unit{3}});
-        }
-
-        {
-            gl_function{&GladGLContext::PolygonMode}(m_Context, GL_FRONT_AND_BACK, GL_LINE);
-            set_payload(m_Context, capabilities::gl_depth_test{.poly_offset{.factor{}, .units{-1.0}}}, capabilities::gl_polygon_offset_line{});
-            m_ShaderProgram2DMonochrome.use();
-            m_ShaderProgram2DMonochrome.set_uniform("colour", std::array{1.0f, 0.0f, 0.0f, 1.0f});
-            m_Septagon.draw(std::array{texture_unit{2}, texture_unit{3}});
-            gl_function{&GladGLContext::PolygonMode}(m_Context, GL_FRONT_AND_BACK, GL_FILL);
-        }
-
-        {
-            gl_function{&GladGLContext::PolygonMode}(m_Context, GL_FRONT_AND_BACK, GL_POINT);
-            gl_function{&GladGLContext::PointSize}(m_Context, 10);
-            set_payload(m_Context, capabilities::gl_depth_test{.poly_offset{.factor{}, .units{-2.0}}}, capabilities::gl_polygon_offset_point{});
-            m_ShaderProgram2DMonochrome.use();
-            m_ShaderProgram2DMonochrome.set_uniform("colour", std::array{0.0f, 0.0f, 1.0f, 1.0f});
-            m_Septagon.draw(std::array{texture_unit{2}, texture_unit{3}});
-            gl_function{&GladGLContext::PolygonMode}(m_Context, GL_FRONT_AND_BACK, GL_FILL);
-        }
-
-        {
-            set_payload(m_Context, capabilities::gl_depth_test{});
-            m_ShaderProgram3DTextured.use();
-            m_UpperHearts.draw(texture_unit{7});
-        }
-
-        {
-            set_payload(
-                m_Context,
-                capabilities::gl_stencil_test{
-                    .front{
-                        .func{.comparison{comparison_mode::greater}, .reference_value{1}, .mask{255}},
-                        .op{.on_failure{stencil_failure_mode::keep}, .on_pass_with_depth_failure{stencil_failure_mode::keep}, .on_pass_without_depth_failure{stencil_failure_mode::replace} },
-                        .write_mask{255}
-                    }
-                }
-            );
-            m_DiscShaderProgram2D.use();
-            m_Cutout.draw();
-        }
-
-        {
-            set_payload(
-                m_Context,
-                capabilities::gl_stencil_test{
-                    .front{
-                        .func{.comparison{comparison_mode::greater}, .reference_value{1}, .mask{255}},
-                        .op{.on_failure{stencil_failure_mode::keep}, .on_pass_with_depth_failure{stencil_failure_mode::keep}, .on_pass_without_depth_failure{stencil_failure_mode::keep} },
-                        .write_mask{255}
-                    }
-                }
-            );
-            m_ShaderProgram2DTextured.use();
-            m_LowerHearts.draw(texture_unit{8});
-        }
-
-        {
-            set_payload(
-                m_Context,
-                capabilities::gl_stencil_test{
-                    .front{
-                        .func{.comparison{comparison_mode::equal}, .reference_value{1}, .mask{255}},
-                        .op{.on_failure{stencil_failure_mode::keep}, .on_pass_with_depth_failure{stencil_failure_mode::keep}, .on_pass_without_depth_failure{stencil_failure_mode::keep} },
-                        .write_mask{255}
-                    }
-                }
-            );
-            m_ShaderProgram2DTextured.use();
-            m_Hexagon.draw(texture_unit{8});
-        }
-
-        {
-            set_payload(
-                m_Context,
-                capabilities::gl_multi_sample{},
-                capabilities::gl_sample_coverage{.coverage_val{0.75}, .invert{invert_sample_mask::no}},
-                capabilities::gl_sample_alpha_to_coverage{}
-            );
-            m_ShaderProgram3DDoubleMonochrome.use();
-            m_PartiallyTransparentQuadUpper.draw();
-        }
-
-        {
-            set_payload(
-                m_Context,
-                capabilities::gl_blend{
-                    .rgb{
-                        .modes{.source{blend_mode::src_alpha}, .destination{blend_mode::one_minus_src_alpha}},
-                        .algebraic_op{blend_eqn_mode::add}
-                    },
-                    .alpha{
-                        .modes{.source{blend_mode::src_alpha}, .destination{blend_mode::one_minus_src_alpha}},
-                        .algebraic_op{blend_eqn_mode::add}
-                    },
-                    .colour{}
-                }
-            );
-            m_ShaderProgram3DDoubleMonochrome.use();
-            m_PartiallyTransparentQuadLower.draw();
-        }
+        // Stencil writes must precede stencil tests, and transparent quads must follow everything else
+        constexpr render_layer opaque{.index{0}, .ordering{layer_ordering::by_state}},
+                               stencilled{.index{1}, .ordering{layer_ordering::as_submitted}},
+                               transparent{.index{2}, .ordering{layer_ordering::back_to_front}};
+
+        const std::array septagonUnits{texture_unit{2}, texture_unit{3}};
+
+        m_Queue.submit(m_DiscShaderProgram2DTextured, m_NoCapabilities, m_Disc, texture_unit{5}, {.layer{opaque}});
+        m_Queue.submit(m_ShaderProgram2DMixedTextures, m_DepthTest, m_Septagon, septagonUnits, {.layer{opaque}});
+        m_Queue.submit(
+            m_ShaderProgram2DMonochrome,
+            m_DepthTestOffsetLines,
+            m_Septagon,
+            septagonUnits,
+            {.layer{opaque}, .depth{}, .prepare{[this]() { m_ShaderProgram2DMonochrome.set_uniform("colour", std::array{1.0f, 0.0f, 0.0f, 1.0f}); }}}
+        );
+        m_Queue.submit(
+            m_ShaderProgram2DMonochrome,
+            m_DepthTestOffsetPoints,
+            m_Septagon,
+            septagonUnits,
+            {.layer{opaque}, .depth{}, .prepare{[this]() { m_ShaderProgram2DMonochrome.set_uniform("colour", std::array{0.0f, 0.0f, 1.0f, 1.0f}); }}}
+        );
+        m_Queue.submit(m_ShaderProgram3DTextured, m_DepthTest, m_UpperHearts, texture_unit{7}, {.layer{opaque}});
+
+        m_Queue.submit(m_DiscShaderProgram2D,     m_StencilReplace, m_Cutout,                   {.layer{stencilled}});
+        m_Queue.submit(m_ShaderProgram2DTextured, m_StencilGreater, m_LowerHearts, texture_unit{8}, {.layer{stencilled}});
+        m_Queue.submit(m_ShaderProgram2DTextured, m_StencilEqual,   m_Hexagon,     texture_unit{8}, {.layer{stencilled}});
+
+        m_Queue.submit(m_ShaderProgram3DDoubleMonochrome, m_Coverage, m_PartiallyTransparentQuadUpper, {.layer{transparent}});
+        m_Queue.submit(m_ShaderProgram3DDoubleMonochrome, m_Blend,    m_PartiallyTransparentQuadLower, {.layer{transparent}});
+
+        trace_zone zone{m_Tracer, "Render queue"};
+        m_Queue.flush();
     }
 }
\ No newline at end of file
@@ -9,11 +9,26 @@
 
 #include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
 #include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/Profiling/CallTracer.hpp"
+#include "avocet/OpenGL/Rendering/RenderQueue.hpp"
 #include "avocet/OpenGL/Resources/ShaderProgram.hpp"
 
 namespace avocet::opengl::testing {
     class pony_polygons {
         const capable_context& m_Context;
+        call_tracer* m_Tracer;
+        render_queue m_Queue;
+
+        capable_context::state_block
+            m_NoCapabilities,
+            m_DepthTest,
+            m_DepthTestOffsetLines,
+            m_DepthTestOffsetPoints,
+            m_StencilReplace,
+            m_StencilGreater,
+            m_StencilEqual,
+            m_Coverage,
+            m_Blend;
 
         shader_program
             m_DiscShaderProgram2D,
@@ -37,7 +52,7 @@ namespace avocet::opengl::testing {
         polygon<GLfloat, 6, dimensionality{2}, texture_coordinates<GLfloat>>                               m_Hexagon;
         polygon<GLfloat, 7, dimensionality{2}, texture_coordinates<GLfloat>, texture_coordinates<GLfloat>> m_Septagon;
     public:
-        explicit pony_polygons(const opengl::capable_context& ctx);
+        explicit pony_polygons(const opengl::capable_context& ctx, call_tracer* tracer = nullptr);
 
         void draw();
     };
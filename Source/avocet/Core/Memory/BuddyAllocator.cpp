@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/Core/Memory/BuddyAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <stdexcept>
+
+namespace avocet {
+    buddy_allocator::buddy_allocator(std::size_t capacity, std::size_t minBlockSize)
+        : m_Capacity{capacity}
+        , m_MinBlockSize{minBlockSize}
+    {
+        if(!std::has_single_bit(capacity) || !std::has_single_bit(minBlockSize) || (minBlockSize > capacity))
+            throw std::runtime_error{std::format("buddy_allocator: capacity {} and minimum block size {} must be powers of two, with the latter no larger", capacity, minBlockSize)};
+
+        m_FreeLists.resize(std::countr_zero(capacity / minBlockSize) + 1);
+        m_FreeLists.back().insert(0);
+    }
+
+    [[nodiscard]]
+    std::optional<std::size_t> buddy_allocator::allocate(std::size_t size) {
+        if(size > m_Capacity)
+            return std::nullopt;
+
+        const std::size_t order{static_cast<std::size_t>(std::countr_zero(std::bit_ceil(std::max(size, m_MinBlockSize)) / m_MinBlockSize))};
+
+        auto available{order};
+        while((available < m_FreeLists.size()) && m_FreeLists[available].empty()) ++available;
+
+        if(available == m_FreeLists.size())
+            return std::nullopt;
+
+        const auto offset{m_FreeLists[available].extract(m_FreeLists[available].begin()).value()};
+        while(available > order) {
+            --available;
+            m_FreeLists[available].insert(offset + size_of(available));
+        }
+
+        m_Live.emplace(offset, order);
+        m_Allocated += size_of(order);
+        return offset;
+    }
+
+    void buddy_allocator::free(std::size_t offset) {
+        const auto found{m_Live.find(offset)};
+        if(found == m_Live.end())
+            throw std::runtime_error{std::format("buddy_allocator::free: no block at offset {}", offset)};
+
+        auto order{found->second};
+        m_Live.erase(found);
+        m_Allocated -= size_of(order);
+
+        while(order + 1 < m_FreeLists.size()) {
+            const auto buddy{offset ^ size_of(order)};
+            if(!m_FreeLists[order].erase(buddy))
+                break;
+
+            offset = std::min(offset, buddy);
+            ++order;
+        }
+
+        m_FreeLists[order].insert(offset);
+    }
+
+    [[nodiscard]]
+    std::size_t buddy_allocator::block_size(std::size_t offset) const {
+        const auto found{m_Live.find(offset)};
+        if(found == m_Live.end())
+            throw std::runtime_error{std::format("buddy_allocator::block_size: no block at offset {}", offset)};
+
+        return size_of(found->second);
+    }
+
+    [[nodiscard]]
+    std::size_t buddy_allocator::largest_free_block() const noexcept {
+        for(auto order{m_FreeLists.size()}; order > 0; --order) {
+            if(!m_FreeLists[order - 1].empty())
+                return size_of(order - 1);
+        }
+
+        return 0;
+    }
+}
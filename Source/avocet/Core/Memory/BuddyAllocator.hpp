@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace avocet {
+    /// Hands out offsets into [0, capacity) without touching the memory it manages. Blocks are
+    /// powers of two, no smaller than min_block_size, and are aligned to their size; freed blocks
+    /// are coalesced with their buddies. Both sizes must be powers of two.
+    class buddy_allocator {
+    public:
+        buddy_allocator(std::size_t capacity, std::size_t minBlockSize);
+
+        /// Returns the offset of the lowest free block able to hold size bytes, if any
+        [[nodiscard]]
+        std::optional<std::size_t> allocate(std::size_t size);
+
+        /// Throws unless offset is that of a live block
+        void free(std::size_t offset);
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept { return m_Capacity; }
+
+        [[nodiscard]]
+        std::size_t min_block_size() const noexcept { return m_MinBlockSize; }
+
+        /// Throws unless offset is that of a live block
+        [[nodiscard]]
+        std::size_t block_size(std::size_t offset) const;
+
+        /// The total size of the live blocks
+        [[nodiscard]]
+        std::size_t allocated() const noexcept { return m_Allocated; }
+
+        [[nodiscard]]
+        std::size_t num_allocations() const noexcept { return m_Live.size(); }
+
+        [[nodiscard]]
+        std::size_t largest_free_block() const noexcept;
+
+        [[nodiscard]]
+        friend bool operator==(const buddy_allocator&, const buddy_allocator&) noexcept = default;
+    private:
+        std::size_t m_Capacity{}, m_MinBlockSize{}, m_Allocated{};
+        std::vector<std::set<std::size_t>> m_FreeLists{};
+        std::unordered_map<std::size_t, std::size_t> m_Live{};
+
+        [[nodiscard]]
+        std::size_t size_of(std::size_t order) const noexcept { return m_MinBlockSize << order; }
+    };
+}
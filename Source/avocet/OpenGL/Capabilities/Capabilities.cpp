@@ -141,4 +141,39 @@ namespace avocet::opengl {
 
         throw std::runtime_error{error_message("depth_buffer_write_mode", mode)};
     }
+
+    [[nodiscard]]
+    std::string to_string(face_selection_mode mode) {
+        using enum face_selection_mode;
+        switch(mode) {
+        case front:          return "front";
+        case back:           return "back";
+        case front_and_back: return "front_and_back";
+        }
+
+        throw std::runtime_error{error_message("face_selection_mode", mode)};
+    }
+
+    [[nodiscard]]
+    std::string to_string(winding_order order) {
+        using enum winding_order;
+        switch(order) {
+        case clockwise:         return "clockwise";
+        case counter_clockwise: return "counter_clockwise";
+        }
+
+        throw std::runtime_error{error_message("winding_order", order)};
+    }
+
+    [[nodiscard]]
+    std::string to_string(polygon_rasterization_mode mode) {
+        using enum polygon_rasterization_mode;
+        switch(mode) {
+        case point: return "point";
+        case line:  return "line";
+        case fill:  return "fill";
+        }
+
+        throw std::runtime_error{error_message("polygon_rasterization_mode", mode)};
+    }
 }
\ No newline at end of file
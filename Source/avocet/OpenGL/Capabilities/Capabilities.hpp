@@ -145,6 +145,32 @@ namespace avocet::opengl {
     [[nodiscard]]
     std::string to_string(depth_buffer_write_mode mode);
 
+    enum class face_selection_mode : GLenum {
+        front          = GL_FRONT,
+        back           = GL_BACK,
+        front_and_back = GL_FRONT_AND_BACK
+    };
+
+    [[nodiscard]]
+    std::string to_string(face_selection_mode mode);
+
+    enum class winding_order : GLenum {
+        clockwise         = GL_CW,
+        counter_clockwise = GL_CCW
+    };
+
+    [[nodiscard]]
+    std::string to_string(winding_order order);
+
+    enum class polygon_rasterization_mode : GLenum {
+        point = GL_POINT,
+        line  = GL_LINE,
+        fill  = GL_FILL
+    };
+
+    [[nodiscard]]
+    std::string to_string(polygon_rasterization_mode mode);
+
     template<class T>
     inline constexpr bool is_capability_v{
            std::regular<T>
@@ -299,6 +325,73 @@ namespace avocet::opengl {
             [[nodiscard]]
             friend constexpr bool operator==(const gl_stencil_test&, const gl_stencil_test&) noexcept = default;
         };
+
+        /******************************* Face Culling *******************************/
+
+        struct gl_cull_face {
+            constexpr static auto capability{gl_capability::cull_face};
+
+            face_selection_mode face{face_selection_mode::back};
+            winding_order       front_face{winding_order::counter_clockwise};
+
+            [[nodiscard]]
+            friend constexpr bool operator==(const gl_cull_face&, const gl_cull_face&) noexcept = default;
+        };
+
+        /******************************* Scissor Testing *******************************/
+
+        struct gl_scissor_test {
+            constexpr static auto capability{gl_capability::scissor_test};
+
+            GLint   x{}, y{};
+            GLsizei width{}, height{};
+
+            [[nodiscard]]
+            friend constexpr bool operator==(const gl_scissor_test&, const gl_scissor_test&) noexcept = default;
+        };
+
+        /******************************* Primitive Restart *******************************/
+
+        struct gl_primitive_restart {
+            constexpr static auto capability{gl_capability::primitive_restart};
+
+            GLuint index{};
+
+            [[nodiscard]]
+            friend constexpr bool operator==(const gl_primitive_restart&, const gl_primitive_restart&) noexcept = default;
+        };
+
+        /******************************* Program Point Size *******************************/
+
+        struct gl_program_point_size {
+            constexpr static auto capability{gl_capability::program_point_size};
+
+            [[nodiscard]]
+            friend constexpr bool operator==(const gl_program_point_size&, const gl_program_point_size&) noexcept = default;
+        };
+
+        /******************************* Rasterization *******************************/
+
+        /// Not a capability, since it cannot be disabled; if absent from a payload, the defaults apply
+        struct gl_rasterization {
+            polygon_rasterization_mode polygon_mode{polygon_rasterization_mode::fill};
+            GLfloat point_size{1.0f};
+            GLfloat line_width{1.0f};
+
+            [[nodiscard]]
+            friend constexpr bool operator==(const gl_rasterization&, const gl_rasterization&) noexcept = default;
+        };
+
+        /******************************* Clear Values *******************************/
+
+        struct gl_clear_values {
+            std::array<GLfloat, 4> colour{};
+            GLdouble depth{1.0};
+            GLint stencil{};
+
+            [[nodiscard]]
+            friend constexpr bool operator==(const gl_clear_values&, const gl_clear_values&) noexcept = default;
+        };
     }
 }
 
@@ -12,12 +12,6 @@
 
 namespace avocet::opengl::capabilities::impl {
     namespace {
-        enum class face_selection_mode : GLenum {
-            front          = GL_FRONT,
-            back           = GL_BACK,
-            front_and_back = GL_FRONT_AND_BACK
-        };
-
         void do_configure(const decorated_context& ctx, face_selection_mode face, const gl_stencil_func& requested) {
             gl_function{&GladGLContext::StencilFuncSeparate}(
                 ctx,
@@ -104,6 +98,48 @@ namespace avocet::opengl::capabilities::impl {
             gl_function{&GladGLContext::PolygonOffset}(ctx, requested.poly_offset.factor, requested.poly_offset.units);
     }
 
+    void configure(const decorated_context& ctx, const gl_cull_face& current, const gl_cull_face& requested) {
+        if(requested.face != current.face)
+            gl_function{&GladGLContext::CullFace}(ctx, to_gl_underlying_value<GLenum>(requested.face));
+
+        if(requested.front_face != current.front_face)
+            gl_function{&GladGLContext::FrontFace}(ctx, to_gl_underlying_value<GLenum>(requested.front_face));
+    }
+
+    void configure(const decorated_context& ctx, const gl_scissor_test& current, const gl_scissor_test& requested) {
+        if(requested != current)
+            gl_function{&GladGLContext::Scissor}(ctx, requested.x, requested.y, requested.width, requested.height);
+    }
+
+    void configure(const decorated_context& ctx, const gl_primitive_restart& current, const gl_primitive_restart& requested) {
+        if(requested != current)
+            gl_function{&GladGLContext::PrimitiveRestartIndex}(ctx, requested.index);
+    }
+
+    void configure(const decorated_context& ctx, const gl_rasterization& current, const gl_rasterization& requested) {
+        if(requested.polygon_mode != current.polygon_mode)
+            gl_function{&GladGLContext::PolygonMode}(ctx, GL_FRONT_AND_BACK, to_gl_underlying_value<GLenum>(requested.polygon_mode));
+
+        if(requested.point_size != current.point_size)
+            gl_function{&GladGLContext::PointSize}(ctx, requested.point_size);
+
+        if(requested.line_width != current.line_width)
+            gl_function{&GladGLContext::LineWidth}(ctx, requested.line_width);
+    }
+
+    void configure(const decorated_context& ctx, const gl_clear_values& current, const gl_clear_values& requested) {
+        if(requested.colour != current.colour) {
+            const auto& col{requested.colour};
+            gl_function{&GladGLContext::ClearColor}(ctx, col[0], col[1], col[2], col[3]);
+        }
+
+        if(requested.depth != current.depth)
+            gl_function{&GladGLContext::ClearDepth}(ctx, requested.depth);
+
+        if(requested.stencil != current.stencil)
+            gl_function{&GladGLContext::ClearStencil}(ctx, requested.stencil);
+    }
+
     void compensate_for_driver_init_bugs(const characteristic_context& ctx, const gl_stencil_test& init) {
         if(is_intel_arc(ctx.characteristics().renderer())) {
             const auto& func{init.front.func};
@@ -10,7 +10,13 @@
 #include "avocet/OpenGL/Capabilities/Capabilities.hpp"
 
 namespace avocet::opengl {
-    class decorated_context;
+    class decoration_policy;
+
+    template<class Prologue, class Epilogue>
+    class basic_decorated_context;
+
+    using decorated_context = basic_decorated_context<decoration_policy, decoration_policy>;
+
     class characteristic_context;
 }
 
@@ -26,5 +32,15 @@ namespace avocet::opengl::capabilities::impl {
 
     void configure(const decorated_context& ctx, const gl_depth_test& current, const gl_depth_test& requested);
 
+    void configure(const decorated_context& ctx, const gl_cull_face& current, const gl_cull_face& requested);
+
+    void configure(const decorated_context& ctx, const gl_scissor_test& current, const gl_scissor_test& requested);
+
+    void configure(const decorated_context& ctx, const gl_primitive_restart& current, const gl_primitive_restart& requested);
+
+    void configure(const decorated_context& ctx, const gl_rasterization& current, const gl_rasterization& requested);
+
+    void configure(const decorated_context& ctx, const gl_clear_values& current, const gl_clear_values& requested);
+
     void compensate_for_driver_init_bugs(const characteristic_context& ctx, const gl_stencil_test& init);
 }
\ No newline at end of file
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Context/Context.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+#include "glad/gl.h"
+
+namespace avocet::opengl {
+    enum class raw_argument_kind : std::uint8_t {
+        scalar,
+        input_pointer,
+        output_pointer,
+        c_string,
+        string_array,
+        sync_handle,
+        function_pointer
+    };
+
+    /// An argument as it was passed to a gl function, prior to any payload being extracted
+    struct raw_argument {
+        raw_argument_kind kind{};
+        std::uint64_t bits{};
+        const void* pointer{};
+    };
+
+    template<class T>
+    [[nodiscard]]
+    raw_argument to_raw_argument(T val) noexcept {
+        using enum raw_argument_kind;
+        if constexpr(std::is_arithmetic_v<T>) {
+            std::uint64_t bits{};
+            std::memcpy(&bits, &val, sizeof(T));
+            return {scalar, bits, nullptr};
+        }
+        else if constexpr(std::is_same_v<T, GLsync>) {
+            return {sync_handle, std::bit_cast<std::uintptr_t>(val), nullptr};
+        }
+        else if constexpr(std::is_pointer_v<T> && std::is_function_v<std::remove_pointer_t<T>>) {
+            return {function_pointer, 0, nullptr};
+        }
+        else if constexpr(std::is_same_v<T, const GLchar*>) {
+            return {c_string, std::bit_cast<std::uintptr_t>(val), val};
+        }
+        else if constexpr(std::is_pointer_v<T> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, const GLchar*>) {
+            return {string_array, std::bit_cast<std::uintptr_t>(val), val};
+        }
+        else if constexpr(std::is_pointer_v<T> && std::is_const_v<std::remove_pointer_t<T>>) {
+            return {input_pointer, std::bit_cast<std::uintptr_t>(val), val};
+        }
+        else {
+            static_assert(std::is_pointer_v<T>, "to_raw_argument: unsupported argument type");
+            return {output_pointer, std::bit_cast<std::uintptr_t>(val), val};
+        }
+    }
+
+    class command_capture;
+
+    /// Defined alongside command_capture, so that installing a capture_recorder does not require its definition
+    [[nodiscard]]
+    bool is_recording(const command_capture& capture) noexcept;
+
+    void record_call(command_capture& capture, const decorator_data& data, std::span<const raw_argument> args, std::optional<std::uint64_t> result);
+
+    /// An epilogue which, while a scoped_capture is active, records each call into a command_capture before
+    /// forwarding to the next epilogue. Recording happens once the call has been made, so that anything written
+    /// by the driver, such as generated names, is also recorded. Contexts without one pay nothing for capture.
+    class capture_recorder {
+    public:
+        using next_type = std::function<void(const context&, const decorator_data&)>;
+
+        explicit capture_recorder(command_capture& capture, next_type next = {})
+            : m_Capture{&capture}
+            , m_Next{std::move(next)}
+        {}
+
+        void operator()(const context& ctx, const decorator_data& data) const {
+            if(m_Next) m_Next(ctx, data);
+        }
+
+        template<class R, class... Args>
+        void operator()(const context& ctx, const decorator_data& data, const observed_call<R, Args...>& call) const {
+            if(is_recording(*m_Capture)) {
+                const auto raw{
+                    std::apply([](auto... args) { return std::array<raw_argument, sizeof...(Args)>{to_raw_argument(args)...}; }, call.arguments)
+                };
+
+                if constexpr(std::is_void_v<R>)
+                    record_call(*m_Capture, data, raw, std::nullopt);
+                else
+                    record_call(*m_Capture, data, raw, to_raw_argument(call.result).bits);
+            }
+
+            (*this)(ctx, data);
+        }
+    private:
+        command_capture* m_Capture;
+        next_type m_Next;
+    };
+}
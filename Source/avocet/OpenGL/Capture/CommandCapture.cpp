@@ -0,0 +1,366 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Capture/CommandCapture.hpp"
+
+#include "avocet/Core/Utilities/ArithmeticCasts.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+namespace avocet::opengl {
+    namespace {
+        struct pixel_storage {
+            GLint unpack_alignment{}, pack_alignment{};
+        };
+
+        using size_rule = std::optional<std::uint64_t>(*)(std::span<const raw_argument>, const pixel_storage&);
+
+        struct pointer_rule {
+            std::string_view fn_name{};
+            std::size_t arg{};
+            size_rule bytes{};
+            bool checked{};
+        };
+
+        template<class T>
+        [[nodiscard]]
+        T as(const raw_argument& arg) noexcept {
+            T val{};
+            std::memcpy(&val, &arg.bits, sizeof(T));
+            return val;
+        }
+
+        template<std::size_t I, class T, std::uint64_t Multiplier = 1>
+        [[nodiscard]]
+        std::optional<std::uint64_t> count_of(std::span<const raw_argument> args, const pixel_storage&) {
+            const auto n{as<T>(args[I])};
+            return std::cmp_less(n, 0) ? std::nullopt : std::optional{static_cast<std::uint64_t>(n) * Multiplier};
+        }
+
+        template<std::size_t Length, std::size_t Ptr>
+        [[nodiscard]]
+        std::optional<std::uint64_t> string_bytes(std::span<const raw_argument> args, const pixel_storage&) {
+            const auto len{as<GLsizei>(args[Length])};
+            return len < 0 ? std::strlen(static_cast<const char*>(args[Ptr].pointer)) + 1 : static_cast<std::uint64_t>(len);
+        }
+
+        template<std::uint64_t ElementBytes>
+        [[nodiscard]]
+        std::optional<std::uint64_t> clear_buffer_bytes(std::span<const raw_argument> args, const pixel_storage&) {
+            return (as<GLenum>(args[0]) == GL_COLOR ? 4 : 1) * ElementBytes;
+        }
+
+        [[nodiscard]]
+        std::optional<std::uint64_t> tex_parameter_bytes(std::span<const raw_argument> args, const pixel_storage&) {
+            const auto pname{as<GLenum>(args[1])};
+            return ((pname == GL_TEXTURE_BORDER_COLOR) || (pname == GL_TEXTURE_SWIZZLE_RGBA) ? 4 : 1) * 4;
+        }
+
+        [[nodiscard]]
+        std::optional<std::uint64_t> num_components(GLenum format) {
+            switch(format) {
+            case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+                return 1;
+            case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+                return 2;
+            case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+                return 3;
+            case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+                return 4;
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        std::optional<std::uint64_t> bytes_per_pixel(GLenum format, GLenum type) {
+            switch(type) {
+            case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+                return 1;
+            case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+            case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+                return 2;
+            case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+            case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+                return 4;
+            case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+                return 8;
+            }
+
+            const auto components{num_components(format)};
+            if(!components)
+                return std::nullopt;
+
+            switch(type) {
+            case GL_UNSIGNED_BYTE: case GL_BYTE:
+                return *components;
+            case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+                return *components * 2;
+            case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+                return *components * 4;
+            }
+
+            return std::nullopt;
+        }
+
+        /// Assumes that, aside from the alignment, the pixel storage parameters have their default values
+        template<std::size_t Width, std::size_t Height, std::size_t Format, std::size_t Type, bool Unpack>
+        [[nodiscard]]
+        std::optional<std::uint64_t> image_bytes(std::span<const raw_argument> args, const pixel_storage& storage) {
+            const auto width{as<GLsizei>(args[Width])}, height{as<GLsizei>(args[Height])};
+            const auto pixelBytes{bytes_per_pixel(as<GLenum>(args[Format]), as<GLenum>(args[Type]))};
+            if(!pixelBytes || (width < 0) || (height <= 0))
+                return height == 0 ? std::optional<std::uint64_t>{0} : std::nullopt;
+
+            const auto alignment{static_cast<std::uint64_t>(Unpack ? storage.unpack_alignment : storage.pack_alignment)};
+            const auto rowBytes{static_cast<std::uint64_t>(width) * *pixelBytes};
+            const auto alignedRowBytes{(rowBytes + alignment - 1) / alignment * alignment};
+
+            return alignedRowBytes * (static_cast<std::uint64_t>(height) - 1) + rowBytes;
+        }
+
+        [[nodiscard]]
+        std::optional<std::uint64_t> unknowable_size(std::span<const raw_argument>, const pixel_storage&) { return std::nullopt; }
+
+        constexpr std::uint64_t default_output_bytes{4096};
+
+        constexpr std::array input_rules{
+            pointer_rule{"BufferData",                  2, &count_of<1, GLsizeiptr>},
+            pointer_rule{"BufferStorage",               2, &count_of<1, GLsizeiptr>},
+            pointer_rule{"BufferSubData",               3, &count_of<2, GLsizeiptr>},
+            pointer_rule{"ClearBufferfv",               2, &clear_buffer_bytes<4>},
+            pointer_rule{"ClearBufferiv",               2, &clear_buffer_bytes<4>},
+            pointer_rule{"ClearBufferuiv",              2, &clear_buffer_bytes<4>},
+            pointer_rule{"DebugMessageControl",         4, &count_of<3, GLsizei, 4>},
+            pointer_rule{"DebugMessageInsert",          5, &string_bytes<4, 5>},
+            pointer_rule{"DeleteBuffers",               1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteFramebuffers",          1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteProgramPipelines",      1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteQueries",               1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteRenderbuffers",         1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteSamplers",              1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteTextures",              1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteTransformFeedbacks",    1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DeleteVertexArrays",          1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"DrawBuffers",                 1, &count_of<0, GLsizei, 4>},
+            pointer_rule{"InvalidateFramebuffer",       2, &count_of<1, GLsizei, 4>},
+            pointer_rule{"NamedBufferData",             2, &count_of<1, GLsizeiptr>},
+            pointer_rule{"NamedBufferStorage",          2, &count_of<1, GLsizeiptr>},
+            pointer_rule{"NamedBufferSubData",          3, &count_of<2, GLsizeiptr>},
+            pointer_rule{"NamedFramebufferDrawBuffers", 2, &count_of<1, GLsizei, 4>},
+            pointer_rule{"ObjectLabel",                 3, &string_bytes<2, 3>},
+            pointer_rule{"PushDebugGroup",              3, &string_bytes<2, 3>},
+            pointer_rule{"ShaderSource",                3, &count_of<1, GLsizei, 4>},
+            pointer_rule{"TexImage2D",                  8, &image_bytes<3, 4, 6, 7, true>},
+            pointer_rule{"TexParameterfv",              2, &tex_parameter_bytes},
+            pointer_rule{"TexParameteriv",              2, &tex_parameter_bytes},
+            pointer_rule{"TexSubImage2D",               8, &image_bytes<4, 5, 6, 7, true>},
+            pointer_rule{"TextureSubImage2D",           8, &image_bytes<4, 5, 6, 7, true>},
+            pointer_rule{"Uniform1dv",                  2, &count_of<1, GLsizei, 8>},
+            pointer_rule{"Uniform1fv",                  2, &count_of<1, GLsizei, 4>},
+            pointer_rule{"Uniform1iv",                  2, &count_of<1, GLsizei, 4>},
+            pointer_rule{"Uniform1uiv",                 2, &count_of<1, GLsizei, 4>},
+            pointer_rule{"Uniform2dv",                  2, &count_of<1, GLsizei, 16>},
+            pointer_rule{"Uniform2fv",                  2, &count_of<1, GLsizei, 8>},
+            pointer_rule{"Uniform2iv",                  2, &count_of<1, GLsizei, 8>},
+            pointer_rule{"Uniform2uiv",                 2, &count_of<1, GLsizei, 8>},
+            pointer_rule{"Uniform3dv",                  2, &count_of<1, GLsizei, 24>},
+            pointer_rule{"Uniform3fv",                  2, &count_of<1, GLsizei, 12>},
+            pointer_rule{"Uniform3iv",                  2, &count_of<1, GLsizei, 12>},
+            pointer_rule{"Uniform3uiv",                 2, &count_of<1, GLsizei, 12>},
+            pointer_rule{"Uniform4dv",                  2, &count_of<1, GLsizei, 32>},
+            pointer_rule{"Uniform4fv",                  2, &count_of<1, GLsizei, 16>},
+            pointer_rule{"Uniform4iv",                  2, &count_of<1, GLsizei, 16>},
+            pointer_rule{"Uniform4uiv",                 2, &count_of<1, GLsizei, 16>},
+            pointer_rule{"UniformMatrix2fv",            3, &count_of<1, GLsizei, 16>},
+            pointer_rule{"UniformMatrix3fv",            3, &count_of<1, GLsizei, 36>},
+            pointer_rule{"UniformMatrix4fv",            3, &count_of<1, GLsizei, 64>}
+        };
+
+        constexpr std::array output_rules{
+            pointer_rule{"CreateBuffers",               1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"CreateFramebuffers",          1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"CreateProgramPipelines",      1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"CreateQueries",               2, &count_of<1, GLsizei, 4>, true},
+            pointer_rule{"CreateRenderbuffers",         1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"CreateSamplers",              1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"CreateTextures",              2, &count_of<1, GLsizei, 4>, true},
+            pointer_rule{"CreateTransformFeedbacks",    1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"CreateVertexArrays",          1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenBuffers",                  1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenFramebuffers",             1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenProgramPipelines",         1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenQueries",                  1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenRenderbuffers",            1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenSamplers",                 1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenTextures",                 1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenTransformFeedbacks",       1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GenVertexArrays",             1, &count_of<0, GLsizei, 4>, true},
+            pointer_rule{"GetActiveAttrib",             6, &count_of<2, GLsizei>},
+            pointer_rule{"GetActiveUniform",            6, &count_of<2, GLsizei>},
+            pointer_rule{"GetBufferSubData",            3, &count_of<2, GLsizeiptr>},
+            pointer_rule{"GetCompressedTexImage",       2, &unknowable_size},
+            pointer_rule{"GetDebugMessageLog",          2, &count_of<0, GLuint, 4>},
+            pointer_rule{"GetDebugMessageLog",          3, &count_of<0, GLuint, 4>},
+            pointer_rule{"GetDebugMessageLog",          4, &count_of<0, GLuint, 4>},
+            pointer_rule{"GetDebugMessageLog",          5, &count_of<0, GLuint, 4>},
+            pointer_rule{"GetDebugMessageLog",          6, &count_of<0, GLuint, 4>},
+            pointer_rule{"GetDebugMessageLog",          7, &count_of<1, GLsizei>},
+            pointer_rule{"GetNamedBufferSubData",       3, &count_of<2, GLsizeiptr>},
+            pointer_rule{"GetObjectLabel",              4, &count_of<2, GLsizei>},
+            pointer_rule{"GetProgramInfoLog",           3, &count_of<1, GLsizei>},
+            pointer_rule{"GetShaderInfoLog",            3, &count_of<1, GLsizei>},
+            pointer_rule{"GetShaderSource",             3, &count_of<1, GLsizei>},
+            pointer_rule{"GetTexImage",                 4, &unknowable_size},
+            pointer_rule{"GetTextureImage",             5, &count_of<4, GLsizei>},
+            pointer_rule{"ReadPixels",                  6, &image_bytes<2, 3, 4, 5, false>}
+        };
+
+        [[nodiscard]]
+        const pointer_rule* find_rule(std::span<const pointer_rule> rules, std::string_view fnName, std::size_t arg) {
+            const auto found{std::ranges::find_if(rules, [=](const pointer_rule& r) { return (r.fn_name == fnName) && (r.arg == arg); })};
+            return found != rules.end() ? &*found : nullptr;
+        }
+
+        void mark_unreplayable(captured_call& call, captured_argument& arg) noexcept {
+            call.replayable = false;
+            arg = {argument_kind::null, 0, 0};
+        }
+
+        [[nodiscard]]
+        std::uint16_t find_fn_index(std::string_view fnName) {
+            const auto found{std::ranges::lower_bound(glad_ctx_member_info, fnName, {}, &member_info::name)};
+            if((found == glad_ctx_member_info.end()) || (found->name != fnName))
+                throw std::runtime_error{std::format("command_capture: {} not found in glad_ctx_member_info", fnName)};
+
+            return checked_conversion_to<std::uint16_t>(std::ranges::distance(glad_ctx_member_info.begin(), found));
+        }
+    }
+
+    command_capture::command_capture(capture_capacity capacity)
+    {
+        m_Log.m_Calls.reserve(capacity.calls);
+        m_Log.m_Arguments.reserve(4 * capacity.calls);
+        m_Log.m_Payload.reserve(capacity.payload_bytes);
+    }
+
+    [[nodiscard]]
+    command_log command_capture::release() noexcept {
+        return std::exchange(m_Log, {});
+    }
+
+    [[nodiscard]]
+    captured_argument command_capture::append_payload(const void* data, std::size_t bytes, argument_kind kind) {
+        auto& payload{m_Log.m_Payload};
+        const auto offset{(payload.size() + command_log::payload_alignment - 1) / command_log::payload_alignment * command_log::payload_alignment};
+        payload.resize(offset + bytes);
+        if(bytes)
+            std::memcpy(payload.data() + offset, data, bytes);
+
+        return {kind, offset, bytes};
+    }
+
+    bool is_recording(const command_capture& capture) noexcept { return capture.recording(); }
+
+    void record_call(command_capture& capture, const decorator_data& data, std::span<const raw_argument> args, std::optional<std::uint64_t> result) {
+        capture.do_record(data, args, result);
+    }
+
+    void command_capture::do_record(const decorator_data& data, std::span<const raw_argument> args, std::optional<std::uint64_t> result) {
+        const std::string_view fnName{data.fn_name};
+        if((fnName == "PixelStorei") && (args.size() == 2)) {
+            if(const auto pname{as<GLenum>(args[0])}; pname == GL_UNPACK_ALIGNMENT)
+                m_UnpackAlignment = as<GLint>(args[1]);
+            else if(pname == GL_PACK_ALIGNMENT)
+                m_PackAlignment = as<GLint>(args[1]);
+        }
+
+        captured_call call{
+            .fn_index{find_fn_index(fnName)},
+            .num_args{checked_conversion_to<std::uint16_t>(args.size())},
+            .first_arg{checked_conversion_to<std::uint32_t>(m_Log.m_Arguments.size())},
+            .result{result.value_or(0)},
+            .has_result{result.has_value()},
+            .replayable{true}
+        };
+
+        const pixel_storage storage{m_UnpackAlignment, m_PackAlignment};
+        for(std::size_t i{}; i < args.size(); ++i) {
+            const auto& arg{args[i]};
+            using enum raw_argument_kind;
+            captured_argument captured{argument_kind::scalar, arg.bits, 0};
+            if((arg.kind != scalar) && (arg.kind != sync_handle) && !arg.pointer) {
+                captured = {argument_kind::null, 0, 0};
+            }
+            else {
+                switch(arg.kind) {
+                case scalar:
+                    break;
+                case sync_handle:
+                    captured = {argument_kind::sync_handle, arg.bits, 0};
+                    break;
+                case function_pointer:
+                    captured = {argument_kind::null, 0, 0};
+                    break;
+                case c_string:
+                case input_pointer:
+                    if(const auto* rule{find_rule(input_rules, fnName, i)}) {
+                        if(const auto bytes{rule->bytes(args, storage)})
+                            captured = append_payload(arg.pointer, *bytes, argument_kind::payload);
+                        else
+                            mark_unreplayable(call, captured);
+                    }
+                    else if(arg.kind == c_string) {
+                        captured = append_payload(arg.pointer, std::strlen(static_cast<const char*>(arg.pointer)) + 1, argument_kind::payload);
+                    }
+                    else {
+                        // Pointers for which no size can be deduced are taken to be offsets into a bound buffer
+                        captured = {argument_kind::offset, arg.bits, 0};
+                    }
+                    break;
+                case string_array:
+                {
+                    const auto count{(i > 0) ? as<GLsizei>(args[i - 1]) : 0};
+                    const auto* lengths{(fnName == "ShaderSource") && (i + 1 < args.size()) ? static_cast<const GLint*>(args[i + 1].pointer) : nullptr};
+                    const auto* strings{static_cast<const GLchar* const*>(arg.pointer)};
+
+                    captured = append_payload(nullptr, 0, argument_kind::string_array);
+                    for(GLsizei s{}; s < count; ++s) {
+                        const auto length{(lengths && (lengths[s] >= 0)) ? static_cast<std::uint32_t>(lengths[s]) : static_cast<std::uint32_t>(std::strlen(strings[s]))};
+                        const auto offset{m_Log.m_Payload.size()};
+                        m_Log.m_Payload.resize(offset + sizeof(length) + length + 1);
+                        std::memcpy(m_Log.m_Payload.data() + offset, &length, sizeof(length));
+                        std::memcpy(m_Log.m_Payload.data() + offset + sizeof(length), strings[s], length);
+                        m_Log.m_Payload.back() = std::byte{};
+                    }
+
+                    captured.size = m_Log.m_Payload.size() - captured.value;
+                    break;
+                }
+                case output_pointer:
+                    if(const auto* rule{find_rule(output_rules, fnName, i)}) {
+                        if(const auto bytes{rule->bytes(args, storage)})
+                            captured = rule->checked ? append_payload(arg.pointer, *bytes, argument_kind::checked_output) : captured_argument{argument_kind::output, 0, *bytes};
+                        else
+                            mark_unreplayable(call, captured);
+                    }
+                    else {
+                        captured = {argument_kind::output, 0, default_output_bytes};
+                    }
+                    break;
+                }
+            }
+
+            m_Log.m_Arguments.push_back(captured);
+        }
+
+        m_Log.m_Calls.push_back(call);
+    }
+}
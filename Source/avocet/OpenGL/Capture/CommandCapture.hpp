@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Capture/CaptureRecorder.hpp"
+#include "avocet/OpenGL/Capture/CommandLog.hpp"
+
+#include <source_location>
+#include <string_view>
+
+namespace avocet::opengl {
+    struct capture_capacity {
+        std::size_t calls{}, payload_bytes{};
+    };
+
+    /// Records gl calls, including snapshots of any data read by the driver, into a command_log.
+    /// Calls made through a context are recorded by installing a capture_recorder as its epilogue,
+    /// and only for the lifetime of a scoped_capture.
+    class command_capture {
+    public:
+        explicit command_capture(capture_capacity capacity);
+
+        command_capture(const command_capture&)            = delete;
+        command_capture& operator=(const command_capture&) = delete;
+
+        template<class... Args>
+        void record(const decorator_data& data, Args... args) {
+            const std::array<raw_argument, sizeof...(Args)> raw{to_raw_argument(args)...};
+            do_record(data, raw, std::nullopt);
+        }
+
+        template<class R, class... Args>
+        void record_with_result(const decorator_data& data, R result, Args... args) {
+            const std::array<raw_argument, sizeof...(Args)> raw{to_raw_argument(args)...};
+            do_record(data, raw, to_raw_argument(result).bits);
+        }
+
+        [[nodiscard]]
+        bool recording() const noexcept { return m_Recording; }
+
+        [[nodiscard]]
+        const command_log& log() const noexcept { return m_Log; }
+
+        [[nodiscard]]
+        command_log release() noexcept;
+    private:
+        friend class scoped_capture;
+        friend void record_call(command_capture&, const decorator_data&, std::span<const raw_argument>, std::optional<std::uint64_t>);
+
+        command_log m_Log{};
+        GLint m_UnpackAlignment{4}, m_PackAlignment{4};
+        bool m_Recording{};
+
+        void do_record(const decorator_data& data, std::span<const raw_argument> args, std::optional<std::uint64_t> result);
+
+        [[nodiscard]]
+        captured_argument append_payload(const void* data, std::size_t bytes, argument_kind kind);
+    };
+
+    /// Calls are recorded by any capture_recorder attached to capture for the lifetime of the scope
+    class [[nodiscard]] scoped_capture {
+        command_capture* m_Capture{};
+    public:
+        explicit scoped_capture(command_capture& capture) noexcept
+            : m_Capture{&capture}
+        {
+            m_Capture->m_Recording = true;
+        }
+
+        scoped_capture(const scoped_capture&)            = delete;
+        scoped_capture& operator=(const scoped_capture&) = delete;
+
+        ~scoped_capture() { m_Capture->m_Recording = false; }
+    };
+}
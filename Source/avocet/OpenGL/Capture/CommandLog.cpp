@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Capture/CommandLog.hpp"
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace avocet::opengl {
+    namespace {
+        constexpr std::array<char, 4> magic{'A', 'G', 'L', 'C'};
+        constexpr std::uint32_t format_version{1};
+
+        template<class T>
+            requires std::is_trivially_copyable_v<T>
+        void write_value(std::ostream& stream, const T& val) {
+            stream.write(reinterpret_cast<const char*>(&val), sizeof(T));
+        }
+
+        template<class T>
+            requires std::is_trivially_copyable_v<T>
+        [[nodiscard]]
+        T read_value(std::istream& stream) {
+            T val{};
+            if(!stream.read(reinterpret_cast<char*>(&val), sizeof(T)))
+                throw std::runtime_error{"command_log::read: unexpected end of stream"};
+
+            return val;
+        }
+
+        template<class T, class Fn>
+        [[nodiscard]]
+        std::vector<T> read_sequence(std::istream& stream, Fn fn) {
+            const auto n{read_value<std::uint64_t>(stream)};
+            std::vector<T> seq{};
+            seq.reserve(n);
+            for(std::uint64_t i{}; i < n; ++i)
+                seq.push_back(fn());
+
+            return seq;
+        }
+
+        [[nodiscard]]
+        bool is_valid(argument_kind kind) noexcept {
+            return kind <= argument_kind::sync_handle;
+        }
+    }
+
+    void command_log::clear() noexcept {
+        m_Calls.clear();
+        m_Arguments.clear();
+        m_Payload.clear();
+    }
+
+    [[nodiscard]]
+    std::size_t command_log::payload_size(const captured_argument& arg) noexcept {
+        using enum argument_kind;
+        return ((arg.kind == payload) || (arg.kind == string_array) || (arg.kind == checked_output)) ? arg.size : 0;
+    }
+
+    void command_log::write(std::ostream& stream) const {
+        stream.write(magic.data(), magic.size());
+        write_value(stream, format_version);
+
+        write_value(stream, std::uint64_t{m_Calls.size()});
+        for(const auto& call : m_Calls) {
+            write_value(stream, call.fn_index);
+            write_value(stream, call.num_args);
+            write_value(stream, call.first_arg);
+            write_value(stream, call.result);
+            write_value(stream, static_cast<std::uint8_t>(call.has_result | (call.replayable << 1)));
+        }
+
+        write_value(stream, std::uint64_t{m_Arguments.size()});
+        for(const auto& arg : m_Arguments) {
+            write_value(stream, arg.kind);
+            write_value(stream, arg.value);
+            write_value(stream, arg.size);
+        }
+
+        write_value(stream, std::uint64_t{m_Payload.size()});
+        stream.write(reinterpret_cast<const char*>(m_Payload.data()), m_Payload.size());
+
+        if(!stream)
+            throw std::runtime_error{"command_log::write: stream failure"};
+    }
+
+    void command_log::write(const std::filesystem::path& file) const {
+        std::ofstream stream{file, std::ios_base::binary};
+        if(!stream)
+            throw std::runtime_error{std::format("command_log: unable to open {} for writing", file.generic_string())};
+
+        write(stream);
+    }
+
+    [[nodiscard]]
+    command_log command_log::read(std::istream& stream) {
+        if(read_value<std::array<char, 4>>(stream) != magic)
+            throw std::runtime_error{"command_log::read: not a command log"};
+
+        if(const auto version{read_value<std::uint32_t>(stream)}; version != format_version)
+            throw std::runtime_error{std::format("command_log::read: unsupported version {}", version)};
+
+        command_log log{};
+        log.m_Calls = read_sequence<captured_call>(stream, [&stream]() {
+            captured_call call{};
+            call.fn_index  = read_value<std::uint16_t>(stream);
+            call.num_args  = read_value<std::uint16_t>(stream);
+            call.first_arg = read_value<std::uint32_t>(stream);
+            call.result    = read_value<std::uint64_t>(stream);
+
+            const auto flags{read_value<std::uint8_t>(stream)};
+            call.has_result = (flags & 1) != 0;
+            call.replayable = (flags & 2) != 0;
+            return call;
+        });
+
+        log.m_Arguments = read_sequence<captured_argument>(stream, [&stream]() {
+            const auto kind{read_value<argument_kind>(stream)};
+            if(!is_valid(kind))
+                throw std::runtime_error{std::format("command_log::read: unrecognized argument kind {}", static_cast<int>(kind))};
+
+            const auto value{read_value<std::uint64_t>(stream)};
+            return captured_argument{kind, value, read_value<std::uint64_t>(stream)};
+        });
+
+        log.m_Payload.resize(read_value<std::uint64_t>(stream));
+        if(!stream.read(reinterpret_cast<char*>(log.m_Payload.data()), log.m_Payload.size()))
+            throw std::runtime_error{"command_log::read: truncated payload"};
+
+        for(const auto& call : log.m_Calls) {
+            if(call.first_arg + std::size_t{call.num_args} > log.m_Arguments.size())
+                throw std::runtime_error{"command_log::read: call arguments out of range"};
+        }
+
+        for(const auto& arg : log.m_Arguments) {
+            if(const auto size{payload_size(arg)}; size && (arg.value + size > log.m_Payload.size()))
+                throw std::runtime_error{"command_log::read: payload out of range"};
+        }
+
+        return log;
+    }
+
+    [[nodiscard]]
+    command_log command_log::read(const std::filesystem::path& file) {
+        std::ifstream stream{file, std::ios_base::binary};
+        if(!stream)
+            throw std::runtime_error{std::format("command_log: unable to open {} for reading", file.generic_string())};
+
+        return read(stream);
+    }
+}
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <span>
+#include <vector>
+
+namespace avocet::opengl {
+    enum class argument_kind : std::uint8_t {
+        scalar,         // The bits of an arithmetic value
+        null,
+        offset,         // A pointer which is interpreted as an offset into a bound buffer
+        payload,        // A snapshot of data read by the driver
+        string_array,   // For each string, its length as a std::uint32_t followed by its null-terminated characters
+        output,         // Scratch space of size bytes, to be written by the driver
+        checked_output, // As for output, but the payload holds what was written during capture
+        sync_handle
+    };
+
+    /// Where there is a payload, value is its offset into the log's payload and size is its length in bytes
+    struct captured_argument {
+        argument_kind kind{};
+        std::uint64_t value{}, size{};
+
+        [[nodiscard]]
+        friend bool operator==(const captured_argument&, const captured_argument&) noexcept = default;
+    };
+
+    /// fn_index identifies the entry point by its position in glad_ctx_member_info
+    struct captured_call {
+        std::uint16_t fn_index{}, num_args{};
+        std::uint32_t first_arg{};
+        std::uint64_t result{};
+        bool has_result{}, replayable{true};
+
+        [[nodiscard]]
+        friend bool operator==(const captured_call&, const captured_call&) noexcept = default;
+    };
+
+    class command_capture;
+
+    /// A sequence of gl calls which may be written to, and read from, a binary file. The file is in
+    /// native byte order and so is not expected to be shared between machines of differing endianness.
+    class command_log {
+    public:
+        constexpr static std::size_t payload_alignment{16};
+
+        command_log() = default;
+
+        [[nodiscard]]
+        std::span<const captured_call> calls() const noexcept { return m_Calls; }
+
+        [[nodiscard]]
+        std::span<const captured_argument> arguments(const captured_call& call) const noexcept {
+            return std::span{m_Arguments}.subspan(call.first_arg, call.num_args);
+        }
+
+        [[nodiscard]]
+        std::span<const std::byte> payload(const captured_argument& arg) const noexcept {
+            return std::span{m_Payload}.subspan(arg.value, payload_size(arg));
+        }
+
+        [[nodiscard]]
+        std::size_t payload_bytes() const noexcept { return m_Payload.size(); }
+
+        void clear() noexcept;
+
+        void write(std::ostream& stream) const;
+
+        void write(const std::filesystem::path& file) const;
+
+        [[nodiscard]]
+        static command_log read(std::istream& stream);
+
+        [[nodiscard]]
+        static command_log read(const std::filesystem::path& file);
+
+        [[nodiscard]]
+        friend bool operator==(const command_log&, const command_log&) noexcept = default;
+    private:
+        friend command_capture;
+
+        std::vector<captured_call> m_Calls{};
+        std::vector<captured_argument> m_Arguments{};
+        std::vector<std::byte> m_Payload{};
+
+        [[nodiscard]]
+        static std::size_t payload_size(const captured_argument& arg) noexcept;
+    };
+}
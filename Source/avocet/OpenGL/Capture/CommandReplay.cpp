@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Capture/CommandReplay.hpp"
+#include "avocet/OpenGL/Context/ContextBase.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace avocet::opengl {
+    namespace {
+        struct replay_state {
+            const command_log& log;
+            std::vector<std::byte> scratch{};
+            std::vector<const GLchar*> strings{};
+            std::unordered_map<std::uint64_t, GLsync> syncs{};
+            std::size_t divergences{};
+        };
+
+        [[nodiscard]]
+        constexpr std::uint64_t aligned_size(std::uint64_t bytes) noexcept {
+            return (bytes + command_log::payload_alignment - 1) / command_log::payload_alignment * command_log::payload_alignment;
+        }
+
+        [[nodiscard]]
+        bool is_output(const captured_argument& arg) noexcept {
+            return (arg.kind == argument_kind::output) || (arg.kind == argument_kind::checked_output);
+        }
+
+        [[nodiscard]]
+        std::uint64_t scratch_bytes(const command_log& log) {
+            std::uint64_t maxBytes{};
+            for(const auto& call : log.calls()) {
+                std::uint64_t bytes{};
+                for(const auto& arg : log.arguments(call)) {
+                    if(is_output(arg))
+                        bytes += aligned_size(arg.size);
+                }
+
+                maxBytes = std::ranges::max(maxBytes, bytes);
+            }
+
+            return maxBytes;
+        }
+
+        void unpack_strings(replay_state& state, std::span<const std::byte> payload) {
+            state.strings.clear();
+            while(!payload.empty()) {
+                std::uint32_t length{};
+                std::memcpy(&length, payload.data(), sizeof(length));
+                state.strings.push_back(reinterpret_cast<const GLchar*>(payload.data() + sizeof(length)));
+                payload = payload.subspan(sizeof(length) + length + 1);
+            }
+        }
+
+        /// Pointer arguments are decoded without regard to constness, which is restored by the signature of the entry point
+        template<class T>
+        [[nodiscard]]
+        T pointer_to(const void* p) noexcept {
+            return static_cast<T>(const_cast<void*>(p));
+        }
+
+        template<class T>
+        [[nodiscard]]
+        T decode(replay_state& state, const captured_argument& arg, std::uint64_t& scratchOffset) {
+            if constexpr(std::is_arithmetic_v<T>) {
+                T val{};
+                std::memcpy(&val, &arg.value, sizeof(T));
+                return val;
+            }
+            else if constexpr(std::is_same_v<T, GLsync>) {
+                const auto found{state.syncs.find(arg.value)};
+                return found != state.syncs.end() ? found->second : nullptr;
+            }
+            else if constexpr(std::is_function_v<std::remove_pointer_t<T>>) {
+                return nullptr;
+            }
+            else {
+                switch(arg.kind) {
+                    using enum argument_kind;
+                case null:
+                    return nullptr;
+                case payload:
+                    return pointer_to<T>(state.log.payload(arg).data());
+                case string_array:
+                    unpack_strings(state, state.log.payload(arg));
+                    return pointer_to<T>(state.strings.data());
+                case output:
+                case checked_output:
+                {
+                    auto* const p{state.scratch.data() + scratchOffset};
+                    scratchOffset += aligned_size(arg.size);
+                    return pointer_to<T>(p);
+                }
+                default:
+                    return reinterpret_cast<T>(static_cast<std::uintptr_t>(arg.value));
+                }
+            }
+        }
+
+        void verify_outputs(replay_state& state, std::span<const captured_argument> args) {
+            std::uint64_t scratchOffset{};
+            for(const auto& arg : args) {
+                if(arg.kind == argument_kind::checked_output) {
+                    const auto expected{state.log.payload(arg)};
+                    if(!std::ranges::equal(expected, std::span{state.scratch}.subspan(scratchOffset, expected.size())))
+                        ++state.divergences;
+                }
+
+                if(is_output(arg))
+                    scratchOffset += aligned_size(arg.size);
+            }
+        }
+
+        template<class R>
+        void check_result(replay_state& state, const captured_call& call, R result) {
+            if constexpr(std::is_same_v<R, GLsync>) {
+                state.syncs[call.result] = result;
+            }
+            else if constexpr(std::is_arithmetic_v<R>) {
+                std::uint64_t bits{};
+                std::memcpy(&bits, &result, sizeof(R));
+                if(bits != call.result)
+                    ++state.divergences;
+            }
+        }
+
+        template<class R, class... Args>
+        [[nodiscard]]
+        bool replay_signature(R(*fn)(Args...), replay_state& state, const captured_call& call) {
+            if(!fn)
+                return false;
+
+            const auto args{state.log.arguments(call)};
+            if(args.size() != sizeof...(Args))
+                throw std::runtime_error{std::format("replay: {} expects {} arguments but {} were captured", glad_ctx_member_info[call.fn_index].name, sizeof...(Args), args.size())};
+
+            std::uint64_t scratchOffset{};
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                // Braced initialization guarantees left-to-right decoding, over which output scratch space is allocated
+                const std::tuple<Args...> decoded{decode<Args>(state, args[I], scratchOffset)...};
+                if constexpr(std::is_void_v<R>) {
+                    std::apply(fn, decoded);
+                }
+                else {
+                    check_result(state, call, std::apply(fn, decoded));
+                }
+            }(std::index_sequence_for<Args...>{});
+
+            verify_outputs(state, args);
+            return true;
+        }
+
+        template<auto PtrToMem>
+        [[nodiscard]]
+        bool replay_call(const GladGLContext& ctx, replay_state& state, const captured_call& call) {
+            return replay_signature(ctx.*PtrToMem, state, call);
+        }
+
+        using replayer = bool(*)(const GladGLContext&, replay_state&, const captured_call&);
+
+#define MAKE_REPLAYER(name) &replay_call<&GladGLContext::name>,
+
+        constexpr std::array<replayer, glad_ctx_member_info.size()> replayers{
+            AVOCET_GLAD_CTX_MEMBERS(MAKE_REPLAYER)
+        };
+
+#undef MAKE_REPLAYER
+    }
+
+    [[nodiscard]]
+    replay_report replay(const GladGLContext& ctx, const command_log& log) {
+        replay_state state{.log{log}, .scratch{std::vector<std::byte>(scratch_bytes(log))}};
+        replay_report report{};
+
+        const auto start{std::chrono::steady_clock::now()};
+        for(const auto& call : log.calls()) {
+            if(call.fn_index >= replayers.size())
+                throw std::runtime_error{std::format("replay: entry point index {} out of range", call.fn_index)};
+
+            if(call.replayable && replayers[call.fn_index](ctx, state, call))
+                ++report.replayed;
+            else
+                ++report.skipped;
+        }
+
+        report.duration    = std::chrono::steady_clock::now() - start;
+        report.divergences = state.divergences;
+        return report;
+    }
+}
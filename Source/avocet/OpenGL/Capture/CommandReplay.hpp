@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Capture/CommandLog.hpp"
+
+#include <chrono>
+
+#include "glad/gl.h"
+
+namespace avocet::opengl {
+    /// Calls are skipped if they could not be faithfully captured or if the entry point is null.
+    /// Divergences are results, or generated names, which differ from those captured, indicating
+    /// that the replay is no longer a faithful reproduction of the original.
+    struct replay_report {
+        std::size_t replayed{}, skipped{}, divergences{};
+        std::chrono::nanoseconds duration{};
+
+        [[nodiscard]]
+        double calls_per_second() const noexcept {
+            const std::chrono::duration<double> seconds{duration};
+            return seconds.count() > 0 ? replayed / seconds.count() : 0.0;
+        }
+    };
+
+    /// Issues the captured calls directly through the entry points of ctx, bypassing any decoration
+    [[nodiscard]]
+    replay_report replay(const GladGLContext& ctx, const command_log& log);
+}
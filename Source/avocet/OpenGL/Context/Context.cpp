@@ -6,10 +6,13 @@
 ////////////////////////////////////////////////////////////////////
 
 #include "avocet/OpenGL/Context/Context.hpp"
+#include "avocet/OpenGL/Context/GLFunction.hpp"
 #include "avocet/OpenGL/Context/GLGetters.hpp"
 
 #include "avocet/Core/Utilities/ArithmeticCasts.hpp"
 
+#include <string>
+
 namespace avocet::opengl {
     namespace {
         [[nodiscard]]
@@ -19,10 +22,35 @@ namespace avocet::opengl {
 
             return checked_conversion_to<std::size_t>(get(ctx, int_names::max_debug_message_length));
         }
+
+        constexpr queue_capacity asynchronous_debug_message_capacity{256};
+
+        void GLAD_API_PTR enqueue_debug_message(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam) {
+            // The queue was registered as a non-const pointer by context::install_debug_message_callback
+            auto& queue{*static_cast<debug_message_queue*>(const_cast<void*>(userParam))};
+            const std::string_view text{message, length >= 0 ? static_cast<std::size_t>(length) : std::char_traits<GLchar>::length(message)};
+
+            queue.try_push(source, type, id, severity, text);
+        }
     }
 
     context_debug_characteristics::context_debug_characteristics(const context_base& ctx)
         : m_MaxDebugMessageLength{get_max_debug_message_length(ctx, ctx.fundamental_characteristics().debug_output_enabled())}
     {
     }
+
+    [[nodiscard]]
+    unique_debug_message_queue context::make_debug_message_queue(const context_base& ctx, const context_debug_characteristics& characteristics) {
+        if((ctx.debug_mode() != debugging_mode::asynchronous) || !ctx.fundamental_characteristics().debug_output_enabled())
+            return {};
+
+        return unique_debug_message_queue{
+            std::make_unique<debug_message_queue>(asynchronous_debug_message_capacity, max_message_length{characteristics.max_debug_message_length().value()})
+        };
+    }
+
+    void context::install_debug_message_callback() {
+        if(auto* pQueue{m_DebugMessages.get()})
+            gl_function{&GladGLContext::DebugMessageCallback}(static_cast<const context_base&>(*this), &enqueue_debug_message, static_cast<const void*>(pQueue));
+    }
 }
\ No newline at end of file
@@ -8,6 +8,10 @@
 #pragma once
 
 #include "avocet/OpenGL/Context/ContextBase.hpp"
+#include "avocet/OpenGL/Debugging/DebugMessageQueue.hpp"
+
+#include <memory>
+#include <tuple>
 
 namespace avocet::opengl {
     struct decorator_data {
@@ -15,6 +19,18 @@ namespace avocet::opengl {
         std::source_location loc;
     };
 
+    /// The arguments and, unless void, the result of a call; passed, in addition, to any epilogue able to accept it
+    template<class R, class... Args>
+    struct observed_call {
+        R result;
+        std::tuple<Args...> arguments;
+    };
+
+    template<class... Args>
+    struct observed_call<void, Args...> {
+        std::tuple<Args...> arguments;
+    };
+
     class context_debug_characteristics {
         std::optional<std::size_t> m_MaxDebugMessageLength{};
     public:
@@ -24,6 +40,29 @@ namespace avocet::opengl {
         std::optional<std::size_t> max_debug_message_length() const noexcept { return m_MaxDebugMessageLength; }
     };
 
+    /// Owns the queue, if any, into which the driver pushes debug messages in debugging_mode::asynchronous.
+    /// Move assignment swaps, rather than releases, since the driver holds a pointer to the queue for as
+    /// long as the associated OpenGL context has the callback installed.
+    class unique_debug_message_queue {
+        std::unique_ptr<debug_message_queue> m_Queue{};
+    public:
+        unique_debug_message_queue() = default;
+
+        explicit unique_debug_message_queue(std::unique_ptr<debug_message_queue> queue)
+            : m_Queue{std::move(queue)}
+        {}
+
+        unique_debug_message_queue(unique_debug_message_queue&&) noexcept = default;
+
+        unique_debug_message_queue& operator=(unique_debug_message_queue&& other) noexcept {
+            std::ranges::swap(m_Queue, other.m_Queue);
+            return *this;
+        }
+
+        [[nodiscard]]
+        debug_message_queue* get() const noexcept { return m_Queue.get(); }
+    };
+
     class context : public context_base {
     public:
         template<class Loader>
@@ -31,17 +70,34 @@ namespace avocet::opengl {
         context(debugging_mode mode, Loader loader)
             : context_base{mode, std::move(loader)}
             , m_Characteristics{static_cast<const context_base&>(*this)}
-        {}
+            , m_DebugMessages{make_debug_message_queue(*this, m_Characteristics)}
+        {
+            install_debug_message_callback();
+        }
 
         [[nodiscard]]
         const context_debug_characteristics& debug_characteristics() const noexcept { return m_Characteristics; }
+
+        /// Non-null only in debugging_mode::asynchronous, if debug output is enabled
+        [[nodiscard]]
+        debug_message_queue* asynchronous_debug_messages() const noexcept { return m_DebugMessages.get(); }
     protected:
-        ~context() = default;
+        ~context() {
+            // Bypass gl_function, which may throw
+            if(m_DebugMessages.get() && glad_context().DebugMessageCallback)
+                glad_context().DebugMessageCallback(nullptr, nullptr);
+        }
 
         context(context&&) noexcept = default;
 
         context& operator=(context&&) noexcept = default;
     private:
         context_debug_characteristics m_Characteristics;
+        unique_debug_message_queue m_DebugMessages;
+
+        [[nodiscard]]
+        static unique_debug_message_queue make_debug_message_queue(const context_base& ctx, const context_debug_characteristics& characteristics);
+
+        void install_debug_message_callback();
     };
 }
\ No newline at end of file
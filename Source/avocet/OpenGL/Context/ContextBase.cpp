@@ -26,9 +26,11 @@ namespace avocet::opengl {
     std::string to_string(debugging_mode mode) {
         using enum debugging_mode;
         switch(mode) {
-        case off:     return "off";
-        case basic:   return "basic";
-        case dynamic: return "dynamic";
+        case off:          return "off";
+        case basic:        return "basic";
+        case dynamic:      return "dynamic";
+        case asynchronous: return "asynchronous";
+        case deferred:     return "deferred";
         }
 
         throw std::runtime_error{error_message("debugging_mode", mode)};
@@ -36,8 +38,9 @@ namespace avocet::opengl {
 
     context_fundamental_characteristics::context_fundamental_characteristics(opengl_version version, debugging_mode mode)
         : m_Version{version}
-        , m_DebugOutputEnabled{opengl::debug_output_supported(version) && (mode == debugging_mode::dynamic)}
+        , m_DebugOutputEnabled{opengl::debug_output_supported(version) && requests_debug_output(mode)}
         , m_ObjectLabelsAvailable{labelling_available(version, m_DebugOutputEnabled)}
+        , m_DirectStateAccessAvailable{opengl::direct_state_access_supported(version)}
     {
     }
 
@@ -72,7 +75,9 @@ namespace avocet::opengl {
         const GLint flags{get(*this, int_names::context_flags)};
         if(flags & GL_CONTEXT_FLAG_DEBUG_BIT) {
             gl_function{&GladGLContext::Enable}(*this, GL_DEBUG_OUTPUT);
-            gl_function{&GladGLContext::Enable}(*this, GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            if(debug_mode() != debugging_mode::asynchronous)
+                gl_function{&GladGLContext::Enable}(*this, GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
             gl_function{&GladGLContext::DebugMessageControl}(
                 *this,
                 GL_DONT_CARE,
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "avocet/OpenGL/Context/GladContextMembers.hpp"
+#include "avocet/OpenGL/Context/StateShadow.hpp"
 #include "avocet/OpenGL/Context/Version.hpp"
 
 #include <array>
@@ -20,11 +22,22 @@
 #include "glad/gl.h"
 
 namespace avocet::opengl {
-    enum class debugging_mode { off = 0, basic, dynamic };
+    enum class debugging_mode { off = 0, basic, dynamic, asynchronous, deferred };
 
     [[nodiscard]]
     std::string to_string(debugging_mode mode);
 
+    [[nodiscard]]
+    constexpr bool requests_debug_output(debugging_mode mode) noexcept {
+        return (mode == debugging_mode::dynamic) || (mode == debugging_mode::asynchronous);
+    }
+
+    /// Modes in which each query answered from the state shadow is cross-checked against the driver
+    [[nodiscard]]
+    constexpr bool validates_state_shadow(debugging_mode mode) noexcept {
+        return (mode == debugging_mode::basic) || (mode == debugging_mode::dynamic);
+    }
+
     class unique_glad_context {
         GladGLContext m_Context{};
     public:
@@ -66,6 +79,7 @@ namespace avocet::opengl {
         opengl_version m_Version{};
         bool m_DebugOutputEnabled{};
         object_labelling_available m_ObjectLabelsAvailable{};
+        bool m_DirectStateAccessAvailable{};
     public:
         context_fundamental_characteristics(opengl_version version, debugging_mode mode);
 
@@ -77,6 +91,9 @@ namespace avocet::opengl {
 
         [[nodiscard]]
         object_labelling_available object_labels_available() const noexcept { return m_ObjectLabelsAvailable; }
+
+        [[nodiscard]]
+        bool direct_state_access_available() const noexcept { return m_DirectStateAccessAvailable; }
     };
 
     class context_base {
@@ -87,6 +104,7 @@ namespace avocet::opengl {
             : m_Mode{mode}
             , m_Context{loader(GladGLContext{})}
             , m_Characteristics{get_opengl_version(), m_Mode}
+            , m_ValidateStateShadow{validates_state_shadow(m_Mode)}
         {
             init_debug();
         }
@@ -104,6 +122,16 @@ namespace avocet::opengl {
 
         [[nodiscard]]
         const context_fundamental_characteristics& fundamental_characteristics() const noexcept { return m_Characteristics; }
+
+        /// Kept up to date by gl_function and static_gl_function; mutable since the gl state
+        /// changes through a const context.
+        [[nodiscard]]
+        gl_state_shadow& state_shadow() const noexcept { return m_StateShadow; }
+
+        [[nodiscard]]
+        bool validating_state_shadow() const noexcept { return m_ValidateStateShadow; }
+
+        void validate_state_shadow(bool validate) noexcept { m_ValidateStateShadow = validate; }
     protected:
         context_base(context_base&&) noexcept = default;
 
@@ -114,6 +142,8 @@ namespace avocet::opengl {
         debugging_mode m_Mode{};
         unique_glad_context m_Context{};
         context_fundamental_characteristics m_Characteristics;
+        mutable gl_state_shadow m_StateShadow{};
+        bool m_ValidateStateShadow{};
 
         [[nodiscard]]
         opengl_version get_opengl_version() const noexcept;
@@ -121,670 +151,36 @@ namespace avocet::opengl {
         void init_debug();
     };
 
+    namespace impl {
+        template<auto PtrToMem>
+        [[nodiscard]]
+        constexpr const void* glad_ctx_member_address(const GladGLContext& ctx) noexcept { return &(ctx.*PtrToMem); }
+    }
+
     struct member_info {
+        using address_fn_type = const void*(*)(const GladGLContext&) noexcept;
+
         std::string_view name{};
         std::size_t offset{};
+        address_fn_type address{};
     };
 
-#define MAKE_GLAD_CTX_MEMBER_INFO(name) member_info{#name, offsetof(GladGLContext, name)}
+#define MAKE_GLAD_CTX_MEMBER_INFO(name) member_info{#name, offsetof(GladGLContext, name), &impl::glad_ctx_member_address<&GladGLContext::name>},
 
     inline constexpr std::array<member_info, 657> glad_ctx_member_info{
-        MAKE_GLAD_CTX_MEMBER_INFO(ActiveShaderProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(ActiveTexture),
-        MAKE_GLAD_CTX_MEMBER_INFO(AttachShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(BeginConditionalRender),
-        MAKE_GLAD_CTX_MEMBER_INFO(BeginQuery),
-        MAKE_GLAD_CTX_MEMBER_INFO(BeginQueryIndexed),
-        MAKE_GLAD_CTX_MEMBER_INFO(BeginTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindAttribLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindBufferBase),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindBuffersBase),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindBuffersRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindFragDataLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindFragDataLocationIndexed),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindFramebuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindImageTexture),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindImageTextures),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindProgramPipeline),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindRenderbuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindSampler),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindSamplers),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindTexture),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindTextureUnit),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindTextures),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindVertexArray),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindVertexBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(BindVertexBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendColor),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendEquation),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendEquationSeparate),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendEquationSeparatei),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendEquationi),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendFunc),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendFuncSeparate),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendFuncSeparatei),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlendFunci),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlitFramebuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(BlitNamedFramebuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(BufferData),
-        MAKE_GLAD_CTX_MEMBER_INFO(BufferStorage),
-        MAKE_GLAD_CTX_MEMBER_INFO(BufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(CheckFramebufferStatus),
-        MAKE_GLAD_CTX_MEMBER_INFO(CheckNamedFramebufferStatus),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClampColor),
-        MAKE_GLAD_CTX_MEMBER_INFO(Clear),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearBufferData),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearBufferfi),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearBufferfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearBufferiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearBufferuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearColor),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearDepth),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearDepthf),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearNamedBufferData),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearNamedBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearNamedFramebufferfi),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearNamedFramebufferfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearNamedFramebufferiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearNamedFramebufferuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearStencil),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearTexImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClearTexSubImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClientWaitSync),
-        MAKE_GLAD_CTX_MEMBER_INFO(ClipControl),
-        MAKE_GLAD_CTX_MEMBER_INFO(ColorMask),
-        MAKE_GLAD_CTX_MEMBER_INFO(ColorMaski),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompileShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTexImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTexImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTexImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTexSubImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTexSubImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTexSubImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTextureSubImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTextureSubImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CompressedTextureSubImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyImageSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyNamedBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTexImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTexImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTexSubImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTexSubImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTexSubImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTextureSubImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTextureSubImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CopyTextureSubImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateFramebuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateProgramPipelines),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateQueries),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateRenderbuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateSamplers),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateShaderProgramv),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateTextures),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateTransformFeedbacks),
-        MAKE_GLAD_CTX_MEMBER_INFO(CreateVertexArrays),
-        MAKE_GLAD_CTX_MEMBER_INFO(CullFace),
-        MAKE_GLAD_CTX_MEMBER_INFO(DebugMessageCallback),
-        MAKE_GLAD_CTX_MEMBER_INFO(DebugMessageControl),
-        MAKE_GLAD_CTX_MEMBER_INFO(DebugMessageInsert),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteFramebuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteProgramPipelines),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteQueries),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteRenderbuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteSamplers),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteSync),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteTextures),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteTransformFeedbacks),
-        MAKE_GLAD_CTX_MEMBER_INFO(DeleteVertexArrays),
-        MAKE_GLAD_CTX_MEMBER_INFO(DepthFunc),
-        MAKE_GLAD_CTX_MEMBER_INFO(DepthMask),
-        MAKE_GLAD_CTX_MEMBER_INFO(DepthRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(DepthRangeArrayv),
-        MAKE_GLAD_CTX_MEMBER_INFO(DepthRangeIndexed),
-        MAKE_GLAD_CTX_MEMBER_INFO(DepthRangef),
-        MAKE_GLAD_CTX_MEMBER_INFO(DetachShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(Disable),
-        MAKE_GLAD_CTX_MEMBER_INFO(DisableVertexArrayAttrib),
-        MAKE_GLAD_CTX_MEMBER_INFO(DisableVertexAttribArray),
-        MAKE_GLAD_CTX_MEMBER_INFO(Disablei),
-        MAKE_GLAD_CTX_MEMBER_INFO(DispatchCompute),
-        MAKE_GLAD_CTX_MEMBER_INFO(DispatchComputeIndirect),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawArrays),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawArraysIndirect),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawArraysInstanced),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawArraysInstancedBaseInstance),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElements),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElementsBaseVertex),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElementsIndirect),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElementsInstanced),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElementsInstancedBaseInstance),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElementsInstancedBaseVertex),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawElementsInstancedBaseVertexBaseInstance),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawRangeElements),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawRangeElementsBaseVertex),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawTransformFeedbackInstanced),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawTransformFeedbackStream),
-        MAKE_GLAD_CTX_MEMBER_INFO(DrawTransformFeedbackStreamInstanced),
-        MAKE_GLAD_CTX_MEMBER_INFO(Enable),
-        MAKE_GLAD_CTX_MEMBER_INFO(EnableVertexArrayAttrib),
-        MAKE_GLAD_CTX_MEMBER_INFO(EnableVertexAttribArray),
-        MAKE_GLAD_CTX_MEMBER_INFO(Enablei),
-        MAKE_GLAD_CTX_MEMBER_INFO(EndConditionalRender),
-        MAKE_GLAD_CTX_MEMBER_INFO(EndQuery),
-        MAKE_GLAD_CTX_MEMBER_INFO(EndQueryIndexed),
-        MAKE_GLAD_CTX_MEMBER_INFO(EndTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(FenceSync),
-        MAKE_GLAD_CTX_MEMBER_INFO(Finish),
-        MAKE_GLAD_CTX_MEMBER_INFO(Flush),
-        MAKE_GLAD_CTX_MEMBER_INFO(FlushMappedBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(FlushMappedNamedBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferRenderbuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferTexture),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferTexture1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferTexture2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferTexture3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(FramebufferTextureLayer),
-        MAKE_GLAD_CTX_MEMBER_INFO(FrontFace),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenFramebuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenProgramPipelines),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenQueries),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenRenderbuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenSamplers),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenTextures),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenTransformFeedbacks),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenVertexArrays),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenerateMipmap),
-        MAKE_GLAD_CTX_MEMBER_INFO(GenerateTextureMipmap),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveAtomicCounterBufferiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveAttrib),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveSubroutineName),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveSubroutineUniformName),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveSubroutineUniformiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveUniform),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveUniformBlockName),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveUniformBlockiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveUniformName),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetActiveUniformsiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetAttachedShaders),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetAttribLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetBooleani_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetBooleanv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetBufferParameteri64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetBufferParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetBufferPointerv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetCompressedTexImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetCompressedTextureImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetCompressedTextureSubImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetDebugMessageLog),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetDoublei_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetDoublev),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetError),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetFloati_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetFloatv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetFragDataIndex),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetFragDataLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetFramebufferAttachmentParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetFramebufferParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetGraphicsResetStatus),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetInteger64i_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetInteger64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetIntegeri_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetIntegerv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetInternalformati64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetInternalformativ),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetMultisamplefv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedBufferParameteri64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedBufferParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedBufferPointerv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedFramebufferAttachmentParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedFramebufferParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetNamedRenderbufferParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetObjectLabel),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetObjectPtrLabel),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetPointerv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramBinary),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramInfoLog),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramInterfaceiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramPipelineInfoLog),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramPipelineiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramResourceIndex),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramResourceLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramResourceLocationIndex),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramResourceName),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramResourceiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramStageiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetProgramiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryBufferObjecti64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryBufferObjectiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryBufferObjectui64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryBufferObjectuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryIndexediv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryObjecti64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryObjectiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryObjectui64v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryObjectuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetQueryiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetRenderbufferParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSamplerParameterIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSamplerParameterIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSamplerParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSamplerParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetShaderInfoLog),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetShaderPrecisionFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetShaderSource),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetShaderiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetString),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetStringi),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSubroutineIndex),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSubroutineUniformLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetSynciv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexLevelParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexLevelParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexParameterIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexParameterIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTexParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureLevelParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureLevelParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureParameterIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureParameterIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTextureSubImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTransformFeedbackVarying),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTransformFeedbacki64_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTransformFeedbacki_v),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetTransformFeedbackiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformBlockIndex),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformIndices),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformLocation),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformSubroutineuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformdv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetUniformuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexArrayIndexed64iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexArrayIndexediv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexArrayiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribLdv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribPointerv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribdv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetVertexAttribiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetnCompressedTexImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetnTexImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetnUniformdv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetnUniformfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetnUniformiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(GetnUniformuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Hint),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateBufferData),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateFramebuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateNamedFramebufferData),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateNamedFramebufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateSubFramebuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateTexImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(InvalidateTexSubImage),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsEnabled),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsEnabledi),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsFramebuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsProgramPipeline),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsQuery),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsRenderbuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsSampler),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsSync),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsTexture),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(IsVertexArray),
-        MAKE_GLAD_CTX_MEMBER_INFO(LineWidth),
-        MAKE_GLAD_CTX_MEMBER_INFO(LinkProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(LogicOp),
-        MAKE_GLAD_CTX_MEMBER_INFO(MapBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(MapBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(MapNamedBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(MapNamedBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(MemoryBarrier),
-        MAKE_GLAD_CTX_MEMBER_INFO(MemoryBarrierByRegion),
-        MAKE_GLAD_CTX_MEMBER_INFO(MinSampleShading),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawArrays),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawArraysIndirect),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawArraysIndirectCount),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawElements),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawElementsBaseVertex),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawElementsIndirect),
-        MAKE_GLAD_CTX_MEMBER_INFO(MultiDrawElementsIndirectCount),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedBufferData),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedBufferStorage),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedBufferSubData),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferDrawBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferDrawBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferReadBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferRenderbuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferTexture),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedFramebufferTextureLayer),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedRenderbufferStorage),
-        MAKE_GLAD_CTX_MEMBER_INFO(NamedRenderbufferStorageMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(ObjectLabel),
-        MAKE_GLAD_CTX_MEMBER_INFO(ObjectPtrLabel),
-        MAKE_GLAD_CTX_MEMBER_INFO(PatchParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(PatchParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(PauseTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(PixelStoref),
-        MAKE_GLAD_CTX_MEMBER_INFO(PixelStorei),
-        MAKE_GLAD_CTX_MEMBER_INFO(PointParameterf),
-        MAKE_GLAD_CTX_MEMBER_INFO(PointParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(PointParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(PointParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(PointSize),
-        MAKE_GLAD_CTX_MEMBER_INFO(PolygonMode),
-        MAKE_GLAD_CTX_MEMBER_INFO(PolygonOffset),
-        MAKE_GLAD_CTX_MEMBER_INFO(PolygonOffsetClamp),
-        MAKE_GLAD_CTX_MEMBER_INFO(PopDebugGroup),
-        MAKE_GLAD_CTX_MEMBER_INFO(PrimitiveRestartIndex),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramBinary),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1d),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1f),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1i),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform1uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2d),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2f),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2i),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform2uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3d),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3f),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3i),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform3uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4d),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4f),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4i),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniform4uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix2x3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix2x3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix2x4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix2x4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix3x2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix3x2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix3x4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix3x4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix4x2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix4x2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix4x3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProgramUniformMatrix4x3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ProvokingVertex),
-        MAKE_GLAD_CTX_MEMBER_INFO(PushDebugGroup),
-        MAKE_GLAD_CTX_MEMBER_INFO(QueryCounter),
-        MAKE_GLAD_CTX_MEMBER_INFO(ReadBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(ReadPixels),
-        MAKE_GLAD_CTX_MEMBER_INFO(ReadnPixels),
-        MAKE_GLAD_CTX_MEMBER_INFO(ReleaseShaderCompiler),
-        MAKE_GLAD_CTX_MEMBER_INFO(RenderbufferStorage),
-        MAKE_GLAD_CTX_MEMBER_INFO(RenderbufferStorageMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(ResumeTransformFeedback),
-        MAKE_GLAD_CTX_MEMBER_INFO(SampleCoverage),
-        MAKE_GLAD_CTX_MEMBER_INFO(SampleMaski),
-        MAKE_GLAD_CTX_MEMBER_INFO(SamplerParameterIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(SamplerParameterIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(SamplerParameterf),
-        MAKE_GLAD_CTX_MEMBER_INFO(SamplerParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(SamplerParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(SamplerParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Scissor),
-        MAKE_GLAD_CTX_MEMBER_INFO(ScissorArrayv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ScissorIndexed),
-        MAKE_GLAD_CTX_MEMBER_INFO(ScissorIndexedv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ShaderBinary),
-        MAKE_GLAD_CTX_MEMBER_INFO(ShaderSource),
-        MAKE_GLAD_CTX_MEMBER_INFO(ShaderStorageBlockBinding),
-        MAKE_GLAD_CTX_MEMBER_INFO(SpecializeShader),
-        MAKE_GLAD_CTX_MEMBER_INFO(StencilFunc),
-        MAKE_GLAD_CTX_MEMBER_INFO(StencilFuncSeparate),
-        MAKE_GLAD_CTX_MEMBER_INFO(StencilMask),
-        MAKE_GLAD_CTX_MEMBER_INFO(StencilMaskSeparate),
-        MAKE_GLAD_CTX_MEMBER_INFO(StencilOp),
-        MAKE_GLAD_CTX_MEMBER_INFO(StencilOpSeparate),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexImage2DMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexImage3DMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexParameterIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexParameterIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexParameterf),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexStorage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexStorage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexStorage2DMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexStorage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexStorage3DMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexSubImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexSubImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TexSubImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureBarrier),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureParameterIiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureParameterIuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureParameterf),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureParameterfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureParameteri),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureParameteriv),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureStorage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureStorage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureStorage2DMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureStorage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureStorage3DMultisample),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureSubImage1D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureSubImage2D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureSubImage3D),
-        MAKE_GLAD_CTX_MEMBER_INFO(TextureView),
-        MAKE_GLAD_CTX_MEMBER_INFO(TransformFeedbackBufferBase),
-        MAKE_GLAD_CTX_MEMBER_INFO(TransformFeedbackBufferRange),
-        MAKE_GLAD_CTX_MEMBER_INFO(TransformFeedbackVaryings),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1d),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1f),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1i),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform1uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2d),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2f),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2i),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform2uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3d),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3f),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3i),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform3uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4d),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4f),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4i),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(Uniform4uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformBlockBinding),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix2x3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix2x3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix2x4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix2x4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix3x2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix3x2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix3x4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix3x4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix4x2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix4x2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix4x3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformMatrix4x3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UniformSubroutinesuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(UnmapBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(UnmapNamedBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(UseProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(UseProgramStages),
-        MAKE_GLAD_CTX_MEMBER_INFO(ValidateProgram),
-        MAKE_GLAD_CTX_MEMBER_INFO(ValidateProgramPipeline),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayAttribBinding),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayAttribFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayAttribIFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayAttribLFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayBindingDivisor),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayElementBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayVertexBuffer),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexArrayVertexBuffers),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib1d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib1dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib1f),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib1fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib1s),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib1sv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib2d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib2f),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib2fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib2s),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib2sv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib3d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib3f),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib3fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib3s),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib3sv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Nbv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Niv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Nsv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Nub),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Nubv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Nuiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4Nusv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4bv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4f),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4fv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4s),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4sv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4ubv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttrib4usv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribBinding),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribDivisor),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI1i),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI1iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI1ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI1uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI2i),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI2iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI2ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI2uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI3i),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI3iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI3ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI3uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4bv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4i),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4iv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4sv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4ubv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribI4usv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribIFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribIPointer),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL1d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL1dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL2d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL2dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL3d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL3dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL4d),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribL4dv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribLFormat),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribLPointer),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP1ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP1uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP2ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP2uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP3ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP3uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP4ui),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribP4uiv),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexAttribPointer),
-        MAKE_GLAD_CTX_MEMBER_INFO(VertexBindingDivisor),
-        MAKE_GLAD_CTX_MEMBER_INFO(Viewport),
-        MAKE_GLAD_CTX_MEMBER_INFO(ViewportArrayv),
-        MAKE_GLAD_CTX_MEMBER_INFO(ViewportIndexedf),
-        MAKE_GLAD_CTX_MEMBER_INFO(ViewportIndexedfv),
-        MAKE_GLAD_CTX_MEMBER_INFO(WaitSync)
+        AVOCET_GLAD_CTX_MEMBERS(MAKE_GLAD_CTX_MEMBER_INFO)
     };
+
+    /// Resolves, at compile time, the position within glad_ctx_member_info of the entry point identified by PtrToMem
+    template<auto PtrToMem>
+    [[nodiscard]]
+    consteval std::size_t glad_ctx_member_index() {
+        const GladGLContext ctx{};
+        const void* const target{&(ctx.*PtrToMem)};
+
+        std::size_t index{};
+        while((index < glad_ctx_member_info.size()) && (glad_ctx_member_info[index].address(ctx) != target)) ++index;
+
+        return index;
+    }
 }
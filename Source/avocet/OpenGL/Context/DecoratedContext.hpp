@@ -7,10 +7,17 @@
 
 #pragma once
 
-#include "avocet/OpenGL/Context/Context.hpp"
+#include "avocet/OpenGL/Context/DecorationPolicy.hpp"
+
+#include "sequoia/PlatformSpecific/Preprocessor.hpp"
 
 namespace avocet::opengl {
-    class decorated_context : public context {
+    /// The prologue and epilogue are template parameters, and so are dispatched at compile time; in particular,
+    /// no_decoration compiles away entirely. The decorated_context alias is instead configured with decoration_policy,
+    /// allowing the decorators to be chosen at runtime. The rest of the context hierarchy, and therefore every
+    /// resource, is built on decorated_context alone.
+    template<class Prologue, class Epilogue>
+    class basic_decorated_context : public context {
     public:
         template<class Loader>
         constexpr static bool is_loader_v{
@@ -22,46 +29,82 @@ namespace avocet::opengl {
             std::is_invocable_r_v<void, Fn, const context&, const decorator_data&>
         };
 
-        template<class Loader, class Prologue, class Epilogue>
+        template<class Loader, class PrologueFn, class EpilogueFn>
             requires is_loader_v<Loader>
-                  && is_decorator_v<Prologue>
-                  && is_decorator_v<Epilogue>
-        decorated_context(debugging_mode mode, Loader loader, Prologue prologue, Epilogue epilogue)
+                  && is_decorator_v<PrologueFn>
+                  && is_decorator_v<EpilogueFn>
+                  && std::constructible_from<Prologue, PrologueFn>
+                  && std::constructible_from<Epilogue, EpilogueFn>
+        basic_decorated_context(debugging_mode mode, Loader loader, PrologueFn prologue, EpilogueFn epilogue)
             : context{mode, std::move(loader)}
-            , m_Prologue{std::move(prologue)}
-            , m_Epilogue{std::move(epilogue)}
+            , m_Prologue{make_decoration<Prologue>(std::move(prologue), mode)}
+            , m_Epilogue{make_decoration<Epilogue>(std::move(epilogue), mode)}
         {}
 
         template<class Fn, class... Args>
             requires (!std::is_void_v<std::invoke_result_t<Fn, Args...>>)
-        std::invoke_result_t<Fn, Args...> invoke(this const decorated_context& self, const decorator_data& data, Fn fn, Args... args) {
-            if(self.m_Prologue) self.m_Prologue(self, data);
+        std::invoke_result_t<Fn, Args...> invoke(this const basic_decorated_context& self, const decorator_data& data, Fn fn, Args... args) {
+            using result_type = std::invoke_result_t<Fn, Args...>;
+
+            self.m_Prologue(self, data);
         
             const auto res{fn(args...)};
-        
-            if(self.m_Epilogue) self.m_Epilogue(self, data);
+
+            if constexpr(observes_calls_v<result_type, Args...>)
+                self.m_Epilogue(self, data, observed_call<result_type, Args...>{res, {args...}});
+            else
+                self.m_Epilogue(self, data);
         
             return res;
         }
         
         template<class Fn, class... Args>
             requires std::is_void_v<std::invoke_result_t<Fn, Args...>>
-        void invoke(this const decorated_context& self, const decorator_data& data, Fn fn, Args... args) {
-            if(self.m_Prologue) self.m_Prologue(self, data);
+        void invoke(this const basic_decorated_context& self, const decorator_data& data, Fn fn, Args... args) {
+            self.m_Prologue(self, data);
         
             fn(args...);
-        
-            if(self.m_Epilogue) self.m_Epilogue(self, data);
+
+            if constexpr(observes_calls_v<void, Args...>)
+                self.m_Epilogue(self, data, observed_call<void, Args...>{{args...}});
+            else
+                self.m_Epilogue(self, data);
         }
     protected:
-        ~decorated_context() = default;
+        ~basic_decorated_context() = default;
 
-        decorated_context(decorated_context&&) noexcept = default;
+        basic_decorated_context(basic_decorated_context&&) noexcept = default;
 
-        decorated_context& operator=(decorated_context&&) noexcept = default;
+        basic_decorated_context& operator=(basic_decorated_context&&) noexcept = default;
     private:
-        using decorator_type = std::function<void(const context&, const decorator_data&)>;
+        SEQUOIA_NO_UNIQUE_ADDRESS Prologue m_Prologue;
+        SEQUOIA_NO_UNIQUE_ADDRESS Epilogue m_Epilogue;
 
-        decorator_type m_Prologue{}, m_Epilogue{};
+        /// An epilogue which accepts the arguments and result of each call, such as a capture_recorder,
+        /// is passed them; for any other, they are not even assembled.
+        template<class R, class... Args>
+        constexpr static bool observes_calls_v{
+            std::is_invocable_v<const Epilogue&, const context&, const decorator_data&, const observed_call<R, Args...>&>
+        };
+
+        /// A decoration_policy is told the debugging mode, so that it may discard checks which would do nothing
+        template<class Policy, class Fn>
+        [[nodiscard]]
+        static Policy make_decoration(Fn fn, debugging_mode mode) {
+            if constexpr(std::constructible_from<Policy, Fn, debugging_mode>)
+                return Policy{std::move(fn), mode};
+            else
+                return Policy{std::move(fn)};
+        }
+    };
+
+    using decorated_context = basic_decorated_context<decoration_policy, decoration_policy>;
+
+    /// For raw gl calls through decorators fixed at compile time, such as when benchmarking or capturing
+    /// a command stream. Resources, which require a resourceful_context, cannot be created from it.
+    template<class Prologue, class Epilogue>
+    class fixed_decoration_context final : public basic_decorated_context<Prologue, Epilogue> {
+    public:
+        using basic_decorated_context<Prologue, Epilogue>::basic_decorated_context;
     };
 }
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Capture/CaptureRecorder.hpp"
+#include "avocet/OpenGL/Debugging/DeferredErrorChecker.hpp"
+
+#include <concepts>
+#include <functional>
+#include <variant>
+
+namespace avocet::opengl {
+    struct no_decoration {
+        constexpr void operator()(const context&, const decorator_data&) const noexcept {}
+    };
+
+    /// Type-erased decorator which may be swapped at runtime. Intended for tooling,
+    /// since every invocation pays for an indirect call which cannot be inlined.
+    using runtime_decorator = std::function<void(const context&, const decorator_data&)>;
+
+    /// Allows decorators to be chosen at runtime, as required by the contexts used throughout the library.
+    /// The policies which the library knows about statically are dispatched without type erasure; anything
+    /// else is opted into runtime_decorator. Where the decorators are known at compile time and only raw
+    /// gl calls are required, they may instead be fixed by a fixed_decoration_context, and so bypass this.
+    class decoration_policy {
+    public:
+        using policy_type = std::variant<no_decoration, standard_error_checker<>, deferred_call_recorder, capture_recorder, runtime_decorator>;
+
+        decoration_policy() = default;
+
+        template<class Fn>
+            requires std::is_invocable_r_v<void, Fn, const context&, const decorator_data&> && (!std::same_as<Fn, decoration_policy>)
+        decoration_policy(Fn fn)
+            : m_Policy{make_policy(std::move(fn))}
+        {}
+
+        /// A standard_error_checker does nothing unless every call is checked, and so
+        /// is otherwise replaced by no_decoration, removing it from the call path entirely.
+        template<class Fn>
+            requires std::is_invocable_r_v<void, Fn, const context&, const decorator_data&>
+        decoration_policy(Fn fn, debugging_mode mode)
+            : decoration_policy{std::move(fn)}
+        {
+            if(!checks_every_call(mode) && std::holds_alternative<standard_error_checker<>>(m_Policy))
+                m_Policy = no_decoration{};
+        }
+
+        void operator()(const context& ctx, const decorator_data& data) const {
+            if(const auto* pChecker{std::get_if<standard_error_checker<>>(&m_Policy)})
+                (*pChecker)(ctx, data);
+            else if(const auto* pRecorder{std::get_if<deferred_call_recorder>(&m_Policy)})
+                (*pRecorder)(ctx, data);
+            else if(const auto* pCapture{std::get_if<capture_recorder>(&m_Policy)})
+                (*pCapture)(ctx, data);
+            else if(const auto* pErased{std::get_if<runtime_decorator>(&m_Policy)})
+                (*pErased)(ctx, data);
+        }
+
+        /// Only a capture_recorder makes use of the call itself; every other policy ignores it
+        template<class R, class... Args>
+        void operator()(const context& ctx, const decorator_data& data, const observed_call<R, Args...>& call) const {
+            if(const auto* pCapture{std::get_if<capture_recorder>(&m_Policy)})
+                (*pCapture)(ctx, data, call);
+            else
+                (*this)(ctx, data);
+        }
+
+        [[nodiscard]]
+        bool is_no_op() const noexcept { return std::holds_alternative<no_decoration>(m_Policy); }
+
+        [[nodiscard]]
+        bool is_type_erased() const noexcept { return std::holds_alternative<runtime_decorator>(m_Policy); }
+    private:
+        policy_type m_Policy{};
+
+        template<class Fn>
+        [[nodiscard]]
+        static policy_type make_policy(Fn fn) {
+            if constexpr(std::same_as<Fn, no_decoration> || std::same_as<Fn, standard_error_checker<>> || std::same_as<Fn, deferred_call_recorder> || std::same_as<Fn, capture_recorder>) {
+                return fn;
+            }
+            else {
+                if constexpr(std::constructible_from<bool, const Fn&>) {
+                    if(!static_cast<bool>(fn)) return no_decoration{};
+                }
+
+                return runtime_decorator{std::move(fn)};
+            }
+        }
+    };
+}
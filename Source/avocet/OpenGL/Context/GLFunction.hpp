@@ -8,6 +8,7 @@
 #pragma once
 
 #include "avocet/Core/Formatting/Formatting.hpp"
+#include "avocet/Core/Preprocessor/PreprocessorDefs.hpp"
 
 #include "avocet/OpenGL/Context/Context.hpp"
 
@@ -25,6 +26,23 @@ namespace avocet::opengl {
     template<class R, class... Args>
     using glad_ctx_ptr_to_mem_fn_ptr_type = function_pointer_type<R, Args...> GladGLContext::*;
 
+    namespace impl {
+        /// Skips calls which the state shadow shows to be redundant; otherwise, updates the shadow
+        /// once the call, including any decoration, has completed without throwing.
+        template<auto PtrToMem, std::derived_from<context_base> C, class Fn, class... Args>
+        void observed_invoke(const C& ctx, const decorator_data& data, Fn fn, Args... args) {
+            using observer = state_observer<PtrToMem>;
+            gl_state_shadow& shadow{ctx.state_shadow()};
+            if constexpr(requires { observer::is_redundant(shadow, args...); }) {
+                if(observer::is_redundant(shadow, args...))
+                    return;
+            }
+
+            ctx.invoke(data, fn, args...);
+            observer::update(shadow, args...);
+        }
+    }
+
     template<class R, class... Args>
     class [[nodiscard]] gl_function<R(Args...)> {
     public:
@@ -41,11 +59,35 @@ namespace avocet::opengl {
         R operator()(this const gl_function& self, const C& ctx, Args... args, std::source_location loc = std::source_location::current())
         {
             const auto [fn, name] {self.get_validated_fn_ptr(ctx, loc)};
-            return ctx.invoke({name, loc}, fn, args...);
+            if constexpr(std::is_void_v<R>) {
+                const bool observed{
+                    [&]<auto... PtrsToMem>(entry_point_list<PtrsToMem...>) {
+                        return (self.template try_observed_invoke<PtrsToMem>(ctx, {name, loc}, fn, args...) || ...);
+                    }(observed_entry_points{})
+                };
+
+                if(!observed)
+                    ctx.invoke({name, loc}, fn, args...);
+            }
+            else {
+                return ctx.invoke({name, loc}, fn, args...);
+            }
         }
     private:
         pointer_to_member_type m_PtrToMem;
 
+        template<auto PtrToMem, std::derived_from<context_base> C>
+        bool try_observed_invoke(const C& ctx, const decorator_data& data, function_pointer_type<R, Args...> fn, Args... args) const {
+            if constexpr(std::same_as<decltype(PtrToMem), pointer_to_member_type>) {
+                if(m_PtrToMem == PtrToMem) {
+                    impl::observed_invoke<PtrToMem>(ctx, data, fn, args...);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         struct named_fn_ptr {
             function_pointer_type<R, Args...> fn;
             std::string_view name;
@@ -84,4 +126,34 @@ namespace avocet::opengl {
 
     template<class R, class... Args>
     gl_function(glad_ctx_ptr_to_mem_fn_ptr_type<R, Args...>) -> gl_function<R(Args...)>;
+
+    /// Counterpart to gl_function for which the entry point is fixed at compile time.
+    /// The name is resolved during compilation and, if NDEBUG is defined, the function
+    /// pointer is not validated on each call, leaving just a single indirect call.
+    template<auto PtrToMem, class = decltype(PtrToMem)> class static_gl_function;
+
+    template<auto PtrToMem, class R, class... Args>
+    class [[nodiscard]] static_gl_function<PtrToMem, glad_ctx_ptr_to_mem_fn_ptr_type<R, Args...>> {
+    public:
+        constexpr static std::size_t index{glad_ctx_member_index<PtrToMem>()};
+        static_assert(index < glad_ctx_member_info.size(), "static_gl_function: entry point not found in glad_ctx_member_info");
+
+        constexpr static std::string_view name{glad_ctx_member_info[index].name};
+
+        template<std::derived_from<context_base> C>
+        [[nodiscard]]
+        R operator()(this const static_gl_function&, const C& ctx, Args... args, std::source_location loc = std::source_location::current())
+        {
+            const auto fn{ctx.glad_context().*PtrToMem};
+            if constexpr(!has_ndebug()) {
+                if(!fn)
+                    throw std::runtime_error{std::format("static_gl_function: attempting to invoke a null function pointer {} coming via {}", name, avocet::to_string(loc))};
+            }
+
+            if constexpr(is_observed_v<PtrToMem>)
+                impl::observed_invoke<PtrToMem>(ctx, {name, loc}, fn, args...);
+            else
+                return ctx.invoke({name, loc}, fn, args...);
+        }
+    };
 }
\ No newline at end of file
@@ -364,18 +364,41 @@ namespace avocet::opengl {
 
             return vals;
         }
+
+        /// Answers from the context's state shadow where possible, otherwise queries the driver and
+        /// records the result. If the context is validating its shadow, the driver is always queried.
+        template<class T, std::derived_from<context_base> Context, class Enum>
+            requires storage_for_gl_get_v<T> && std::is_scoped_enum_v<Enum>
+        [[nodiscard]]
+        T shadowed_get(const Context& ctx, Enum name) {
+            const auto pname{to_gl_underlying_value<GLenum>(name)};
+            if(!is_shadowed(pname))
+                return do_get<T>(ctx, name);
+
+            gl_state_shadow& shadow{ctx.state_shadow()};
+            if(const T* const shadowed{shadow.template find<T>(pname)}) {
+                if(ctx.validating_state_shadow() && (do_get<T>(ctx, name) != *shadowed))
+                    throw std::runtime_error{std::format("get: shadowed value of {:#x} is inconsistent with the driver", pname)};
+
+                return *shadowed;
+            }
+
+            const auto val{do_get<T>(ctx, name)};
+            shadow.set(pname, val);
+            return val;
+        }
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     GLboolean get(const Context& ctx, bool_names name) {
-        return impl::do_get<GLboolean>(ctx, name);
+        return impl::shadowed_get<GLboolean>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     GLint get(const Context& ctx, int_names name) {
-        return impl::do_get<GLint>(ctx, name);
+        return impl::shadowed_get<GLint>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
@@ -383,49 +406,49 @@ namespace avocet::opengl {
     GLuint get(const Context& ctx, mask_names name) {
         // Masks have no dedicated unsigned getter: GetIntegerv is the only way to query them.
         // We therefore read through the GLint path and reinterpret the bit pattern as GLuint.
-        return static_cast<GLuint>(impl::do_get<GLint>(ctx, name));
+        return static_cast<GLuint>(impl::shadowed_get<GLint>(ctx, name));
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     GLint64 get(const Context& ctx, int64_names name) {
-        return impl::do_get<GLint64>(ctx, name);
+        return impl::shadowed_get<GLint64>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     GLfloat get(const Context& ctx, float_names name) {
-        return impl::do_get<GLfloat>(ctx, name);
+        return impl::shadowed_get<GLfloat>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     std::array<GLint, 2> get(const Context& ctx, paired_int_names name) {
-        return impl::do_get<std::array<GLint, 2>>(ctx, name);
+        return impl::shadowed_get<std::array<GLint, 2>>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     std::array<GLfloat, 2> get(const Context& ctx, paired_float_names name) {
-        return impl::do_get<std::array<GLfloat, 2>>(ctx, name);
+        return impl::shadowed_get<std::array<GLfloat, 2>>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     std::array<GLboolean, 4> get(const Context& ctx, quadruple_bool_names name) {
-        return impl::do_get<std::array<GLboolean, 4>>(ctx, name);
+        return impl::shadowed_get<std::array<GLboolean, 4>>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     std::array<GLint, 4> get(const Context& ctx, quadruple_int_names name) {
-        return impl::do_get<std::array<GLint, 4>>(ctx, name);
+        return impl::shadowed_get<std::array<GLint, 4>>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
     [[nodiscard]]
     std::array<GLfloat, 4> get(const Context& ctx, quadruple_float_names name) {
-        return impl::do_get<std::array<GLfloat, 4>>(ctx, name);
+        return impl::shadowed_get<std::array<GLfloat, 4>>(ctx, name);
     }
 
     template<std::derived_from<context_base> Context>
@@ -0,0 +1,413 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <numeric>
+#include <type_traits>
+
+namespace avocet::opengl {
+    namespace {
+        thread_local null_driver* t_Current{};
+
+        [[nodiscard]]
+        constexpr std::size_t member_index(std::size_t offset) noexcept {
+            return (offset - glad_ctx_member_info.front().offset) / sizeof(void*);
+        }
+
+        [[nodiscard]]
+        GLenum binding_name(GLenum target) noexcept {
+            switch(target) {
+            case GL_ARRAY_BUFFER:              return GL_ARRAY_BUFFER_BINDING;
+            case GL_ELEMENT_ARRAY_BUFFER:      return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+            case GL_COPY_READ_BUFFER:          return GL_COPY_READ_BUFFER_BINDING;
+            case GL_COPY_WRITE_BUFFER:         return GL_COPY_WRITE_BUFFER_BINDING;
+            case GL_DISPATCH_INDIRECT_BUFFER:  return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+            case GL_DRAW_INDIRECT_BUFFER:      return GL_DRAW_INDIRECT_BUFFER_BINDING;
+            case GL_PIXEL_PACK_BUFFER:         return GL_PIXEL_PACK_BUFFER_BINDING;
+            case GL_PIXEL_UNPACK_BUFFER:       return GL_PIXEL_UNPACK_BUFFER_BINDING;
+            case GL_SHADER_STORAGE_BUFFER:     return GL_SHADER_STORAGE_BUFFER_BINDING;
+            case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+            case GL_UNIFORM_BUFFER:            return GL_UNIFORM_BUFFER_BINDING;
+            case GL_ATOMIC_COUNTER_BUFFER:     return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+            case GL_QUERY_BUFFER:              return GL_QUERY_BUFFER_BINDING;
+            case GL_TEXTURE_BUFFER:            return GL_TEXTURE_BUFFER_BINDING;
+            case GL_DRAW_FRAMEBUFFER:          return GL_DRAW_FRAMEBUFFER_BINDING;
+            case GL_READ_FRAMEBUFFER:          return GL_READ_FRAMEBUFFER_BINDING;
+            case GL_RENDERBUFFER:              return GL_RENDERBUFFER_BINDING;
+            case GL_TEXTURE_2D:                return GL_TEXTURE_BINDING_2D;
+            case GL_TEXTURE_2D_ARRAY:          return GL_TEXTURE_BINDING_2D_ARRAY;
+            case GL_TEXTURE_3D:                return GL_TEXTURE_BINDING_3D;
+            case GL_TEXTURE_CUBE_MAP:          return GL_TEXTURE_BINDING_CUBE_MAP;
+            }
+
+            return GL_NONE;
+        }
+
+        [[nodiscard]]
+        const GLubyte* to_ubyte(const char* str) noexcept { return reinterpret_cast<const GLubyte*>(str); }
+    }
+
+    /// Stubs, plus the entry points which do more than count calls
+    struct null_driver_access {
+        template<std::size_t Index, auto Behaviour, class R, class... Args>
+        static R GLAD_API_PTR stub(Args... args) {
+            null_driver* const driver{t_Current};
+            if(driver)
+                ++driver->m_Counts[Index];
+
+            if constexpr(!std::is_null_pointer_v<decltype(Behaviour)>) {
+                if(driver)
+                    return Behaviour(*driver, args...);
+            }
+
+            if constexpr(!std::is_void_v<R>)
+                return R{};
+        }
+
+        template<std::size_t Index, auto Behaviour = nullptr, class R, class... Args>
+        static void install(R(GLAD_API_PTR*& entry)(Args...)) noexcept {
+            entry = &stub<Index, Behaviour, R, Args...>;
+        }
+
+        // Names
+
+        static void gen_names(null_driver& d, GLsizei n, GLuint* names) {
+            for(GLsizei i{}; i < n; ++i) names[i] = d.m_NextName++;
+        }
+
+        static void create_targeted_names(null_driver& d, GLenum, GLsizei n, GLuint* names) { gen_names(d, n, names); }
+
+        static GLuint create_shader(null_driver& d, GLenum) { return d.m_NextName++; }
+
+        static GLuint create_program(null_driver& d) { return d.m_NextName++; }
+
+        static GLuint create_shader_program(null_driver& d, GLenum, GLsizei, const GLchar* const*) { return d.m_NextName++; }
+
+        static void delete_buffers(null_driver& d, GLsizei n, const GLuint* names) {
+            for(GLsizei i{}; i < n; ++i) d.m_Buffers.erase(names[i]);
+        }
+
+        static GLsync fence_sync(null_driver& d, GLenum, GLbitfield) { return reinterpret_cast<GLsync>(d.m_NextSync++); }
+
+        static GLenum client_wait_sync(null_driver&, GLsync, GLbitfield, GLuint64) { return GL_ALREADY_SIGNALED; }
+
+        // Queries
+
+        static const GLubyte* get_string(null_driver& d, GLenum name) {
+            switch(name) {
+            case GL_VENDOR:                   return to_ubyte("avocet");
+            case GL_RENDERER:                 return to_ubyte("Null Driver");
+            case GL_VERSION:                  return to_ubyte(d.m_VersionString.c_str());
+            case GL_SHADING_LANGUAGE_VERSION: return to_ubyte("4.60");
+            }
+
+            return nullptr;
+        }
+
+        template<class T>
+        static void get_value(null_driver& d, GLenum pname, T* data) {
+            *data = d.is_enabled(pname) ? T(1) : static_cast<T>(d.integer(pname));
+        }
+
+        static GLboolean is_enabled(null_driver& d, GLenum cap) { return d.is_enabled(cap) ? GL_TRUE : GL_FALSE; }
+
+        static void get_object_status(null_driver&, GLuint, GLenum pname, GLint* params) {
+            *params = ((pname == GL_COMPILE_STATUS) || (pname == GL_LINK_STATUS)) ? GL_TRUE : 0;
+        }
+
+        template<class T>
+        static void get_query_object(null_driver&, GLuint, GLenum pname, T* params) {
+            *params = (pname == GL_QUERY_RESULT_AVAILABLE) ? T(1) : T{};
+        }
+
+        static GLenum check_framebuffer_status(null_driver&, GLenum) { return GL_FRAMEBUFFER_COMPLETE; }
+
+        static GLenum check_named_framebuffer_status(null_driver&, GLuint, GLenum) { return GL_FRAMEBUFFER_COMPLETE; }
+
+        // State
+
+        static void enable(null_driver& d, GLenum cap) { d.m_Enabled.insert(cap); }
+
+        static void disable(null_driver& d, GLenum cap) { d.m_Enabled.erase(cap); }
+
+        static void bind(null_driver& d, GLenum target, GLuint name) {
+            if(const auto pname{binding_name(target)}; pname != GL_NONE)
+                d.m_Integers[pname] = static_cast<GLint>(name);
+        }
+
+        static void bind_indexed(null_driver& d, GLenum target, GLuint, GLuint name) { bind(d, target, name); }
+
+        static void bind_framebuffer(null_driver& d, GLenum target, GLuint name) {
+            if(target == GL_FRAMEBUFFER) {
+                bind(d, GL_DRAW_FRAMEBUFFER, name);
+                bind(d, GL_READ_FRAMEBUFFER, name);
+            }
+            else {
+                bind(d, target, name);
+            }
+        }
+
+        static void bind_vertex_array(null_driver& d, GLuint name) { d.m_Integers[GL_VERTEX_ARRAY_BINDING] = static_cast<GLint>(name); }
+
+        static void use_program(null_driver& d, GLuint name) { d.m_Integers[GL_CURRENT_PROGRAM] = static_cast<GLint>(name); }
+
+        static void active_texture(null_driver& d, GLenum unit) { d.m_Integers[GL_ACTIVE_TEXTURE] = static_cast<GLint>(unit); }
+
+        static void pixel_store(null_driver& d, GLenum pname, GLint param) { d.m_Integers[pname] = param; }
+
+        // Buffers
+
+        [[nodiscard]]
+        static std::vector<std::byte>& bound_storage(null_driver& d, GLenum target) {
+            return d.m_Buffers[static_cast<GLuint>(d.integer(binding_name(target)))];
+        }
+
+        static void allocate(std::vector<std::byte>& buffer, GLsizeiptr size, const void* data) {
+            buffer.assign(static_cast<std::size_t>(size), std::byte{});
+            if(data)
+                std::memcpy(buffer.data(), data, buffer.size());
+        }
+
+        static void write(std::vector<std::byte>& buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+            if(data && (static_cast<std::size_t>(offset + size) <= buffer.size()))
+                std::memcpy(buffer.data() + offset, data, static_cast<std::size_t>(size));
+        }
+
+        static void read(const std::vector<std::byte>& buffer, GLintptr offset, GLsizeiptr size, void* data) {
+            if(static_cast<std::size_t>(offset + size) <= buffer.size())
+                std::memcpy(data, buffer.data() + offset, static_cast<std::size_t>(size));
+        }
+
+        [[nodiscard]]
+        static void* map(std::vector<std::byte>& buffer, GLintptr offset) {
+            return static_cast<std::size_t>(offset) <= buffer.size() ? buffer.data() + offset : nullptr;
+        }
+
+        static void buffer_data(null_driver& d, GLenum target, GLsizeiptr size, const void* data, GLenum) { allocate(bound_storage(d, target), size, data); }
+
+        static void buffer_storage(null_driver& d, GLenum target, GLsizeiptr size, const void* data, GLbitfield) { allocate(bound_storage(d, target), size, data); }
+
+        static void named_buffer_data(null_driver& d, GLuint buffer, GLsizeiptr size, const void* data, GLenum) { allocate(d.m_Buffers[buffer], size, data); }
+
+        static void named_buffer_storage(null_driver& d, GLuint buffer, GLsizeiptr size, const void* data, GLbitfield) { allocate(d.m_Buffers[buffer], size, data); }
+
+        static void buffer_sub_data(null_driver& d, GLenum target, GLintptr offset, GLsizeiptr size, const void* data) { write(bound_storage(d, target), offset, size, data); }
+
+        static void named_buffer_sub_data(null_driver& d, GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) { write(d.m_Buffers[buffer], offset, size, data); }
+
+        static void copy(const std::vector<std::byte>& from, std::vector<std::byte>& to, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+            if((static_cast<std::size_t>(readOffset + size) <= from.size()) && (static_cast<std::size_t>(writeOffset + size) <= to.size()))
+                std::memmove(to.data() + writeOffset, from.data() + readOffset, static_cast<std::size_t>(size));
+        }
+
+        static void copy_buffer_sub_data(null_driver& d, GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+            copy(bound_storage(d, readTarget), bound_storage(d, writeTarget), readOffset, writeOffset, size);
+        }
+
+        static void copy_named_buffer_sub_data(null_driver& d, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+            copy(d.m_Buffers[readBuffer], d.m_Buffers[writeBuffer], readOffset, writeOffset, size);
+        }
+
+        static void get_buffer_sub_data(null_driver& d, GLenum target, GLintptr offset, GLsizeiptr size, void* data) { read(bound_storage(d, target), offset, size, data); }
+
+        static void get_named_buffer_sub_data(null_driver& d, GLuint buffer, GLintptr offset, GLsizeiptr size, void* data) { read(d.m_Buffers[buffer], offset, size, data); }
+
+        static void get_buffer_parameteriv(null_driver& d, GLenum target, GLenum pname, GLint* params) {
+            *params = (pname == GL_BUFFER_SIZE) ? static_cast<GLint>(bound_storage(d, target).size()) : 0;
+        }
+
+        static void get_named_buffer_parameteriv(null_driver& d, GLuint buffer, GLenum pname, GLint* params) {
+            *params = (pname == GL_BUFFER_SIZE) ? static_cast<GLint>(d.m_Buffers[buffer].size()) : 0;
+        }
+
+        static void* map_buffer(null_driver& d, GLenum target, GLenum) { return map(bound_storage(d, target), 0); }
+
+        static void* map_buffer_range(null_driver& d, GLenum target, GLintptr offset, GLsizeiptr, GLbitfield) { return map(bound_storage(d, target), offset); }
+
+        static void* map_named_buffer(null_driver& d, GLuint buffer, GLenum) { return map(d.m_Buffers[buffer], 0); }
+
+        static void* map_named_buffer_range(null_driver& d, GLuint buffer, GLintptr offset, GLsizeiptr, GLbitfield) { return map(d.m_Buffers[buffer], offset); }
+
+        static GLboolean unmap_buffer(null_driver&, GLenum) { return GL_TRUE; }
+
+        static GLboolean unmap_named_buffer(null_driver&, GLuint) { return GL_TRUE; }
+
+        static void fill(GladGLContext& ctx);
+    };
+
+#define AVOCET_INSTALL_NULL_STUB(name) \
+    null_driver_access::install<member_index(offsetof(GladGLContext, name))>(ctx.name);
+
+#define AVOCET_INSTALL_NULL_BEHAVIOUR(name, behaviour) \
+    null_driver_access::install<member_index(offsetof(GladGLContext, name)), behaviour>(ctx.name);
+
+    void null_driver_access::fill(GladGLContext& ctx) {
+        AVOCET_GLAD_CTX_MEMBERS(AVOCET_INSTALL_NULL_STUB)
+
+        using access = null_driver_access;
+
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenBuffers,                &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenFramebuffers,           &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenProgramPipelines,       &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenQueries,                &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenRenderbuffers,          &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenSamplers,               &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenTextures,               &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenTransformFeedbacks,     &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GenVertexArrays,           &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateBuffers,             &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateFramebuffers,        &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateProgramPipelines,    &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateRenderbuffers,       &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateSamplers,            &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateTransformFeedbacks,  &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateVertexArrays,        &access::gen_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateQueries,             &access::create_targeted_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateTextures,            &access::create_targeted_names)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateShader,              &access::create_shader)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateProgram,             &access::create_program)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CreateShaderProgramv,      &access::create_shader_program)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(DeleteBuffers,             &access::delete_buffers)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(FenceSync,                 &access::fence_sync)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(ClientWaitSync,            &access::client_wait_sync)
+
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetString,                 &access::get_string)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetBooleanv,               &access::get_value<GLboolean>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetIntegerv,               &access::get_value<GLint>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetInteger64v,             &access::get_value<GLint64>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetFloatv,                 &access::get_value<GLfloat>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetDoublev,                &access::get_value<GLdouble>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(IsEnabled,                 &access::is_enabled)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetShaderiv,               &access::get_object_status)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetProgramiv,              &access::get_object_status)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetQueryObjectiv,          &access::get_query_object<GLint>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetQueryObjectuiv,         &access::get_query_object<GLuint>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetQueryObjecti64v,        &access::get_query_object<GLint64>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetQueryObjectui64v,       &access::get_query_object<GLuint64>)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CheckFramebufferStatus,      &access::check_framebuffer_status)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CheckNamedFramebufferStatus, &access::check_named_framebuffer_status)
+
+        AVOCET_INSTALL_NULL_BEHAVIOUR(Enable,                    &access::enable)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(Disable,                   &access::disable)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BindBuffer,                &access::bind)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BindTexture,               &access::bind)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BindRenderbuffer,          &access::bind)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BindBufferBase,            &access::bind_indexed)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BindFramebuffer,           &access::bind_framebuffer)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BindVertexArray,           &access::bind_vertex_array)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(UseProgram,                &access::use_program)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(ActiveTexture,             &access::active_texture)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(PixelStorei,               &access::pixel_store)
+
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BufferData,                &access::buffer_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BufferStorage,             &access::buffer_storage)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(NamedBufferData,           &access::named_buffer_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(NamedBufferStorage,        &access::named_buffer_storage)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(BufferSubData,             &access::buffer_sub_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(NamedBufferSubData,        &access::named_buffer_sub_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CopyBufferSubData,         &access::copy_buffer_sub_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(CopyNamedBufferSubData,    &access::copy_named_buffer_sub_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetBufferSubData,          &access::get_buffer_sub_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetNamedBufferSubData,     &access::get_named_buffer_sub_data)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetBufferParameteriv,      &access::get_buffer_parameteriv)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(GetNamedBufferParameteriv, &access::get_named_buffer_parameteriv)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(MapBuffer,                 &access::map_buffer)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(MapBufferRange,            &access::map_buffer_range)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(MapNamedBuffer,            &access::map_named_buffer)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(MapNamedBufferRange,       &access::map_named_buffer_range)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(UnmapBuffer,               &access::unmap_buffer)
+        AVOCET_INSTALL_NULL_BEHAVIOUR(UnmapNamedBuffer,          &access::unmap_named_buffer)
+    }
+
+#undef AVOCET_INSTALL_NULL_BEHAVIOUR
+#undef AVOCET_INSTALL_NULL_STUB
+
+    GladGLContext null_driver_loader::operator()(GladGLContext ctx) const {
+        m_Driver->make_current();
+        null_driver_access::fill(ctx);
+
+        const auto version{m_Driver->version()};
+        const auto supports{[version](std::size_t major, std::size_t minor) { return version >= opengl_version{major, minor} ? 1 : 0; }};
+        ctx.VERSION_1_0 = supports(1, 0);
+        ctx.VERSION_1_1 = supports(1, 1);
+        ctx.VERSION_1_2 = supports(1, 2);
+        ctx.VERSION_1_3 = supports(1, 3);
+        ctx.VERSION_1_4 = supports(1, 4);
+        ctx.VERSION_1_5 = supports(1, 5);
+        ctx.VERSION_2_0 = supports(2, 0);
+        ctx.VERSION_2_1 = supports(2, 1);
+        ctx.VERSION_3_0 = supports(3, 0);
+        ctx.VERSION_3_1 = supports(3, 1);
+        ctx.VERSION_3_2 = supports(3, 2);
+        ctx.VERSION_3_3 = supports(3, 3);
+        ctx.VERSION_4_0 = supports(4, 0);
+        ctx.VERSION_4_1 = supports(4, 1);
+        ctx.VERSION_4_2 = supports(4, 2);
+        ctx.VERSION_4_3 = supports(4, 3);
+        ctx.VERSION_4_4 = supports(4, 4);
+        ctx.VERSION_4_5 = supports(4, 5);
+        ctx.VERSION_4_6 = supports(4, 6);
+
+        return ctx;
+    }
+
+    null_driver::null_driver(opengl_version version)
+        : m_Version{version}
+        , m_VersionString{std::format("{} Null Driver", version)}
+        , m_Integers{
+              {GL_MAJOR_VERSION,                        static_cast<GLint>(version.major)},
+              {GL_MINOR_VERSION,                        static_cast<GLint>(version.minor)},
+              {GL_CONTEXT_FLAGS,                        GL_CONTEXT_FLAG_DEBUG_BIT},
+              {GL_MAX_LABEL_LENGTH,                     256},
+              {GL_MAX_DEBUG_MESSAGE_LENGTH,             1024},
+              {GL_MAX_DEBUG_LOGGED_MESSAGES,            64},
+              {GL_MAX_TEXTURE_SIZE,                     16384},
+              {GL_MAX_TEXTURE_IMAGE_UNITS,              32},
+              {GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS,     192},
+              {GL_MAX_VERTEX_ATTRIBS,                   16},
+              {GL_MAX_VERTEX_ATTRIB_BINDINGS,           16},
+              {GL_MAX_UNIFORM_BUFFER_BINDINGS,          84},
+              {GL_MAX_DRAW_BUFFERS,                     8},
+              {GL_MAX_COLOR_ATTACHMENTS,                8},
+              {GL_MAX_SAMPLES,                          8},
+              {GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,      256},
+              {GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, 16},
+              {GL_MIN_MAP_BUFFER_ALIGNMENT,             64},
+              {GL_PACK_ALIGNMENT,                       4},
+              {GL_UNPACK_ALIGNMENT,                     4}
+          }
+        , m_Enabled{GL_DITHER, GL_MULTISAMPLE}
+    {}
+
+    null_driver::~null_driver() {
+        if(t_Current == this)
+            t_Current = nullptr;
+    }
+
+    void null_driver::make_current() noexcept { t_Current = this; }
+
+    [[nodiscard]]
+    std::size_t null_driver::total_calls() const noexcept {
+        return std::reduce(m_Counts.begin(), m_Counts.end());
+    }
+
+    [[nodiscard]]
+    GLint null_driver::integer(GLenum pname) const noexcept {
+        const auto found{m_Integers.find(pname)};
+        return found != m_Integers.end() ? found->second : 0;
+    }
+
+    [[nodiscard]]
+    std::span<const std::byte> null_driver::buffer_storage(GLuint buffer) const noexcept {
+        const auto found{m_Buffers.find(buffer)};
+        return found != m_Buffers.end() ? std::span<const std::byte>{found->second} : std::span<const std::byte>{};
+    }
+}
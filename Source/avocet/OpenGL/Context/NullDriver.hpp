@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Context/ContextBase.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace avocet::opengl {
+    class null_driver;
+    struct null_driver_access;
+
+    /// Loader which fills every entry point with a stub, making its driver current on the calling thread
+    class null_driver_loader {
+        null_driver* m_Driver{};
+    public:
+        explicit null_driver_loader(null_driver& driver) noexcept : m_Driver{&driver} {}
+
+        [[nodiscard]]
+        GladGLContext operator()(GladGLContext ctx) const;
+    };
+
+    /// Backend with which the engine may be run without a GPU or a window, so that its own
+    /// CPU cost is not masked by that of a real driver. Stubs do nothing beyond handing out
+    /// names, keeping a minimal shadow of the state which the engine queries, and counting
+    /// calls. Since stubs are plain function pointers, they act upon whichever null_driver
+    /// is current on the calling thread, mirroring the way in which real contexts are made current.
+    class null_driver {
+    public:
+        explicit null_driver(opengl_version version = {4, 6});
+
+        ~null_driver();
+
+        null_driver(const null_driver&)            = delete;
+        null_driver& operator=(const null_driver&) = delete;
+
+        [[nodiscard]]
+        null_driver_loader loader() noexcept { return null_driver_loader{*this}; }
+
+        void make_current() noexcept;
+
+        [[nodiscard]]
+        opengl_version version() const noexcept { return m_Version; }
+
+        template<auto PtrToMem>
+        [[nodiscard]]
+        std::size_t num_calls() const noexcept { return m_Counts[glad_ctx_member_index<PtrToMem>()]; }
+
+        [[nodiscard]]
+        std::size_t total_calls() const noexcept;
+
+        void reset_call_counts() noexcept { m_Counts = {}; }
+
+        /// Overrides the value reported for pname by the integer getters, for example to emulate the limits of a particular device
+        void set_integer(GLenum pname, GLint value) { m_Integers[pname] = value; }
+
+        [[nodiscard]]
+        GLint integer(GLenum pname) const noexcept;
+
+        [[nodiscard]]
+        bool is_enabled(GLenum cap) const noexcept { return m_Enabled.contains(cap); }
+
+        [[nodiscard]]
+        std::span<const std::byte> buffer_storage(GLuint buffer) const noexcept;
+    private:
+        friend null_driver_access;
+
+        opengl_version m_Version{};
+        std::string m_VersionString{};
+        std::array<std::size_t, glad_ctx_member_info.size()> m_Counts{};
+        GLuint m_NextName{1};
+        std::uintptr_t m_NextSync{1};
+        std::unordered_map<GLenum, GLint> m_Integers{};
+        std::unordered_set<GLenum> m_Enabled{};
+        std::unordered_map<GLuint, std::vector<std::byte>> m_Buffers{};
+    };
+}
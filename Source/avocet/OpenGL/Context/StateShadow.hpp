@@ -0,0 +1,1217 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <variant>
+
+#include "glad/gl.h"
+
+namespace avocet::opengl {
+    using shadow_value
+        = std::variant<
+              GLboolean,
+              GLint,
+              GLint64,
+              GLfloat,
+              std::array<GLint, 2>,
+              std::array<GLfloat, 2>,
+              std::array<GLboolean, 4>,
+              std::array<GLint, 4>,
+              std::array<GLfloat, 4>
+          >;
+
+    /// A cache of gl state, populated lazily: values are either recorded when first queried
+    /// from the driver, or when set via an observed entry point. Anything which an observed
+    /// call may change, but in a way which is not modelled, is invalidated.
+    class gl_state_shadow {
+    public:
+        template<class T>
+        [[nodiscard]]
+        const T* find(GLenum pname) const noexcept {
+            const auto found{m_Values.find(pname)};
+            return found != m_Values.end() ? std::get_if<T>(&found->second) : nullptr;
+        }
+
+        template<class T>
+        [[nodiscard]]
+        bool holds(GLenum pname, const T& value) const noexcept {
+            const T* const current{find<T>(pname)};
+            return current && (*current == value);
+        }
+
+        template<class T>
+        void set(GLenum pname, const T& value) { m_Values.insert_or_assign(pname, shadow_value{value}); }
+
+        void invalidate(GLenum pname) noexcept { m_Values.erase(pname); }
+
+        void invalidate(std::span<const GLenum> pnames) noexcept {
+            for(auto pname : pnames) invalidate(pname);
+        }
+
+        void clear() noexcept { m_Values.clear(); }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept { return m_Values.size(); }
+    private:
+        std::unordered_map<GLenum, shadow_value> m_Values{};
+    };
+
+    namespace impl {
+        inline constexpr std::array buffer_binding_names{
+            GLenum{GL_ARRAY_BUFFER_BINDING},
+            GLenum{GL_ATOMIC_COUNTER_BUFFER_BINDING},
+            GLenum{GL_COPY_READ_BUFFER_BINDING},
+            GLenum{GL_COPY_WRITE_BUFFER_BINDING},
+            GLenum{GL_DISPATCH_INDIRECT_BUFFER_BINDING},
+            GLenum{GL_DRAW_INDIRECT_BUFFER_BINDING},
+            GLenum{GL_ELEMENT_ARRAY_BUFFER_BINDING},
+            GLenum{GL_PIXEL_PACK_BUFFER_BINDING},
+            GLenum{GL_PIXEL_UNPACK_BUFFER_BINDING},
+            GLenum{GL_QUERY_BUFFER_BINDING},
+            GLenum{GL_SHADER_STORAGE_BUFFER_BINDING},
+            GLenum{GL_TEXTURE_BUFFER_BINDING},
+            GLenum{GL_TRANSFORM_FEEDBACK_BUFFER_BINDING},
+            GLenum{GL_UNIFORM_BUFFER_BINDING}
+        };
+
+        inline constexpr std::array texture_binding_names{
+            GLenum{GL_TEXTURE_BINDING_1D},
+            GLenum{GL_TEXTURE_BINDING_1D_ARRAY},
+            GLenum{GL_TEXTURE_BINDING_2D},
+            GLenum{GL_TEXTURE_BINDING_2D_ARRAY},
+            GLenum{GL_TEXTURE_BINDING_2D_MULTISAMPLE},
+            GLenum{GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY},
+            GLenum{GL_TEXTURE_BINDING_3D},
+            GLenum{GL_TEXTURE_BINDING_BUFFER},
+            GLenum{GL_TEXTURE_BINDING_CUBE_MAP},
+            GLenum{GL_TEXTURE_BINDING_CUBE_MAP_ARRAY},
+            GLenum{GL_TEXTURE_BINDING_RECTANGLE}
+        };
+
+        inline constexpr std::array framebuffer_binding_names{GLenum{GL_DRAW_FRAMEBUFFER_BINDING}, GLenum{GL_READ_FRAMEBUFFER_BINDING}};
+
+        inline constexpr std::array blend_names{
+            GLenum{GL_BLEND_SRC_RGB},
+            GLenum{GL_BLEND_DST_RGB},
+            GLenum{GL_BLEND_SRC_ALPHA},
+            GLenum{GL_BLEND_DST_ALPHA},
+            GLenum{GL_BLEND_EQUATION_RGB},
+            GLenum{GL_BLEND_EQUATION_ALPHA}
+        };
+
+        [[nodiscard]]
+        constexpr GLenum buffer_binding_name(GLenum target) noexcept {
+            switch(target) {
+            case GL_ARRAY_BUFFER:              return GL_ARRAY_BUFFER_BINDING;
+            case GL_ATOMIC_COUNTER_BUFFER:     return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+            case GL_COPY_READ_BUFFER:          return GL_COPY_READ_BUFFER_BINDING;
+            case GL_COPY_WRITE_BUFFER:         return GL_COPY_WRITE_BUFFER_BINDING;
+            case GL_DISPATCH_INDIRECT_BUFFER:  return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+            case GL_DRAW_INDIRECT_BUFFER:      return GL_DRAW_INDIRECT_BUFFER_BINDING;
+            case GL_ELEMENT_ARRAY_BUFFER:      return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+            case GL_PIXEL_PACK_BUFFER:         return GL_PIXEL_PACK_BUFFER_BINDING;
+            case GL_PIXEL_UNPACK_BUFFER:       return GL_PIXEL_UNPACK_BUFFER_BINDING;
+            case GL_QUERY_BUFFER:              return GL_QUERY_BUFFER_BINDING;
+            case GL_SHADER_STORAGE_BUFFER:     return GL_SHADER_STORAGE_BUFFER_BINDING;
+            case GL_TEXTURE_BUFFER:            return GL_TEXTURE_BUFFER_BINDING;
+            case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+            case GL_UNIFORM_BUFFER:            return GL_UNIFORM_BUFFER_BINDING;
+            }
+
+            return GL_NONE;
+        }
+
+        [[nodiscard]]
+        constexpr GLenum texture_binding_name(GLenum target) noexcept {
+            switch(target) {
+            case GL_TEXTURE_1D:                   return GL_TEXTURE_BINDING_1D;
+            case GL_TEXTURE_1D_ARRAY:             return GL_TEXTURE_BINDING_1D_ARRAY;
+            case GL_TEXTURE_2D:                   return GL_TEXTURE_BINDING_2D;
+            case GL_TEXTURE_2D_ARRAY:             return GL_TEXTURE_BINDING_2D_ARRAY;
+            case GL_TEXTURE_2D_MULTISAMPLE:       return GL_TEXTURE_BINDING_2D_MULTISAMPLE;
+            case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY;
+            case GL_TEXTURE_3D:                   return GL_TEXTURE_BINDING_3D;
+            case GL_TEXTURE_BUFFER:               return GL_TEXTURE_BINDING_BUFFER;
+            case GL_TEXTURE_CUBE_MAP:             return GL_TEXTURE_BINDING_CUBE_MAP;
+            case GL_TEXTURE_CUBE_MAP_ARRAY:       return GL_TEXTURE_BINDING_CUBE_MAP_ARRAY;
+            case GL_TEXTURE_RECTANGLE:            return GL_TEXTURE_BINDING_RECTANGLE;
+            }
+
+            return GL_NONE;
+        }
+
+        [[nodiscard]]
+        constexpr bool is_boolean_pixel_store(GLenum pname) noexcept {
+            return (pname == GL_PACK_SWAP_BYTES) || (pname == GL_PACK_LSB_FIRST) || (pname == GL_UNPACK_SWAP_BYTES) || (pname == GL_UNPACK_LSB_FIRST);
+        }
+
+        [[nodiscard]]
+        constexpr GLboolean to_gl_boolean(bool b) noexcept { return b ? GL_TRUE : GL_FALSE; }
+
+        [[nodiscard]]
+        constexpr GLfloat to_unit_interval(GLdouble x) noexcept { return static_cast<GLfloat>(std::clamp(x, 0.0, 1.0)); }
+
+        /// Applies f to the faces selected by a glStencil*Separate face argument
+        template<class Fn>
+        void for_each_stencil_face(GLenum face, Fn f) {
+            if(face != GL_BACK)  f(false);
+            if(face != GL_FRONT) f(true);
+        }
+
+        [[nodiscard]]
+        constexpr bool is_implementation_constant(GLenum pname) noexcept {
+            switch(pname) {
+            case GL_ALIASED_LINE_WIDTH_RANGE:
+            case GL_CONTEXT_FLAGS:
+            case GL_DOUBLEBUFFER:
+            case GL_LINE_WIDTH_GRANULARITY:
+            case GL_MAJOR_VERSION:
+            case GL_MAX_3D_TEXTURE_SIZE:
+            case GL_MAX_ARRAY_TEXTURE_LAYERS:
+            case GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS:
+            case GL_MAX_COLOR_ATTACHMENTS:
+            case GL_MAX_COLOR_TEXTURE_SAMPLES:
+            case GL_MAX_COMBINED_ATOMIC_COUNTERS:
+            case GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS:
+            case GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS:
+            case GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS:
+            case GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_COMBINED_TESS_CONTROL_UNIFORM_COMPONENTS:
+            case GL_MAX_COMBINED_TESS_EVALUATION_UNIFORM_COMPONENTS:
+            case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_COMBINED_UNIFORM_BLOCKS:
+            case GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS:
+            case GL_MAX_COMPUTE_ATOMIC_COUNTERS:
+            case GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS:
+            case GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_COMPUTE_UNIFORM_BLOCKS:
+            case GL_MAX_COMPUTE_UNIFORM_COMPONENTS:
+            case GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS:
+            case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
+            case GL_MAX_DEBUG_GROUP_STACK_DEPTH:
+            case GL_MAX_DEBUG_LOGGED_MESSAGES:
+            case GL_MAX_DEBUG_MESSAGE_LENGTH:
+            case GL_MAX_DEPTH_TEXTURE_SAMPLES:
+            case GL_MAX_DRAW_BUFFERS:
+            case GL_MAX_DUAL_SOURCE_DRAW_BUFFERS:
+            case GL_MAX_ELEMENTS_INDICES:
+            case GL_MAX_ELEMENTS_VERTICES:
+            case GL_MAX_ELEMENT_INDEX:
+            case GL_MAX_FRAGMENT_ATOMIC_COUNTERS:
+            case GL_MAX_FRAGMENT_INPUT_COMPONENTS:
+            case GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_FRAGMENT_UNIFORM_BLOCKS:
+            case GL_MAX_FRAGMENT_UNIFORM_COMPONENTS:
+            case GL_MAX_FRAGMENT_UNIFORM_VECTORS:
+            case GL_MAX_FRAMEBUFFER_HEIGHT:
+            case GL_MAX_FRAMEBUFFER_LAYERS:
+            case GL_MAX_FRAMEBUFFER_SAMPLES:
+            case GL_MAX_FRAMEBUFFER_WIDTH:
+            case GL_MAX_GEOMETRY_ATOMIC_COUNTERS:
+            case GL_MAX_GEOMETRY_INPUT_COMPONENTS:
+            case GL_MAX_GEOMETRY_OUTPUT_COMPONENTS:
+            case GL_MAX_GEOMETRY_OUTPUT_VERTICES:
+            case GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_GEOMETRY_UNIFORM_BLOCKS:
+            case GL_MAX_GEOMETRY_UNIFORM_COMPONENTS:
+            case GL_MAX_INTEGER_SAMPLES:
+            case GL_MAX_LABEL_LENGTH:
+            case GL_MAX_PROGRAM_TEXEL_OFFSET:
+            case GL_MAX_RECTANGLE_TEXTURE_SIZE:
+            case GL_MAX_RENDERBUFFER_SIZE:
+            case GL_MAX_SAMPLE_MASK_WORDS:
+            case GL_MAX_SERVER_WAIT_TIMEOUT:
+            case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS:
+            case GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS:
+            case GL_MAX_TESS_CONTROL_INPUT_COMPONENTS:
+            case GL_MAX_TESS_CONTROL_OUTPUT_COMPONENTS:
+            case GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_TESS_CONTROL_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_TESS_CONTROL_UNIFORM_BLOCKS:
+            case GL_MAX_TESS_CONTROL_UNIFORM_COMPONENTS:
+            case GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS:
+            case GL_MAX_TESS_EVALUATION_INPUT_COMPONENTS:
+            case GL_MAX_TESS_EVALUATION_OUTPUT_COMPONENTS:
+            case GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_TESS_EVALUATION_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_TESS_EVALUATION_UNIFORM_BLOCKS:
+            case GL_MAX_TESS_EVALUATION_UNIFORM_COMPONENTS:
+            case GL_MAX_TESS_GEN_LEVEL:
+            case GL_MAX_TESS_PATCH_COMPONENTS:
+            case GL_MAX_TEXTURE_BUFFER_SIZE:
+            case GL_MAX_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_TEXTURE_LOD_BIAS:
+            case GL_MAX_TEXTURE_SIZE:
+            case GL_MAX_UNIFORM_BLOCK_SIZE:
+            case GL_MAX_UNIFORM_BUFFER_BINDINGS:
+            case GL_MAX_UNIFORM_LOCATIONS:
+            case GL_MAX_VARYING_COMPONENTS:
+            case GL_MAX_VARYING_VECTORS:
+            case GL_MAX_VERTEX_ATOMIC_COUNTERS:
+            case GL_MAX_VERTEX_ATTRIBS:
+            case GL_MAX_VERTEX_ATTRIB_BINDINGS:
+            case GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET:
+            case GL_MAX_VERTEX_OUTPUT_COMPONENTS:
+            case GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS:
+            case GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS:
+            case GL_MAX_VERTEX_UNIFORM_BLOCKS:
+            case GL_MAX_VERTEX_UNIFORM_COMPONENTS:
+            case GL_MAX_VERTEX_UNIFORM_VECTORS:
+            case GL_MAX_VIEWPORT_DIMS:
+            case GL_MINOR_VERSION:
+            case GL_MIN_FRAGMENT_INTERPOLATION_OFFSET:
+            case GL_MIN_MAP_BUFFER_ALIGNMENT:
+            case GL_MIN_PROGRAM_TEXEL_OFFSET:
+            case GL_NUM_COMPRESSED_TEXTURE_FORMATS:
+            case GL_NUM_EXTENSIONS:
+            case GL_NUM_PROGRAM_BINARY_FORMATS:
+            case GL_NUM_SHADER_BINARY_FORMATS:
+            case GL_POINT_SIZE_GRANULARITY:
+            case GL_POINT_SIZE_RANGE:
+            case GL_SHADER_COMPILER:
+            case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT:
+            case GL_SMOOTH_LINE_WIDTH_RANGE:
+            case GL_STEREO:
+            case GL_SUBPIXEL_BITS:
+            case GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT:
+            case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+            case GL_VIEWPORT_BOUNDS_RANGE:
+                return true;
+            }
+
+            return false;
+        }
+
+        /// State which only ever changes via one of the observed entry points
+        [[nodiscard]]
+        constexpr bool is_observed_state(GLenum pname) noexcept {
+            switch(pname) {
+            // Capabilities
+            case GL_BLEND:
+            case GL_COLOR_LOGIC_OP:
+            case GL_CULL_FACE:
+            case GL_DEBUG_OUTPUT:
+            case GL_DEBUG_OUTPUT_SYNCHRONOUS:
+            case GL_DEPTH_CLAMP:
+            case GL_DEPTH_TEST:
+            case GL_DITHER:
+            case GL_FRAMEBUFFER_SRGB:
+            case GL_LINE_SMOOTH:
+            case GL_MULTISAMPLE:
+            case GL_POLYGON_OFFSET_FILL:
+            case GL_POLYGON_OFFSET_LINE:
+            case GL_POLYGON_OFFSET_POINT:
+            case GL_POLYGON_SMOOTH:
+            case GL_PRIMITIVE_RESTART:
+            case GL_PRIMITIVE_RESTART_FIXED_INDEX:
+            case GL_PROGRAM_POINT_SIZE:
+            case GL_RASTERIZER_DISCARD:
+            case GL_SAMPLE_ALPHA_TO_COVERAGE:
+            case GL_SAMPLE_ALPHA_TO_ONE:
+            case GL_SAMPLE_COVERAGE:
+            case GL_SAMPLE_MASK:
+            case GL_SAMPLE_SHADING:
+            case GL_SCISSOR_TEST:
+            case GL_STENCIL_TEST:
+            case GL_TEXTURE_CUBE_MAP_SEAMLESS:
+            // Hints
+            case GL_FRAGMENT_SHADER_DERIVATIVE_HINT:
+            case GL_LINE_SMOOTH_HINT:
+            case GL_POLYGON_SMOOTH_HINT:
+            case GL_TEXTURE_COMPRESSION_HINT:
+            // Pixel storage
+            case GL_PACK_ALIGNMENT:
+            case GL_PACK_COMPRESSED_BLOCK_DEPTH:
+            case GL_PACK_COMPRESSED_BLOCK_HEIGHT:
+            case GL_PACK_COMPRESSED_BLOCK_SIZE:
+            case GL_PACK_COMPRESSED_BLOCK_WIDTH:
+            case GL_PACK_IMAGE_HEIGHT:
+            case GL_PACK_LSB_FIRST:
+            case GL_PACK_ROW_LENGTH:
+            case GL_PACK_SKIP_IMAGES:
+            case GL_PACK_SKIP_PIXELS:
+            case GL_PACK_SKIP_ROWS:
+            case GL_PACK_SWAP_BYTES:
+            case GL_UNPACK_ALIGNMENT:
+            case GL_UNPACK_COMPRESSED_BLOCK_DEPTH:
+            case GL_UNPACK_COMPRESSED_BLOCK_HEIGHT:
+            case GL_UNPACK_COMPRESSED_BLOCK_SIZE:
+            case GL_UNPACK_COMPRESSED_BLOCK_WIDTH:
+            case GL_UNPACK_IMAGE_HEIGHT:
+            case GL_UNPACK_LSB_FIRST:
+            case GL_UNPACK_ROW_LENGTH:
+            case GL_UNPACK_SKIP_IMAGES:
+            case GL_UNPACK_SKIP_PIXELS:
+            case GL_UNPACK_SKIP_ROWS:
+            case GL_UNPACK_SWAP_BYTES:
+            // Everything else
+            case GL_ACTIVE_TEXTURE:
+            case GL_BLEND_COLOR:
+            case GL_CLIP_DEPTH_MODE:
+            case GL_CLIP_ORIGIN:
+            case GL_COLOR_CLEAR_VALUE:
+            case GL_COLOR_WRITEMASK:
+            case GL_CULL_FACE_MODE:
+            case GL_CURRENT_PROGRAM:
+            case GL_DEPTH_CLEAR_VALUE:
+            case GL_DEPTH_FUNC:
+            case GL_DEPTH_RANGE:
+            case GL_DEPTH_WRITEMASK:
+            case GL_FRONT_FACE:
+            case GL_LINE_WIDTH:
+            case GL_LOGIC_OP_MODE:
+            case GL_MIN_SAMPLE_SHADING_VALUE:
+            case GL_PATCH_VERTICES:
+            case GL_POINT_FADE_THRESHOLD_SIZE:
+            case GL_POINT_SIZE:
+            case GL_POINT_SPRITE_COORD_ORIGIN:
+            case GL_POLYGON_OFFSET_CLAMP:
+            case GL_POLYGON_OFFSET_FACTOR:
+            case GL_POLYGON_OFFSET_UNITS:
+            case GL_PRIMITIVE_RESTART_INDEX:
+            case GL_PROGRAM_PIPELINE_BINDING:
+            case GL_PROVOKING_VERTEX:
+            case GL_RENDERBUFFER_BINDING:
+            case GL_SAMPLER_BINDING:
+            case GL_SAMPLE_COVERAGE_INVERT:
+            case GL_SAMPLE_COVERAGE_VALUE:
+            case GL_SCISSOR_BOX:
+            case GL_STENCIL_BACK_FAIL:
+            case GL_STENCIL_BACK_FUNC:
+            case GL_STENCIL_BACK_PASS_DEPTH_FAIL:
+            case GL_STENCIL_BACK_PASS_DEPTH_PASS:
+            case GL_STENCIL_BACK_REF:
+            case GL_STENCIL_BACK_VALUE_MASK:
+            case GL_STENCIL_BACK_WRITEMASK:
+            case GL_STENCIL_CLEAR_VALUE:
+            case GL_STENCIL_FAIL:
+            case GL_STENCIL_FUNC:
+            case GL_STENCIL_PASS_DEPTH_FAIL:
+            case GL_STENCIL_PASS_DEPTH_PASS:
+            case GL_STENCIL_REF:
+            case GL_STENCIL_VALUE_MASK:
+            case GL_STENCIL_WRITEMASK:
+            case GL_VERTEX_ARRAY_BINDING:
+            case GL_VIEWPORT:
+                return true;
+            }
+
+            return std::ranges::contains(buffer_binding_names, pname)
+                || std::ranges::contains(texture_binding_names, pname)
+                || std::ranges::contains(framebuffer_binding_names, pname)
+                || std::ranges::contains(blend_names, pname);
+        }
+    }
+
+    /// Only implementation constants and state kept up to date by the state_observers are shadowed.
+    /// Everything else, including state which depends on an index or on the bound framebuffer,
+    /// is always queried from the driver.
+    [[nodiscard]]
+    constexpr bool is_shadowed(GLenum pname) noexcept {
+        return impl::is_implementation_constant(pname) || impl::is_observed_state(pname);
+    }
+
+    /// Entry points which modify shadowed state are given specializations with a static update
+    /// function, invoked after each successful call, and optionally with an is_redundant
+    /// function, in which case calls which would not change the shadowed state are skipped.
+    /// Any entry point so specialized must also be added to observed_entry_points.
+    template<auto PtrToMem>
+    struct state_observer {};
+
+    template<auto PtrToMem>
+    inline constexpr bool is_observed_v{requires { &state_observer<PtrToMem>::update; }};
+
+    // Capabilities
+
+    template<>
+    struct state_observer<&GladGLContext::Enable> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum cap) noexcept { return s.holds(cap, GLboolean{GL_TRUE}); }
+
+        static void update(gl_state_shadow& s, GLenum cap) { s.set(cap, GLboolean{GL_TRUE}); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::Disable> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum cap) noexcept { return s.holds(cap, GLboolean{GL_FALSE}); }
+
+        static void update(gl_state_shadow& s, GLenum cap) { s.set(cap, GLboolean{GL_FALSE}); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::Enablei> {
+        static void update(gl_state_shadow& s, GLenum cap, GLuint) noexcept { s.invalidate(cap); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::Disablei> {
+        static void update(gl_state_shadow& s, GLenum cap, GLuint) noexcept { s.invalidate(cap); }
+    };
+
+    // Bindings
+
+    template<>
+    struct state_observer<&GladGLContext::UseProgram> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLuint program) noexcept { return s.holds(GL_CURRENT_PROGRAM, static_cast<GLint>(program)); }
+
+        static void update(gl_state_shadow& s, GLuint program) { s.set(GL_CURRENT_PROGRAM, static_cast<GLint>(program)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindProgramPipeline> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLuint pipeline) noexcept { return s.holds(GL_PROGRAM_PIPELINE_BINDING, static_cast<GLint>(pipeline)); }
+
+        static void update(gl_state_shadow& s, GLuint pipeline) { s.set(GL_PROGRAM_PIPELINE_BINDING, static_cast<GLint>(pipeline)); }
+    };
+
+    /// The element array buffer binding is part of the vertex array's state
+    template<>
+    struct state_observer<&GladGLContext::BindVertexArray> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLuint vao) noexcept { return s.holds(GL_VERTEX_ARRAY_BINDING, static_cast<GLint>(vao)); }
+
+        static void update(gl_state_shadow& s, GLuint vao) {
+            s.set(GL_VERTEX_ARRAY_BINDING, static_cast<GLint>(vao));
+            s.invalidate(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+        }
+    };
+
+    /// The vertex array need not be the bound one
+    template<>
+    struct state_observer<&GladGLContext::VertexArrayElementBuffer> {
+        static void update(gl_state_shadow& s, GLuint, GLuint) noexcept { s.invalidate(GL_ELEMENT_ARRAY_BUFFER_BINDING); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindBuffer> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum target, GLuint buffer) noexcept {
+            const auto pname{impl::buffer_binding_name(target)};
+            return (pname != GL_NONE) && s.holds(pname, static_cast<GLint>(buffer));
+        }
+
+        static void update(gl_state_shadow& s, GLenum target, GLuint buffer) {
+            if(const auto pname{impl::buffer_binding_name(target)}; pname != GL_NONE)
+                s.set(pname, static_cast<GLint>(buffer));
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindBufferBase> {
+        static void update(gl_state_shadow& s, GLenum target, GLuint, GLuint buffer) {
+            state_observer<&GladGLContext::BindBuffer>::update(s, target, buffer);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindBufferRange> {
+        static void update(gl_state_shadow& s, GLenum target, GLuint, GLuint buffer, GLintptr, GLsizeiptr) {
+            state_observer<&GladGLContext::BindBuffer>::update(s, target, buffer);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindFramebuffer> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum target, GLuint framebuffer) noexcept {
+            const auto fb{static_cast<GLint>(framebuffer)};
+            switch(target) {
+            case GL_FRAMEBUFFER:      return s.holds(GL_DRAW_FRAMEBUFFER_BINDING, fb) && s.holds(GL_READ_FRAMEBUFFER_BINDING, fb);
+            case GL_DRAW_FRAMEBUFFER: return s.holds(GL_DRAW_FRAMEBUFFER_BINDING, fb);
+            case GL_READ_FRAMEBUFFER: return s.holds(GL_READ_FRAMEBUFFER_BINDING, fb);
+            }
+
+            return false;
+        }
+
+        static void update(gl_state_shadow& s, GLenum target, GLuint framebuffer) {
+            const auto fb{static_cast<GLint>(framebuffer)};
+            if(target != GL_READ_FRAMEBUFFER) s.set(GL_DRAW_FRAMEBUFFER_BINDING, fb);
+            if(target != GL_DRAW_FRAMEBUFFER) s.set(GL_READ_FRAMEBUFFER_BINDING, fb);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindRenderbuffer> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum, GLuint renderbuffer) noexcept { return s.holds(GL_RENDERBUFFER_BINDING, static_cast<GLint>(renderbuffer)); }
+
+        static void update(gl_state_shadow& s, GLenum, GLuint renderbuffer) { s.set(GL_RENDERBUFFER_BINDING, static_cast<GLint>(renderbuffer)); }
+    };
+
+    /// Texture and sampler bindings are shadowed only for the active texture unit
+    template<>
+    struct state_observer<&GladGLContext::ActiveTexture> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum unit) noexcept { return s.holds(GL_ACTIVE_TEXTURE, static_cast<GLint>(unit)); }
+
+        static void update(gl_state_shadow& s, GLenum unit) {
+            s.set(GL_ACTIVE_TEXTURE, static_cast<GLint>(unit));
+            s.invalidate(impl::texture_binding_names);
+            s.invalidate(GL_SAMPLER_BINDING);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindTexture> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum target, GLuint texture) noexcept {
+            const auto pname{impl::texture_binding_name(target)};
+            return (pname != GL_NONE) && s.holds(pname, static_cast<GLint>(texture));
+        }
+
+        static void update(gl_state_shadow& s, GLenum target, GLuint texture) {
+            if(const auto pname{impl::texture_binding_name(target)}; pname != GL_NONE)
+                s.set(pname, static_cast<GLint>(texture));
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindTextureUnit> {
+        static void update(gl_state_shadow& s, GLuint, GLuint) noexcept { s.invalidate(impl::texture_binding_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindTextures> {
+        static void update(gl_state_shadow& s, GLuint, GLsizei, const GLuint*) noexcept { s.invalidate(impl::texture_binding_names); }
+    };
+
+    /// Samplers are bound to an explicit unit, which need not be the active one
+    template<>
+    struct state_observer<&GladGLContext::BindSampler> {
+        static void update(gl_state_shadow& s, GLuint, GLuint) noexcept { s.invalidate(GL_SAMPLER_BINDING); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindSamplers> {
+        static void update(gl_state_shadow& s, GLuint, GLsizei, const GLuint*) noexcept { s.invalidate(GL_SAMPLER_BINDING); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BindTransformFeedback> {
+        static void update(gl_state_shadow& s, GLenum, GLuint) noexcept { s.invalidate(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING); }
+    };
+
+    // Deletion of bound objects reverts the binding to zero
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteBuffers> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept { s.invalidate(impl::buffer_binding_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteTextures> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept { s.invalidate(impl::texture_binding_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteVertexArrays> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept {
+            s.invalidate(GL_VERTEX_ARRAY_BINDING);
+            s.invalidate(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteFramebuffers> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept { s.invalidate(impl::framebuffer_binding_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteRenderbuffers> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept { s.invalidate(GL_RENDERBUFFER_BINDING); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteProgramPipelines> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept { s.invalidate(GL_PROGRAM_PIPELINE_BINDING); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DeleteSamplers> {
+        static void update(gl_state_shadow& s, GLsizei, const GLuint*) noexcept { s.invalidate(GL_SAMPLER_BINDING); }
+    };
+
+    // Blending
+
+    template<>
+    struct state_observer<&GladGLContext::BlendFuncSeparate> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) noexcept {
+            return s.holds(GL_BLEND_SRC_RGB,   static_cast<GLint>(srcRGB))
+                && s.holds(GL_BLEND_DST_RGB,   static_cast<GLint>(dstRGB))
+                && s.holds(GL_BLEND_SRC_ALPHA, static_cast<GLint>(srcAlpha))
+                && s.holds(GL_BLEND_DST_ALPHA, static_cast<GLint>(dstAlpha));
+        }
+
+        static void update(gl_state_shadow& s, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+            s.set(GL_BLEND_SRC_RGB,   static_cast<GLint>(srcRGB));
+            s.set(GL_BLEND_DST_RGB,   static_cast<GLint>(dstRGB));
+            s.set(GL_BLEND_SRC_ALPHA, static_cast<GLint>(srcAlpha));
+            s.set(GL_BLEND_DST_ALPHA, static_cast<GLint>(dstAlpha));
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendFunc> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum src, GLenum dst) noexcept {
+            return state_observer<&GladGLContext::BlendFuncSeparate>::is_redundant(s, src, dst, src, dst);
+        }
+
+        static void update(gl_state_shadow& s, GLenum src, GLenum dst) {
+            state_observer<&GladGLContext::BlendFuncSeparate>::update(s, src, dst, src, dst);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendEquationSeparate> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum modeRGB, GLenum modeAlpha) noexcept {
+            return s.holds(GL_BLEND_EQUATION_RGB, static_cast<GLint>(modeRGB)) && s.holds(GL_BLEND_EQUATION_ALPHA, static_cast<GLint>(modeAlpha));
+        }
+
+        static void update(gl_state_shadow& s, GLenum modeRGB, GLenum modeAlpha) {
+            s.set(GL_BLEND_EQUATION_RGB,   static_cast<GLint>(modeRGB));
+            s.set(GL_BLEND_EQUATION_ALPHA, static_cast<GLint>(modeAlpha));
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendEquation> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum mode) noexcept {
+            return state_observer<&GladGLContext::BlendEquationSeparate>::is_redundant(s, mode, mode);
+        }
+
+        static void update(gl_state_shadow& s, GLenum mode) {
+            state_observer<&GladGLContext::BlendEquationSeparate>::update(s, mode, mode);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendFunci> {
+        static void update(gl_state_shadow& s, GLuint, GLenum, GLenum) noexcept { s.invalidate(impl::blend_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendFuncSeparatei> {
+        static void update(gl_state_shadow& s, GLuint, GLenum, GLenum, GLenum, GLenum) noexcept { s.invalidate(impl::blend_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendEquationi> {
+        static void update(gl_state_shadow& s, GLuint, GLenum) noexcept { s.invalidate(impl::blend_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendEquationSeparatei> {
+        static void update(gl_state_shadow& s, GLuint, GLenum, GLenum) noexcept { s.invalidate(impl::blend_names); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::BlendColor> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat r, GLfloat g, GLfloat b, GLfloat a) noexcept { return s.holds(GL_BLEND_COLOR, std::array{r, g, b, a}); }
+
+        static void update(gl_state_shadow& s, GLfloat r, GLfloat g, GLfloat b, GLfloat a) { s.set(GL_BLEND_COLOR, std::array{r, g, b, a}); }
+    };
+
+    // Depth
+
+    template<>
+    struct state_observer<&GladGLContext::DepthFunc> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum func) noexcept { return s.holds(GL_DEPTH_FUNC, static_cast<GLint>(func)); }
+
+        static void update(gl_state_shadow& s, GLenum func) { s.set(GL_DEPTH_FUNC, static_cast<GLint>(func)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DepthMask> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLboolean flag) noexcept { return s.holds(GL_DEPTH_WRITEMASK, impl::to_gl_boolean(flag)); }
+
+        static void update(gl_state_shadow& s, GLboolean flag) { s.set(GL_DEPTH_WRITEMASK, impl::to_gl_boolean(flag)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DepthRange> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLdouble n, GLdouble f) noexcept { return s.holds(GL_DEPTH_RANGE, std::array{impl::to_unit_interval(n), impl::to_unit_interval(f)}); }
+
+        static void update(gl_state_shadow& s, GLdouble n, GLdouble f) { s.set(GL_DEPTH_RANGE, std::array{impl::to_unit_interval(n), impl::to_unit_interval(f)}); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DepthRangef> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat n, GLfloat f) noexcept { return state_observer<&GladGLContext::DepthRange>::is_redundant(s, n, f); }
+
+        static void update(gl_state_shadow& s, GLfloat n, GLfloat f) { state_observer<&GladGLContext::DepthRange>::update(s, n, f); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DepthRangeArrayv> {
+        static void update(gl_state_shadow& s, GLuint, GLsizei, const GLdouble*) noexcept { s.invalidate(GL_DEPTH_RANGE); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::DepthRangeIndexed> {
+        static void update(gl_state_shadow& s, GLuint, GLdouble, GLdouble) noexcept { s.invalidate(GL_DEPTH_RANGE); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ClearDepth> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLdouble depth) noexcept { return s.holds(GL_DEPTH_CLEAR_VALUE, impl::to_unit_interval(depth)); }
+
+        static void update(gl_state_shadow& s, GLdouble depth) { s.set(GL_DEPTH_CLEAR_VALUE, impl::to_unit_interval(depth)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ClearDepthf> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat depth) noexcept { return state_observer<&GladGLContext::ClearDepth>::is_redundant(s, depth); }
+
+        static void update(gl_state_shadow& s, GLfloat depth) { state_observer<&GladGLContext::ClearDepth>::update(s, depth); }
+    };
+
+    // Stencil. References and masks are reported by the driver only to the precision of the
+    // stencil buffer, so they are invalidated rather than set.
+
+    template<>
+    struct state_observer<&GladGLContext::StencilFuncSeparate> {
+        static void update(gl_state_shadow& s, GLenum face, GLenum func, GLint, GLuint) {
+            impl::for_each_stencil_face(face, [&](bool back) {
+                s.set(back ? GL_STENCIL_BACK_FUNC : GL_STENCIL_FUNC, static_cast<GLint>(func));
+                s.invalidate(back ? GL_STENCIL_BACK_REF : GL_STENCIL_REF);
+                s.invalidate(back ? GL_STENCIL_BACK_VALUE_MASK : GL_STENCIL_VALUE_MASK);
+            });
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::StencilFunc> {
+        static void update(gl_state_shadow& s, GLenum func, GLint ref, GLuint mask) {
+            state_observer<&GladGLContext::StencilFuncSeparate>::update(s, GL_FRONT_AND_BACK, func, ref, mask);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::StencilOpSeparate> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) noexcept {
+            bool redundant{true};
+            impl::for_each_stencil_face(face, [&](bool back) {
+                redundant = redundant
+                    && s.holds(back ? GL_STENCIL_BACK_FAIL            : GL_STENCIL_FAIL,            static_cast<GLint>(sfail))
+                    && s.holds(back ? GL_STENCIL_BACK_PASS_DEPTH_FAIL : GL_STENCIL_PASS_DEPTH_FAIL, static_cast<GLint>(dpfail))
+                    && s.holds(back ? GL_STENCIL_BACK_PASS_DEPTH_PASS : GL_STENCIL_PASS_DEPTH_PASS, static_cast<GLint>(dppass));
+            });
+
+            return redundant;
+        }
+
+        static void update(gl_state_shadow& s, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+            impl::for_each_stencil_face(face, [&](bool back) {
+                s.set(back ? GL_STENCIL_BACK_FAIL            : GL_STENCIL_FAIL,            static_cast<GLint>(sfail));
+                s.set(back ? GL_STENCIL_BACK_PASS_DEPTH_FAIL : GL_STENCIL_PASS_DEPTH_FAIL, static_cast<GLint>(dpfail));
+                s.set(back ? GL_STENCIL_BACK_PASS_DEPTH_PASS : GL_STENCIL_PASS_DEPTH_PASS, static_cast<GLint>(dppass));
+            });
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::StencilOp> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum sfail, GLenum dpfail, GLenum dppass) noexcept {
+            return state_observer<&GladGLContext::StencilOpSeparate>::is_redundant(s, GL_FRONT_AND_BACK, sfail, dpfail, dppass);
+        }
+
+        static void update(gl_state_shadow& s, GLenum sfail, GLenum dpfail, GLenum dppass) {
+            state_observer<&GladGLContext::StencilOpSeparate>::update(s, GL_FRONT_AND_BACK, sfail, dpfail, dppass);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::StencilMaskSeparate> {
+        static void update(gl_state_shadow& s, GLenum face, GLuint) noexcept {
+            impl::for_each_stencil_face(face, [&](bool back) { s.invalidate(back ? GL_STENCIL_BACK_WRITEMASK : GL_STENCIL_WRITEMASK); });
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::StencilMask> {
+        static void update(gl_state_shadow& s, GLuint mask) noexcept { state_observer<&GladGLContext::StencilMaskSeparate>::update(s, GL_FRONT_AND_BACK, mask); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ClearStencil> {
+        static void update(gl_state_shadow& s, GLint) noexcept { s.invalidate(GL_STENCIL_CLEAR_VALUE); }
+    };
+
+    // Colour
+
+    template<>
+    struct state_observer<&GladGLContext::ColorMask> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLboolean r, GLboolean g, GLboolean b, GLboolean a) noexcept {
+            using namespace impl;
+            return s.holds(GL_COLOR_WRITEMASK, std::array{to_gl_boolean(r), to_gl_boolean(g), to_gl_boolean(b), to_gl_boolean(a)});
+        }
+
+        static void update(gl_state_shadow& s, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+            using namespace impl;
+            s.set(GL_COLOR_WRITEMASK, std::array{to_gl_boolean(r), to_gl_boolean(g), to_gl_boolean(b), to_gl_boolean(a)});
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ColorMaski> {
+        static void update(gl_state_shadow& s, GLuint, GLboolean, GLboolean, GLboolean, GLboolean) noexcept { s.invalidate(GL_COLOR_WRITEMASK); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ClearColor> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat r, GLfloat g, GLfloat b, GLfloat a) noexcept { return s.holds(GL_COLOR_CLEAR_VALUE, std::array{r, g, b, a}); }
+
+        static void update(gl_state_shadow& s, GLfloat r, GLfloat g, GLfloat b, GLfloat a) { s.set(GL_COLOR_CLEAR_VALUE, std::array{r, g, b, a}); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::LogicOp> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum op) noexcept { return s.holds(GL_LOGIC_OP_MODE, static_cast<GLint>(op)); }
+
+        static void update(gl_state_shadow& s, GLenum op) { s.set(GL_LOGIC_OP_MODE, static_cast<GLint>(op)); }
+    };
+
+    // Viewport and scissor
+
+    template<>
+    struct state_observer<&GladGLContext::Viewport> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLint x, GLint y, GLsizei w, GLsizei h) noexcept { return s.holds(GL_VIEWPORT, std::array{x, y, w, h}); }
+
+        static void update(gl_state_shadow& s, GLint x, GLint y, GLsizei w, GLsizei h) { s.set(GL_VIEWPORT, std::array{x, y, w, h}); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ViewportArrayv> {
+        static void update(gl_state_shadow& s, GLuint, GLsizei, const GLfloat*) noexcept { s.invalidate(GL_VIEWPORT); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ViewportIndexedf> {
+        static void update(gl_state_shadow& s, GLuint, GLfloat, GLfloat, GLfloat, GLfloat) noexcept { s.invalidate(GL_VIEWPORT); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ViewportIndexedfv> {
+        static void update(gl_state_shadow& s, GLuint, const GLfloat*) noexcept { s.invalidate(GL_VIEWPORT); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::Scissor> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLint x, GLint y, GLsizei w, GLsizei h) noexcept { return s.holds(GL_SCISSOR_BOX, std::array{x, y, w, h}); }
+
+        static void update(gl_state_shadow& s, GLint x, GLint y, GLsizei w, GLsizei h) { s.set(GL_SCISSOR_BOX, std::array{x, y, w, h}); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ScissorArrayv> {
+        static void update(gl_state_shadow& s, GLuint, GLsizei, const GLint*) noexcept { s.invalidate(GL_SCISSOR_BOX); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ScissorIndexed> {
+        static void update(gl_state_shadow& s, GLuint, GLint, GLint, GLsizei, GLsizei) noexcept { s.invalidate(GL_SCISSOR_BOX); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ScissorIndexedv> {
+        static void update(gl_state_shadow& s, GLuint, const GLint*) noexcept { s.invalidate(GL_SCISSOR_BOX); }
+    };
+
+    // Rasterization
+
+    template<>
+    struct state_observer<&GladGLContext::CullFace> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum mode) noexcept { return s.holds(GL_CULL_FACE_MODE, static_cast<GLint>(mode)); }
+
+        static void update(gl_state_shadow& s, GLenum mode) { s.set(GL_CULL_FACE_MODE, static_cast<GLint>(mode)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::FrontFace> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum mode) noexcept { return s.holds(GL_FRONT_FACE, static_cast<GLint>(mode)); }
+
+        static void update(gl_state_shadow& s, GLenum mode) { s.set(GL_FRONT_FACE, static_cast<GLint>(mode)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::LineWidth> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat width) noexcept { return s.holds(GL_LINE_WIDTH, width); }
+
+        static void update(gl_state_shadow& s, GLfloat width) { s.set(GL_LINE_WIDTH, width); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PointSize> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat size) noexcept { return s.holds(GL_POINT_SIZE, size); }
+
+        static void update(gl_state_shadow& s, GLfloat size) { s.set(GL_POINT_SIZE, size); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PolygonOffset> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat factor, GLfloat units) noexcept {
+            return s.holds(GL_POLYGON_OFFSET_FACTOR, factor) && s.holds(GL_POLYGON_OFFSET_UNITS, units) && s.holds(GL_POLYGON_OFFSET_CLAMP, GLfloat{});
+        }
+
+        static void update(gl_state_shadow& s, GLfloat factor, GLfloat units) {
+            s.set(GL_POLYGON_OFFSET_FACTOR, factor);
+            s.set(GL_POLYGON_OFFSET_UNITS,  units);
+            s.set(GL_POLYGON_OFFSET_CLAMP,  GLfloat{});
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PolygonOffsetClamp> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat factor, GLfloat units, GLfloat clamp) noexcept {
+            return s.holds(GL_POLYGON_OFFSET_FACTOR, factor) && s.holds(GL_POLYGON_OFFSET_UNITS, units) && s.holds(GL_POLYGON_OFFSET_CLAMP, clamp);
+        }
+
+        static void update(gl_state_shadow& s, GLfloat factor, GLfloat units, GLfloat clamp) {
+            s.set(GL_POLYGON_OFFSET_FACTOR, factor);
+            s.set(GL_POLYGON_OFFSET_UNITS,  units);
+            s.set(GL_POLYGON_OFFSET_CLAMP,  clamp);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::SampleCoverage> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat value, GLboolean invert) noexcept {
+            return s.holds(GL_SAMPLE_COVERAGE_VALUE, impl::to_unit_interval(value)) && s.holds(GL_SAMPLE_COVERAGE_INVERT, impl::to_gl_boolean(invert));
+        }
+
+        static void update(gl_state_shadow& s, GLfloat value, GLboolean invert) {
+            s.set(GL_SAMPLE_COVERAGE_VALUE,  impl::to_unit_interval(value));
+            s.set(GL_SAMPLE_COVERAGE_INVERT, impl::to_gl_boolean(invert));
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ProvokingVertex> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum mode) noexcept { return s.holds(GL_PROVOKING_VERTEX, static_cast<GLint>(mode)); }
+
+        static void update(gl_state_shadow& s, GLenum mode) { s.set(GL_PROVOKING_VERTEX, static_cast<GLint>(mode)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PrimitiveRestartIndex> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLuint index) noexcept { return s.holds(GL_PRIMITIVE_RESTART_INDEX, static_cast<GLint>(index)); }
+
+        static void update(gl_state_shadow& s, GLuint index) { s.set(GL_PRIMITIVE_RESTART_INDEX, static_cast<GLint>(index)); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::ClipControl> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum origin, GLenum depth) noexcept {
+            return s.holds(GL_CLIP_ORIGIN, static_cast<GLint>(origin)) && s.holds(GL_CLIP_DEPTH_MODE, static_cast<GLint>(depth));
+        }
+
+        static void update(gl_state_shadow& s, GLenum origin, GLenum depth) {
+            s.set(GL_CLIP_ORIGIN,     static_cast<GLint>(origin));
+            s.set(GL_CLIP_DEPTH_MODE, static_cast<GLint>(depth));
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::MinSampleShading> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLfloat value) noexcept { return s.holds(GL_MIN_SAMPLE_SHADING_VALUE, impl::to_unit_interval(value)); }
+
+        static void update(gl_state_shadow& s, GLfloat value) { s.set(GL_MIN_SAMPLE_SHADING_VALUE, impl::to_unit_interval(value)); }
+    };
+
+    /// GL_PATCH_VERTICES is the only integer patch parameter
+    template<>
+    struct state_observer<&GladGLContext::PatchParameteri> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum pname, GLint value) noexcept { return s.holds(pname, value); }
+
+        static void update(gl_state_shadow& s, GLenum pname, GLint value) { s.set(pname, value); }
+    };
+
+    // Point parameters may be queried as any type, so are invalidated rather than set
+
+    template<>
+    struct state_observer<&GladGLContext::PointParameterf> {
+        static void update(gl_state_shadow& s, GLenum pname, GLfloat) noexcept { s.invalidate(pname); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PointParameterfv> {
+        static void update(gl_state_shadow& s, GLenum pname, const GLfloat*) noexcept { s.invalidate(pname); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PointParameteri> {
+        static void update(gl_state_shadow& s, GLenum pname, GLint) noexcept { s.invalidate(pname); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PointParameteriv> {
+        static void update(gl_state_shadow& s, GLenum pname, const GLint*) noexcept { s.invalidate(pname); }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::Hint> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum target, GLenum mode) noexcept { return s.holds(target, static_cast<GLint>(mode)); }
+
+        static void update(gl_state_shadow& s, GLenum target, GLenum mode) { s.set(target, static_cast<GLint>(mode)); }
+    };
+
+    // Pixel storage
+
+    template<>
+    struct state_observer<&GladGLContext::PixelStorei> {
+        [[nodiscard]]
+        static bool is_redundant(const gl_state_shadow& s, GLenum pname, GLint param) noexcept {
+            return impl::is_boolean_pixel_store(pname) ? s.holds(pname, impl::to_gl_boolean(param)) : s.holds(pname, param);
+        }
+
+        static void update(gl_state_shadow& s, GLenum pname, GLint param) {
+            if(impl::is_boolean_pixel_store(pname))
+                s.set(pname, impl::to_gl_boolean(param));
+            else
+                s.set(pname, param);
+        }
+    };
+
+    template<>
+    struct state_observer<&GladGLContext::PixelStoref> {
+        static void update(gl_state_shadow& s, GLenum pname, GLfloat) noexcept { s.invalidate(pname); }
+    };
+
+    template<auto... PtrsToMem>
+    struct entry_point_list {};
+
+    /// Consulted by gl_function, for which the entry point is known only at runtime
+    using observed_entry_points
+        = entry_point_list<
+              &GladGLContext::ActiveTexture,
+              &GladGLContext::BindBuffer,
+              &GladGLContext::BindBufferBase,
+              &GladGLContext::BindBufferRange,
+              &GladGLContext::BindFramebuffer,
+              &GladGLContext::BindProgramPipeline,
+              &GladGLContext::BindRenderbuffer,
+              &GladGLContext::BindSampler,
+              &GladGLContext::BindSamplers,
+              &GladGLContext::BindTexture,
+              &GladGLContext::BindTextureUnit,
+              &GladGLContext::BindTextures,
+              &GladGLContext::BindTransformFeedback,
+              &GladGLContext::BindVertexArray,
+              &GladGLContext::BlendColor,
+              &GladGLContext::BlendEquation,
+              &GladGLContext::BlendEquationSeparate,
+              &GladGLContext::BlendEquationSeparatei,
+              &GladGLContext::BlendEquationi,
+              &GladGLContext::BlendFunc,
+              &GladGLContext::BlendFuncSeparate,
+              &GladGLContext::BlendFuncSeparatei,
+              &GladGLContext::BlendFunci,
+              &GladGLContext::ClearColor,
+              &GladGLContext::ClearDepth,
+              &GladGLContext::ClearDepthf,
+              &GladGLContext::ClearStencil,
+              &GladGLContext::ClipControl,
+              &GladGLContext::ColorMask,
+              &GladGLContext::ColorMaski,
+              &GladGLContext::CullFace,
+              &GladGLContext::DeleteBuffers,
+              &GladGLContext::DeleteFramebuffers,
+              &GladGLContext::DeleteProgramPipelines,
+              &GladGLContext::DeleteRenderbuffers,
+              &GladGLContext::DeleteSamplers,
+              &GladGLContext::DeleteTextures,
+              &GladGLContext::DeleteVertexArrays,
+              &GladGLContext::DepthFunc,
+              &GladGLContext::DepthMask,
+              &GladGLContext::DepthRange,
+              &GladGLContext::DepthRangeArrayv,
+              &GladGLContext::DepthRangeIndexed,
+              &GladGLContext::DepthRangef,
+              &GladGLContext::Disable,
+              &GladGLContext::Disablei,
+              &GladGLContext::Enable,
+              &GladGLContext::Enablei,
+              &GladGLContext::FrontFace,
+              &GladGLContext::Hint,
+              &GladGLContext::LineWidth,
+              &GladGLContext::LogicOp,
+              &GladGLContext::MinSampleShading,
+              &GladGLContext::PatchParameteri,
+              &GladGLContext::PixelStoref,
+              &GladGLContext::PixelStorei,
+              &GladGLContext::PointParameterf,
+              &GladGLContext::PointParameterfv,
+              &GladGLContext::PointParameteri,
+              &GladGLContext::PointParameteriv,
+              &GladGLContext::PointSize,
+              &GladGLContext::PolygonOffset,
+              &GladGLContext::PolygonOffsetClamp,
+              &GladGLContext::PrimitiveRestartIndex,
+              &GladGLContext::ProvokingVertex,
+              &GladGLContext::SampleCoverage,
+              &GladGLContext::Scissor,
+              &GladGLContext::ScissorArrayv,
+              &GladGLContext::ScissorIndexed,
+              &GladGLContext::ScissorIndexedv,
+              &GladGLContext::StencilFunc,
+              &GladGLContext::StencilFuncSeparate,
+              &GladGLContext::StencilMask,
+              &GladGLContext::StencilMaskSeparate,
+              &GladGLContext::StencilOp,
+              &GladGLContext::StencilOpSeparate,
+              &GladGLContext::UseProgram,
+              &GladGLContext::VertexArrayElementBuffer,
+              &GladGLContext::Viewport,
+              &GladGLContext::ViewportArrayv,
+              &GladGLContext::ViewportIndexedf,
+              &GladGLContext::ViewportIndexedfv
+          >;
+
+    static_assert([]<auto... PtrsToMem>(entry_point_list<PtrsToMem...>) { return (is_observed_v<PtrsToMem> && ...); }(observed_entry_points{}));
+}
@@ -26,6 +26,29 @@ namespace avocet::opengl{
     constexpr bool object_labels_supported(opengl_version version) noexcept {
         return version >= opengl_version{4, 3};
     }
+
+    [[nodiscard]]
+    constexpr bool direct_state_access_supported(opengl_version version) noexcept {
+        return version >= opengl_version{4, 5};
+    }
+
+    /// Immutable buffer storage, which may be mapped persistently
+    [[nodiscard]]
+    constexpr bool buffer_storage_supported(opengl_version version) noexcept {
+        return version >= opengl_version{4, 4};
+    }
+
+    /// Vertex attribute formats specified independently of the buffers from which the attributes are sourced
+    [[nodiscard]]
+    constexpr bool vertex_attrib_binding_supported(opengl_version version) noexcept {
+        return version >= opengl_version{4, 3};
+    }
+
+    /// Multiple indirect draws, sourced from a buffer, with a single call
+    [[nodiscard]]
+    constexpr bool multi_draw_indirect_supported(opengl_version version) noexcept {
+        return version >= opengl_version{4, 3};
+    }
 }
 
 
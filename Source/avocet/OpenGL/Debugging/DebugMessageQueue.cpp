@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Debugging/DebugMessageQueue.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <stdexcept>
+
+namespace avocet::opengl {
+    namespace {
+        [[nodiscard]]
+        std::size_t validated_capacity(queue_capacity capacity) {
+            if(!std::has_single_bit(capacity.value))
+                throw std::runtime_error{std::format("debug_message_queue: capacity {} is not a power of two", capacity.value)};
+
+            return capacity.value;
+        }
+    }
+
+    debug_message_queue::debug_message_queue(queue_capacity capacity, max_message_length maxLength)
+        : m_Mask{validated_capacity(capacity) - 1}
+        , m_MaxLength{maxLength.value}
+        , m_Cells{std::make_unique<cell[]>(capacity.value)}
+        , m_Text{std::make_unique<char[]>(capacity.value * maxLength.value)}
+    {
+        for(std::size_t i{}; i < capacity.value; ++i)
+            m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    bool debug_message_queue::try_push(GLenum source, GLenum type, GLuint id, GLenum severity, std::string_view message) noexcept {
+        auto pos{m_PushPos.load(std::memory_order_relaxed)};
+        for(;;) {
+            cell& c{m_Cells[pos & m_Mask]};
+            const auto seq{c.sequence.load(std::memory_order_acquire)};
+            if(seq == pos) {
+                if(m_PushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(seq < pos) {
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else {
+                pos = m_PushPos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell& c{m_Cells[pos & m_Mask]};
+        c.source   = source;
+        c.type     = type;
+        c.id       = id;
+        c.severity = severity;
+        c.length   = std::min(message.size(), m_MaxLength);
+        std::ranges::copy(message.substr(0, c.length), text(pos));
+
+        c.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]]
+    std::optional<std::size_t> debug_message_queue::claim_for_pop() noexcept {
+        auto pos{m_PopPos.load(std::memory_order_relaxed)};
+        for(;;) {
+            const auto seq{m_Cells[pos & m_Mask].sequence.load(std::memory_order_acquire)};
+            if(seq == pos + 1) {
+                if(m_PopPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return pos;
+            }
+            else if(seq < pos + 1) {
+                return std::nullopt;
+            }
+            else {
+                pos = m_PopPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
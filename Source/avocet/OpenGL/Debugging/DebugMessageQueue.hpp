@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "glad/gl.h"
+
+namespace avocet::opengl {
+    struct raw_debug_message {
+        GLenum source{}, type{}, severity{};
+        GLuint id{};
+        std::string_view message{};
+    };
+
+    struct queue_capacity { std::size_t value{}; };
+
+    struct max_message_length { std::size_t value{}; };
+
+    /// Bounded, lock-free queue into which a debug message callback may push from any thread.
+    /// Storage is allocated up front so that pushing never allocates; messages which do not
+    /// fit are dropped, and counted. Popping is expected to be done by a single consumer.
+    class debug_message_queue {
+    public:
+        debug_message_queue(queue_capacity capacity, max_message_length maxLength);
+
+        debug_message_queue(const debug_message_queue&)            = delete;
+        debug_message_queue& operator=(const debug_message_queue&) = delete;
+
+        bool try_push(GLenum source, GLenum type, GLuint id, GLenum severity, std::string_view message) noexcept;
+
+        /// Pops each message in turn, passing it to fn. The string_view within the raw_debug_message
+        /// is only valid for the duration of the call. Returns the number of messages dropped since
+        /// the previous drain.
+        template<class Fn>
+            requires std::is_invocable_v<Fn, const raw_debug_message&>
+        std::size_t drain(Fn fn) {
+            while(const auto pos{claim_for_pop()}) {
+                cell& c{m_Cells[*pos & m_Mask]};
+                fn(raw_debug_message{c.source, c.type, c.id, c.severity, {text(*pos), c.length}});
+                c.sequence.store(*pos + m_Mask + 1, std::memory_order_release);
+            }
+
+            return m_Dropped.exchange(0, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept { return m_Mask + 1; }
+    private:
+        struct cell {
+            std::atomic<std::size_t> sequence{};
+            GLenum source{}, type{}, severity{};
+            GLuint id{};
+            std::size_t length{};
+        };
+
+        constexpr static std::size_t cache_line_size{64};
+
+        std::size_t m_Mask{}, m_MaxLength{};
+        std::unique_ptr<cell[]> m_Cells;
+        std::unique_ptr<char[]> m_Text;
+
+        alignas(cache_line_size) std::atomic<std::size_t> m_PushPos{};
+        alignas(cache_line_size) std::atomic<std::size_t> m_PopPos{};
+        alignas(cache_line_size) std::atomic<std::size_t> m_Dropped{};
+
+        [[nodiscard]]
+        char* text(std::size_t pos) const noexcept { return m_Text.get() + (pos & m_Mask) * m_MaxLength; }
+
+        [[nodiscard]]
+        std::optional<std::size_t> claim_for_pop() noexcept;
+    };
+}
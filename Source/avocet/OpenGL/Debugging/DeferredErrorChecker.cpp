@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Debugging/DeferredErrorChecker.hpp"
+
+#include "avocet/Core/Formatting/Formatting.hpp"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+
+namespace avocet::opengl {
+    [[nodiscard]]
+    std::string compose_pending_error_message(std::string_view errorMessage, std::source_location scopeLoc) {
+        return std::format("OpenGL error raised by a call made outside of any checked scope, detected on entry to the scope originating from {}:\n{}\n", avocet::to_string(scopeLoc), errorMessage);
+    }
+
+    [[nodiscard]]
+    std::string compose_unreproduced_error_message(std::string_view errorMessage, std::source_location scopeLoc, std::span<const decorator_data> calls, num_messages maxReported) {
+        std::string message{
+            std::format("OpenGL error detected at the end of the scope originating from {}, but not reproduced when replaying it with per-call checking:\n{}\n", avocet::to_string(scopeLoc), errorMessage)
+        };
+
+        const auto numReported{std::ranges::min(calls.size(), maxReported.value)};
+        std::format_to(std::back_inserter(message), "Final {} of {} recorded call(s):\n", numReported, calls.size());
+        for(const auto& data : calls.last(numReported))
+            std::format_to(std::back_inserter(message), "{} originating from {}\n", data.fn_name, avocet::to_string(data.loc));
+
+        return message;
+    }
+}
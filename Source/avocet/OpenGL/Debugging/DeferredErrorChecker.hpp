@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Debugging/Errors.hpp"
+
+#include <concepts>
+#include <span>
+#include <vector>
+
+namespace avocet::opengl {
+    struct expected_calls { std::size_t value{}; };
+
+    [[nodiscard]]
+    std::string compose_pending_error_message(std::string_view errorMessage, std::source_location scopeLoc);
+
+    [[nodiscard]]
+    std::string compose_unreproduced_error_message(std::string_view errorMessage, std::source_location scopeLoc, std::span<const decorator_data> calls, num_messages maxReported);
+
+    class deferred_error_checker;
+
+    /// Epilogue through which a deferred_error_checker observes each call;
+    /// the checker must outlive any context on which the recorder is installed.
+    class deferred_call_recorder {
+        deferred_error_checker* m_Checker{};
+    public:
+        explicit deferred_call_recorder(deferred_error_checker& checker) noexcept
+            : m_Checker{&checker}
+        {}
+
+        void operator()(const context& ctx, const decorator_data& data) const;
+    };
+
+    /// Designed for use with debugging_mode::deferred. Within a scope, calls are merely
+    /// recorded; errors are checked once, at the end. If there are any, the scope is run
+    /// again, this time checking after every call, so that the culprit may be identified.
+    /// Replaying the scope, rather than the recorded calls, avoids reissuing calls whose
+    /// pointer arguments may, by then, be dangling. Calls made outside of a scope are not
+    /// checked individually, but any errors they raise are reported on entry to the next scope.
+    class deferred_error_checker {
+    public:
+        deferred_error_checker(num_messages maxReported, expected_calls expected)
+            : m_MaxReported{maxReported}
+        {
+            m_Calls.reserve(expected.value);
+        }
+
+        deferred_error_checker(const deferred_error_checker&)            = delete;
+        deferred_error_checker& operator=(const deferred_error_checker&) = delete;
+
+        [[nodiscard]]
+        deferred_call_recorder recorder() noexcept { return deferred_call_recorder{*this}; }
+
+        /// Should an error be detected, fn is invoked a second time. It is therefore the caller's
+        /// responsibility to ensure that any side effects of fn, other than GL calls, may safely be repeated.
+        /// The replay starts from the GL state left by the first run, not from that in which the scope was
+        /// entered: an error which depends on the latter may not recur, in which case the recorded calls are
+        /// reported instead.
+        template<std::invocable Fn>
+        void check_scope(const context& ctx, Fn fn, std::source_location loc = std::source_location::current()) {
+            m_Calls.clear();
+
+            // Error flags raised before the scope would otherwise be attributed to it
+            if(const std::string pending{std::ranges::fold_left(get_errors(ctx, m_MaxReported), std::string{}, default_error_code_processor{})}; !pending.empty())
+                throw std::runtime_error{compose_pending_error_message(pending, loc)};
+
+            run(fn, phase::recording);
+
+            const std::string errorMessage{std::ranges::fold_left(get_errors(ctx, m_MaxReported), std::string{}, default_error_code_processor{})};
+            if(errorMessage.empty())
+                return;
+
+            // Calls made in error may have polluted the state shadow, in which case
+            // the culprit could be elided as redundant during the replay
+            ctx.state_shadow().clear();
+            run(fn, phase::replaying);
+
+            throw std::runtime_error{compose_unreproduced_error_message(errorMessage, loc, m_Calls, m_MaxReported)};
+        }
+
+        [[nodiscard]]
+        std::span<const decorator_data> recorded_calls() const noexcept { return m_Calls; }
+    private:
+        friend deferred_call_recorder;
+
+        enum class phase { idle, recording, replaying };
+
+        std::vector<decorator_data> m_Calls{};
+        num_messages m_MaxReported{};
+        phase m_Phase{phase::idle};
+
+        void record(const context& ctx, const decorator_data& data) {
+            switch(m_Phase) {
+            case phase::idle:
+                break;
+            case phase::recording:
+                m_Calls.push_back(data);
+                break;
+            case phase::replaying:
+                check_for_basic_errors(ctx, {data.fn_name, data.loc, m_MaxReported}, default_error_code_processor{});
+                break;
+            }
+        }
+
+        template<std::invocable Fn>
+        void run(Fn& fn, phase p) {
+            m_Phase = p;
+            try {
+                fn();
+            }
+            catch(...) {
+                m_Phase = phase::idle;
+                throw;
+            }
+
+            m_Phase = phase::idle;
+        }
+    };
+
+    inline void deferred_call_recorder::operator()(const context& ctx, const decorator_data& data) const {
+        m_Checker->record(ctx, data);
+    }
+}
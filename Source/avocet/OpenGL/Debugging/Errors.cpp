@@ -185,6 +185,26 @@ namespace avocet::opengl {
         return std::format("OpenGL error detected following invocation of {} originating from {}:\n{}\n", info.fn_name, avocet::to_string(info.loc), errorMessage);
     }
 
+    [[nodiscard]]
+    asynchronous_messages drain_asynchronous_messages(const context& ctx) {
+        asynchronous_messages drained{};
+        if(auto* pQueue{ctx.asynchronous_debug_messages()}) {
+            drained.num_dropped = pQueue->drain(
+                [&messages = drained.messages](const raw_debug_message& raw) {
+                    messages.push_back({message_id{raw.id}, debug_source{raw.source}, debug_type{raw.type}, debug_severity{raw.severity}, std::string{raw.message}});
+                }
+            );
+        }
+
+        return drained;
+    }
+
+    [[nodiscard]]
+    std::string compose_asynchronous_error_message(std::string_view errorMessage, std::source_location loc, std::size_t numDropped) {
+        const auto dropped{numDropped ? std::format("\n{} further message(s) were dropped, since the queue was full\n", numDropped) : std::string{}};
+        return std::format("OpenGL error(s) reported asynchronously, drained at {}:\n{}\n{}", avocet::to_string(loc), errorMessage, dropped);
+    }
+
 
 #ifdef __cpp_lib_generator
     [[nodiscard]]
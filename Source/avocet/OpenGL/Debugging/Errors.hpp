@@ -182,17 +182,53 @@ namespace avocet::opengl {
             throw std::runtime_error{compose_error_message(errorMessage, info)};
     }
 
+    [[nodiscard]]
+    constexpr bool checks_every_call(debugging_mode mode) noexcept {
+        return (mode != debugging_mode::off) && (mode != debugging_mode::deferred);
+    }
+
+    /// In debugging_mode::asynchronous, debug messages are pushed by the driver into a
+    /// queue and so there is nothing to do per call; rather, the queue must be drained
+    /// via check_for_asynchronous_errors. If debug output is unavailable, basic checking
+    /// is used instead. In debugging_mode::deferred, checking is done per scope, by the
+    /// deferred_error_checker.
     template<class ErrorCodeProcessor, class DebugInfoProcessor>
         requires is_error_code_processor_v<ErrorCodeProcessor>&& is_debug_info_processor_v<DebugInfoProcessor>
     void check_for_errors(const context& ctx, debugging_mode mode, const error_message_info& info, ErrorCodeProcessor errorCodeProcessor, DebugInfoProcessor&& debugInfoProcessor) {
-        if(mode != debugging_mode::off) {
-            if(ctx.fundamental_characteristics().debug_output_enabled())
-                check_for_advanced_errors(ctx, info, std::move(debugInfoProcessor));
-            else
+        if(checks_every_call(mode)) {
+            if(ctx.fundamental_characteristics().debug_output_enabled()) {
+                if(mode != debugging_mode::asynchronous)
+                    check_for_advanced_errors(ctx, info, std::move(debugInfoProcessor));
+            }
+            else {
                 check_for_basic_errors(ctx, info, std::move(errorCodeProcessor));
+            }
         }
     }
 
+    struct asynchronous_messages {
+        std::vector<debug_info> messages{};
+        std::size_t num_dropped{};
+    };
+
+    [[nodiscard]]
+    asynchronous_messages drain_asynchronous_messages(const context& ctx);
+
+    [[nodiscard]]
+    std::string compose_asynchronous_error_message(std::string_view errorMessage, std::source_location loc, std::size_t numDropped);
+
+    /// Drains any debug messages accumulated in debugging_mode::asynchronous, folding them through the
+    /// processor, and throws if the result is non-empty. Intended to be called at frame or scope boundaries.
+    template<class DebugInfoProcessor>
+        requires is_debug_info_processor_v<DebugInfoProcessor>
+    void check_for_asynchronous_errors(const context& ctx, DebugInfoProcessor processor, std::source_location loc = std::source_location::current()) {
+        const auto [messages, numDropped]{drain_asynchronous_messages(ctx)};
+        const std::string errorMessage{std::ranges::fold_left(messages, std::string{}, processor)};
+
+        if(!errorMessage.empty())
+            throw std::runtime_error{compose_asynchronous_error_message(errorMessage, loc, numDropped)};
+    }
+
     template<class ErrorCodeProcessor=default_error_code_processor, class DebugInfoProcessor=default_debug_info_processor>
         requires    is_error_code_processor_v<ErrorCodeProcessor>       && is_debug_info_processor_v<DebugInfoProcessor>
                  && std::is_default_constructible_v<ErrorCodeProcessor> && std::is_default_constructible_v<DebugInfoProcessor>
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+
+namespace avocet::opengl {
+    /// A single polygon mesh drawn once for each element of an instance buffer, with one draw call. Instance is a
+    /// mem_ordered_tuple of per-instance attributes, such as a transform, a colour or a texture layer; in the shader,
+    /// their locations follow those of the vertex attributes. Textures, if any, are bound by the caller.
+    template<gl_floating_point T, std::size_t N, dimensionality ArenaDimension, class Instance, class... Attributes>
+        requires (N <= 87) && is_legal_gl_buffer_value_type_v<Instance> && (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class instanced_polygon {
+    public:
+        using value_type            = T;
+        using instance_type         = Instance;
+        using vertex_attribute_type = polygon_base<T, N, ArenaDimension, Attributes...>::vertex_attribute_type;
+        using vertices_type         = polygon_base<T, N, ArenaDimension, Attributes...>::vertices_type;
+        constexpr static auto num_vertices{N};
+
+        template<class Fn>
+            requires std::is_invocable_r_v<vertices_type, Fn, vertices_type>
+        instanced_polygon(const resourceful_context& ctx, Fn transformer, std::span<const instance_type> instances, const optional_label& label)
+            : m_VBO{ctx, transformer(st_Vertices), label}
+            , m_EBO{make_element_buffers(ctx, label)}
+            , m_Instances{ctx, instances, label}
+            , m_VAO{ctx, label, m_VBO, m_Instances}
+        {
+            for(const auto& ebo : m_EBO)
+                m_VAO.attach(ebo);
+        }
+
+        /// Overwrites the instances [offset, offset + instances.size()), which must already exist
+        void update_instances(this const instanced_polygon& self, std::size_t offset, std::span<const instance_type> instances) {
+            self.m_Instances.update(offset, instances);
+        }
+
+        /// Changes the number of instances, orphaning the previous storage
+        void replace_instances(this instanced_polygon& self, std::span<const instance_type> instances) {
+            self.m_Instances.replace(instances);
+        }
+
+        [[nodiscard]]
+        std::size_t num_instances() const noexcept { return m_Instances.size(); }
+
+        void draw(this const instanced_polygon& self) {
+            if(!self.num_instances())
+                return;
+
+            self.m_VAO.bind();
+            const auto& ctx{self.m_VAO.context()};
+            const auto instances{checked_conversion_to<GLsizei>(self.num_instances())};
+            if constexpr(N == 3) {
+                static_gl_function<&GladGLContext::DrawArraysInstanced>{}(ctx, GL_TRIANGLES, 0, 3, instances);
+            }
+            else {
+                static_gl_function<&GladGLContext::DrawElementsInstanced>{}(
+                    ctx, GL_TRIANGLES, elements_type::num_elements, to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<typename elements_type::index_type>), nullptr, instances
+                );
+            }
+        }
+
+        [[nodiscard]]
+        friend bool operator==(const instanced_polygon&, const instanced_polygon&) noexcept = default;
+    private:
+        using elements_type = polygon_elements<N>;
+        using ebo_type      = element_buffer_object<typename elements_type::index_type>;
+
+        /// Triangles are drawn from their vertices alone
+        constexpr static std::size_t num_element_buffers{N > 3 ? 1 : 0};
+
+        const inline static vertices_type st_Vertices{make_polygon<T, N, ArenaDimension, Attributes...>{}()};
+
+        vertex_buffer_object<vertex_attribute_type> m_VBO;
+        SEQUOIA_NO_UNIQUE_ADDRESS std::array<ebo_type, num_element_buffers> m_EBO;
+        dynamic_vertex_buffer_object<instance_type> m_Instances;
+        vertex_attribute_object m_VAO;
+
+        [[nodiscard]]
+        static std::array<ebo_type, num_element_buffers> make_element_buffers(const resourceful_context& ctx, const optional_label& label) {
+            if constexpr(num_element_buffers == 1)
+                return {ebo_type{ctx, elements_type::indices, label}};
+            else
+                return {};
+        }
+    };
+
+    template<gl_floating_point T, dimensionality ArenaDimension, class Instance, class... Attributes>
+    using instanced_triangle = instanced_polygon<T, 3, ArenaDimension, Instance, Attributes...>;
+
+    template<gl_floating_point T, dimensionality ArenaDimension, class Instance, class... Attributes>
+    using instanced_quad = instanced_polygon<T, 4, ArenaDimension, Instance, Attributes...>;
+}
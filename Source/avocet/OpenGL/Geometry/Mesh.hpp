@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Capabilities/Capabilities.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+namespace avocet::opengl {
+    enum class mesh_topology : GLenum {
+        triangles      = GL_TRIANGLES,
+        triangle_strip = GL_TRIANGLE_STRIP
+    };
+
+    /// Separates the strips of a triangle_strip mesh; it is mapped to the restart index of whichever type is chosen
+    inline constexpr GLuint primitive_restart_marker{std::numeric_limits<GLuint>::max()};
+
+    /// Triangulates a convex polygon as a fan about its first vertex
+    [[nodiscard]]
+    inline std::vector<GLuint> polygon_triangle_indices(std::size_t numVertices) {
+        std::vector<GLuint> indices{};
+        if(numVertices < 3)
+            return indices;
+
+        indices.reserve(3 * (numVertices - 2));
+        for(std::size_t i{1}; i + 1 < numVertices; ++i)
+            indices.insert(indices.end(), {0, checked_conversion_to<GLuint>(i), checked_conversion_to<GLuint>(i + 1)});
+
+        return indices;
+    }
+
+    /// Triangulates a convex polygon as a single strip, 0, 1, n-1, 2, n-2, ..., zig-zagging between its two sides
+    /// with one index per vertex, rather than three per triangle; the winding is that of the polygon
+    [[nodiscard]]
+    inline std::vector<GLuint> polygon_strip_indices(std::size_t numVertices) {
+        std::vector<GLuint> indices{};
+        indices.reserve(numVertices);
+        if(numVertices)
+            indices.push_back(0);
+
+        for(std::size_t lo{1}, hi{numVertices - 1}; indices.size() < numVertices;) {
+            indices.push_back(checked_conversion_to<GLuint>(lo++));
+            if(indices.size() < numVertices)
+                indices.push_back(checked_conversion_to<GLuint>(hi--));
+        }
+
+        return indices;
+    }
+
+    /// Indexed geometry whose vertex count is fixed only at runtime. The narrowest index type able to address
+    /// every vertex is chosen, unsigned bytes excepted, since some drivers convert these on the CPU. Strips which
+    /// are separated by primitive_restart_marker require primitive restart to be enabled, in the payload of the
+    /// capable_context, with the configuration returned by primitive_restart(). Textures, if any, are bound by the caller.
+    template<class Vertex>
+        requires is_legal_gl_buffer_value_type_v<Vertex>
+    class mesh {
+    public:
+        using vertex_type = Vertex;
+
+        mesh(const resourceful_context& ctx, std::span<const vertex_type> vertices, std::span<const GLuint> indices, mesh_topology topology, const optional_label& label)
+            : m_VBO{ctx, vertices, label}
+            , m_EBO{make_element_buffer(ctx, vertices.size(), indices, topology, label)}
+            , m_VAO{ctx, label, m_VBO}
+            , m_NumElements{checked_conversion_to<GLsizei>(indices.size())}
+            , m_Topology{topology}
+            , m_HasRestarts{std::ranges::find(indices, primitive_restart_marker) != indices.end()}
+        {
+            std::visit([this](const auto& ebo) { m_VAO.attach(ebo); }, m_EBO);
+        }
+
+        void draw(this const mesh& self) {
+            self.m_VAO.bind();
+            static_gl_function<&GladGLContext::DrawElements>{}(
+                self.m_VAO.context(), to_gl_underlying_value<GLenum>(self.m_Topology), self.m_NumElements, to_gl_underlying_value<GLenum>(self.index_type()), nullptr
+            );
+        }
+
+        [[nodiscard]]
+        gl_type_specifier index_type() const noexcept {
+            return m_EBO.index() ? to_gl_type_specifier_v<GLuint> : to_gl_type_specifier_v<GLushort>;
+        }
+
+        [[nodiscard]]
+        std::size_t num_vertices() const noexcept { return m_VBO.size(); }
+
+        [[nodiscard]]
+        std::size_t num_elements() const noexcept { return static_cast<std::size_t>(m_NumElements); }
+
+        [[nodiscard]]
+        mesh_topology topology() const noexcept { return m_Topology; }
+
+        /// Empty unless the mesh comprises several strips
+        [[nodiscard]]
+        std::optional<capabilities::gl_primitive_restart> primitive_restart() const noexcept {
+            if(!m_HasRestarts)
+                return std::nullopt;
+
+            return capabilities::gl_primitive_restart{m_EBO.index() ? std::numeric_limits<GLuint>::max() : std::numeric_limits<GLushort>::max()};
+        }
+
+        [[nodiscard]]
+        friend bool operator==(const mesh&, const mesh&) noexcept = default;
+    private:
+        using element_buffer_type = std::variant<element_buffer_object<GLushort>, element_buffer_object<GLuint>>;
+
+        vertex_buffer_object<vertex_type> m_VBO;
+        element_buffer_type m_EBO;
+        vertex_attribute_object m_VAO;
+        GLsizei m_NumElements{};
+        mesh_topology m_Topology{};
+        bool m_HasRestarts{};
+
+        /// The restart index is the maximum of the index type, and so can never address a vertex
+        [[nodiscard]]
+        static element_buffer_type make_element_buffer(const resourceful_context& ctx, std::size_t numVertices, std::span<const GLuint> indices, mesh_topology topology, const optional_label& label) {
+            if(indices.empty())
+                throw std::runtime_error{"mesh: no indices"};
+
+            if((topology == mesh_topology::triangles) && (indices.size() % 3))
+                throw std::runtime_error{std::format("mesh: {} indices do not form whole triangles", indices.size())};
+
+            for(auto i : indices) {
+                if((i == primitive_restart_marker) && (topology == mesh_topology::triangle_strip))
+                    continue;
+
+                if(i >= numVertices)
+                    throw std::runtime_error{std::format("mesh: index {} out of range for {} vertices", i, numVertices)};
+            }
+
+            if(numVertices <= std::numeric_limits<GLushort>::max())
+                return element_buffer_object<GLushort>{ctx, narrow_indices<GLushort>(indices), label};
+
+            return element_buffer_object<GLuint>{ctx, indices, label};
+        }
+
+        template<gl_integral I>
+        [[nodiscard]]
+        static std::vector<I> narrow_indices(std::span<const GLuint> indices) {
+            std::vector<I> narrowed(indices.size());
+            std::ranges::transform(indices, narrowed.begin(), [](GLuint i) { return i == primitive_restart_marker ? std::numeric_limits<I>::max() : static_cast<I>(i); });
+            return narrowed;
+        }
+    };
+
+    /// A regular polygon with any number of vertices, for example a smooth circle, laid out as for polygon
+    template<gl_floating_point T, dimensionality ArenaDimension, class... Attributes>
+        requires (dimensionality{2} <= ArenaDimension) && (ArenaDimension <= dimensionality{4}) && (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class polygon_mesh : public mesh<sequoia::mem_ordered_tuple<local_coordinates<T, ArenaDimension>, Attributes...>> {
+    public:
+        using mesh_type             = mesh<sequoia::mem_ordered_tuple<local_coordinates<T, ArenaDimension>, Attributes...>>;
+        using vertex_attribute_type = mesh_type::vertex_type;
+        using vertices_type         = std::vector<vertex_attribute_type>;
+
+        template<class Fn>
+            requires std::is_invocable_r_v<vertices_type, Fn, vertices_type>
+        polygon_mesh(const resourceful_context& ctx, std::size_t numVertices, mesh_topology topology, Fn transformer, const optional_label& label)
+            : mesh_type{ctx, transformer(make_vertices(numVertices)), make_indices(numVertices, topology), topology, label}
+        {}
+    private:
+        [[nodiscard]]
+        static vertices_type make_vertices(std::size_t numVertices) {
+            if(numVertices < 3)
+                throw std::runtime_error{std::format("polygon_mesh: {} vertices do not form a polygon", numVertices)};
+
+            vertices_type vertices{};
+            vertices.reserve(numVertices);
+            for(std::size_t i{}; i < numVertices; ++i)
+                vertices.push_back({make_polygon_attribute<local_coordinates<T, ArenaDimension>>{}(i, numVertices), make_polygon_attribute<Attributes>{}(i, numVertices)...});
+
+            return vertices;
+        }
+
+        [[nodiscard]]
+        static std::vector<GLuint> make_indices(std::size_t numVertices, mesh_topology topology) {
+            return topology == mesh_topology::triangles ? polygon_triangle_indices(numVertices) : polygon_strip_indices(numVertices);
+        }
+    };
+}
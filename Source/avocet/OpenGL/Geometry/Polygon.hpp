@@ -11,10 +11,31 @@
 
 #include "avocet/OpenGL/Resources/Buffers.hpp"
 #include "avocet/OpenGL/Resources/Textures.hpp"
+#include "avocet/OpenGL/Resources/VertexArrayCache.hpp"
 #include "sequoia/PlatformSpecific/Preprocessor.hpp"
 
 #include <limits>
 
+namespace avocet {
+    /// Texture coordinates quantised to half the size, or less, of those in single precision
+    template<opengl::gl_integral T>
+        requires std::is_unsigned_v<T>
+    struct make_polygon_attribute<opengl::normalized<T, 2>> {
+        [[nodiscard]]
+        opengl::normalized<T, 2> operator()(std::size_t i, std::size_t N) const {
+            return opengl::make_normalized<T>(std::span<const GLfloat, 2>{polygon_tex_coordinates<GLfloat>(i, N).values()});
+        }
+    };
+
+    template<>
+    struct make_polygon_attribute<opengl::half_float<2>> {
+        [[nodiscard]]
+        opengl::half_float<2> operator()(std::size_t i, std::size_t N) const {
+            return opengl::make_half_float(std::span<const GLfloat, 2>{polygon_tex_coordinates<GLfloat>(i, N).values()});
+        }
+    };
+}
+
 namespace avocet::opengl {
     template<std::floating_point T, std::size_t D, class Arena>
     struct is_legal_gl_buffer_value_type<sequoia::maths::vec_coords<T, D, Arena>>
@@ -22,6 +43,30 @@ namespace avocet::opengl {
     {
     };
 
+    /// Triangulates a convex N-gon as a fan about its first vertex; the indices depend only on N
+    template<std::size_t N>
+        requires (3 <= N) && (N <= 87)
+    struct polygon_elements {
+        using index_type = GLubyte;
+        constexpr static auto num_elements{3 * (N - 2)};
+        using element_array_type = std::array<index_type, num_elements>;
+
+        static_assert(num_elements <= std::numeric_limits<index_type>::max());
+
+        [[nodiscard]]
+        constexpr static index_type to_element_index(std::size_t i) noexcept {
+            const auto remainder{i % 3};
+            if(!remainder)
+                return 0;
+
+            return checked_conversion_to<index_type>(i / 3 + remainder);
+        }
+
+        constexpr static element_array_type indices{
+            sequoia::utilities::make_array<index_type, num_elements>(to_element_index)
+        };
+    };
+
     template<gl_floating_point T, std::size_t N, dimensionality ArenaDimension, class... Attributes>
         requires (3 <= N) && (dimensionality{2} <= ArenaDimension) && (ArenaDimension <= dimensionality{4}) && (is_legal_gl_buffer_value_type_v<Attributes> && ...)
     class polygon_base{
@@ -80,6 +125,29 @@ namespace avocet::opengl {
             self.bind_vao_and_draw();
         }
 
+        /// Draws through the vertex array which the cache holds for the vertex format, rather than through this
+        /// polygon's own, so that consecutive draws of polygons sharing the format do not switch vertex arrays
+        template<class Self>
+            requires (num_textures == 0)
+        void draw(this const Self& self, vertex_array_cache& cache) {
+            self.bind_shared_vao_and_draw(cache);
+        }
+
+        template<class Self>
+            requires (num_textures == 1)
+        void draw(this const Self& self, vertex_array_cache& cache, texture_unit unit) {
+            self.m_Textures.front().bind(unit);
+            self.bind_shared_vao_and_draw(cache);
+        }
+
+        template<class Self>
+        void draw(this const Self& self, vertex_array_cache& cache, std::span<const texture_unit, num_textures> units) {
+            for(const auto[texture, unit] : std::views::zip(self.m_Textures, units))
+                texture.bind(unit);
+
+            self.bind_shared_vao_and_draw(cache);
+        }
+
         [[nodiscard]]
         friend bool operator==(const polygon_base&, const polygon_base&) noexcept = default;
     protected:
@@ -87,6 +155,9 @@ namespace avocet::opengl {
 
         polygon_base(polygon_base&&)            noexcept = default;
         polygon_base& operator=(polygon_base&&) noexcept = default;
+
+        template<gl_integral I>
+        void attach(const element_buffer_object<I>& ebo) const { m_VAO.attach(ebo); }
     private:
         const inline static vertices_type st_Vertices{make_polygon<T, N, ArenaDimension, Attributes...>{}()};
 
@@ -99,6 +170,11 @@ namespace avocet::opengl {
             self.m_VAO.bind();
             self.do_draw(self.m_VAO.context());
         }
+
+        template<class Self>
+        void bind_shared_vao_and_draw(this const Self& self, vertex_array_cache& cache) {
+            self.do_draw(self.bind_buffers(cache, self.m_VBO).context());
+        }
     };
 
     template<gl_floating_point T, std::size_t N, dimensionality ArenaDimension, class... Attributes>
@@ -113,51 +189,42 @@ namespace avocet::opengl {
             requires std::is_invocable_r_v<vertices_type, Fn, vertices_type> && (num_textures == 0)
         polygon(const resourceful_context& ctx, Fn transformer, const std::optional<std::string>& label)
             : polygon_base_type{ctx, transformer, label}
-            ,             m_EBO{ctx, st_Indices, label}
+            ,             m_EBO{ctx, elements_type::indices, label}
         {
+            this->attach(m_EBO);
         }
 
         template<class Fn>
             requires std::is_invocable_r_v<vertices_type, Fn, vertices_type> && (num_textures == 1)
         polygon(const resourceful_context& ctx, Fn transformer, const texture_2d_configurator& texConfig, const std::optional<std::string>& label)
             : polygon_base_type{ctx, transformer, texConfig, label}
-            ,             m_EBO{ctx, st_Indices, label}
+            ,             m_EBO{ctx, elements_type::indices, label}
         {
+            this->attach(m_EBO);
         }
 
         template<class Fn>
             requires std::is_invocable_r_v<vertices_type, Fn, vertices_type>
         polygon(const resourceful_context& ctx, Fn transformer, std::span<const texture_2d_configurator, num_textures> texConfigs, const std::optional<std::string>& label)
             : polygon_base_type{ctx, transformer, texConfigs, label}
-            , m_EBO{ctx, st_Indices, label}
+            , m_EBO{ctx, elements_type::indices, label}
         {
+            this->attach(m_EBO);
         }
     private:
         friend polygon_base_type;
 
-        using element_index_type = GLubyte;
-        constexpr static auto num_elements{3 * (N - 2)};
-        using element_array_type = std::array<element_index_type, num_elements>;
-
-        static_assert(num_elements <= std::numeric_limits<element_index_type>::max());
-
-        [[nodiscard]]
-        constexpr static element_index_type to_element_index(std::size_t i) noexcept {
-            const auto remainder{i % 3};
-            if(!remainder)
-                return 0;
-
-            return checked_conversion_to<element_index_type>(i / 3 + remainder);
-        }
-
-        constexpr static element_array_type st_Indices{
-            sequoia::utilities::make_array<element_index_type, num_elements>(to_element_index)
-        };
+        using elements_type      = polygon_elements<N>;
+        using element_index_type = elements_type::index_type;
+        constexpr static auto num_elements{elements_type::num_elements};
 
         static void do_draw(const decorated_context& ctx) {
-            gl_function{&GladGLContext::DrawElements}(ctx, GL_TRIANGLES, num_elements, to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<element_index_type>), nullptr);
+            static_gl_function<&GladGLContext::DrawElements>{}(ctx, GL_TRIANGLES, num_elements, to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<element_index_type>), nullptr);
         }
 
+        template<class VertexBuffer>
+        const vertex_attribute_object& bind_buffers(vertex_array_cache& cache, const VertexBuffer& vbo) const { return cache.bind(vbo, m_EBO); }
+
         element_buffer_object<element_index_type> m_EBO;
 
     };
@@ -172,8 +239,11 @@ namespace avocet::opengl {
         friend polygon_base_type;
 
         static void do_draw(const decorated_context& ctx) {
-            gl_function{&GladGLContext::DrawArrays}(ctx, GL_TRIANGLES, 0, 3);
+            static_gl_function<&GladGLContext::DrawArrays>{}(ctx, GL_TRIANGLES, 0, 3);
         }
+
+        template<class VertexBuffer>
+        static const vertex_attribute_object& bind_buffers(vertex_array_cache& cache, const VertexBuffer& vbo) { return cache.bind(vbo); }
     };
 
     template<gl_floating_point T, dimensionality ArenaDimension, class... Attributes>
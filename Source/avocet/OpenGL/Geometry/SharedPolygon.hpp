@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace avocet::opengl {
+    template<gl_floating_point T, std::size_t N, dimensionality ArenaDimension, class... Attributes>
+        requires (N <= 87) && (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class shared_polygon;
+
+    /// The storage shared by every polygon of a given type: a single vertex array, a single element buffer and a
+    /// single vertex buffer, partitioned into slots of N vertices. Slot 0 holds the untransformed vertices, which
+    /// may be drawn many times with one call, the per-instance transforms being supplied by the shader, for
+    /// example from a uniform or storage block indexed by gl_InstanceID. The remaining slots are occupied by
+    /// shared_polygons, each drawn with a base-vertex offset. Textures, if any, are bound by the caller.
+    /// The geometry is pinned in memory, since polygons refer back to it.
+    template<gl_floating_point T, std::size_t N, dimensionality ArenaDimension, class... Attributes>
+        requires (N <= 87) && (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class polygon_geometry {
+    public:
+        using polygon_type          = shared_polygon<T, N, ArenaDimension, Attributes...>;
+        using vertex_attribute_type = polygon_base<T, N, ArenaDimension, Attributes...>::vertex_attribute_type;
+        using vertices_type         = polygon_base<T, N, ArenaDimension, Attributes...>::vertices_type;
+        constexpr static auto num_vertices{N};
+
+        /// Storage for the given number of shared_polygons is reserved up front; beyond this, it grows geometrically
+        polygon_geometry(const resourceful_context& ctx, const optional_label& label, std::size_t reservedPolygons = 0)
+            : m_Label{label}
+            , m_VBO{ctx, buffer_reservation{N * (reservedPolygons + 1)}, label}
+            , m_EBO{ctx, elements_type::indices, label}
+            , m_VAO{make_vao(ctx, label, m_VBO, m_EBO)}
+        {
+            m_VBO.update(0, st_Vertices);
+        }
+
+        polygon_geometry(const polygon_geometry&)            = delete;
+        polygon_geometry& operator=(const polygon_geometry&) = delete;
+
+        /// Draws the untransformed vertices the given number of times
+        void draw_instanced(this const polygon_geometry& self, std::size_t instances) {
+            self.m_VAO.bind();
+            static_gl_function<&GladGLContext::DrawElementsInstanced>{}(self.context(), GL_TRIANGLES, num_elements, element_type_specifier(), nullptr, checked_conversion_to<GLsizei>(instances));
+        }
+
+        /// The number of shared_polygons for which there is currently storage
+        [[nodiscard]]
+        std::size_t capacity() const noexcept { return m_VBO.size() / N - 1; }
+
+        [[nodiscard]]
+        std::size_t num_polygons() const noexcept { return m_Occupied - m_FreeSlots.size(); }
+
+        [[nodiscard]]
+        const decorated_context& context() const noexcept { return m_VAO.context(); }
+    private:
+        friend polygon_type;
+
+        using elements_type = polygon_elements<N>;
+        using vbo_type      = dynamic_vertex_buffer_object<vertex_attribute_type>;
+        constexpr static auto num_elements{elements_type::num_elements};
+
+        const inline static vertices_type st_Vertices{make_polygon<T, N, ArenaDimension, Attributes...>{}()};
+
+        optional_label m_Label{};
+        vbo_type m_VBO;
+        element_buffer_object<typename elements_type::index_type> m_EBO;
+        vertex_attribute_object m_VAO;
+        std::vector<std::size_t> m_FreeSlots{};
+        std::size_t m_Occupied{};
+
+        [[nodiscard]]
+        constexpr static GLenum element_type_specifier() noexcept {
+            return to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<typename elements_type::index_type>);
+        }
+
+        [[nodiscard]]
+        static vertex_attribute_object make_vao(const resourceful_context& ctx, const optional_label& label, const vbo_type& vbo, const element_buffer_object<typename elements_type::index_type>& ebo) {
+            vertex_attribute_object vao{ctx, label, vbo};
+            vao.attach(ebo);
+            return vao;
+        }
+
+        /// Slots are numbered from 1, slot 0 being reserved for the untransformed vertices
+        [[nodiscard]]
+        std::size_t acquire_slot() {
+            if(!m_FreeSlots.empty()) {
+                const auto slot{m_FreeSlots.back()};
+                m_FreeSlots.pop_back();
+                return slot;
+            }
+
+            if(m_Occupied == capacity())
+                grow(std::max(2 * capacity(), 1uz));
+
+            return ++m_Occupied;
+        }
+
+        void release_slot(std::size_t slot) noexcept { m_FreeSlots.push_back(slot); }
+
+        /// The vertex array refers to the vertex buffer by name, and so is rebuilt along with it
+        void grow(std::size_t polygons) {
+            const auto& ctx{m_VBO.context()};
+            vbo_type vbo{ctx, buffer_reservation{N * (polygons + 1)}, m_Label};
+            m_VBO.copy(vbo, {0, m_VBO.size()}, 0);
+            m_VAO = make_vao(ctx, m_Label, vbo, m_EBO);
+            m_VBO = std::move(vbo);
+        }
+
+        void write(std::size_t slot, const vertices_type& vertices) const { m_VBO.update(N * slot, vertices); }
+
+        void draw(std::size_t slot) const {
+            m_VAO.bind();
+            static_gl_function<&GladGLContext::DrawElementsBaseVertex>{}(context(), GL_TRIANGLES, num_elements, element_type_specifier(), nullptr, checked_conversion_to<GLint>(N * slot));
+        }
+    };
+
+    /// A polygon whose vertices occupy a slot of a polygon_geometry, rather than buffers of its own. Drawing
+    /// binds the vertex array shared by all polygons of the type, so that consecutive draws incur no rebinding.
+    template<gl_floating_point T, std::size_t N, dimensionality ArenaDimension, class... Attributes>
+        requires (N <= 87) && (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class [[nodiscard]] shared_polygon {
+    public:
+        using geometry_type = polygon_geometry<T, N, ArenaDimension, Attributes...>;
+        using vertices_type = geometry_type::vertices_type;
+
+        template<class Fn>
+            requires std::is_invocable_r_v<vertices_type, Fn, vertices_type>
+        shared_polygon(geometry_type& geometry, Fn transformer)
+            : m_Geometry{&geometry}
+            , m_Slot{geometry.acquire_slot()}
+        {
+            update(transformer);
+        }
+
+        shared_polygon(shared_polygon&& other) noexcept
+            : m_Geometry{std::exchange(other.m_Geometry, nullptr)}
+            , m_Slot{other.m_Slot}
+        {}
+
+        shared_polygon& operator=(shared_polygon&& other) noexcept {
+            std::ranges::swap(m_Geometry, other.m_Geometry);
+            std::ranges::swap(m_Slot, other.m_Slot);
+            return *this;
+        }
+
+        ~shared_polygon() { if(m_Geometry) m_Geometry->release_slot(m_Slot); }
+
+        /// Respecifies the vertices, starting once more from the untransformed ones
+        template<class Fn>
+            requires std::is_invocable_r_v<vertices_type, Fn, vertices_type>
+        void update(this const shared_polygon& self, Fn transformer) {
+            self.m_Geometry->write(self.m_Slot, transformer(geometry_type::st_Vertices));
+        }
+
+        void draw(this const shared_polygon& self) { self.m_Geometry->draw(self.m_Slot); }
+
+        /// The offset of the first vertex within the shared vertex buffer
+        [[nodiscard]]
+        std::size_t base_vertex() const noexcept { return N * m_Slot; }
+
+        [[nodiscard]]
+        bool is_null() const noexcept { return m_Geometry == nullptr; }
+    private:
+        geometry_type* m_Geometry{};
+        std::size_t m_Slot{};
+    };
+
+    template<gl_floating_point T, dimensionality ArenaDimension, class... Attributes>
+    using shared_triangle = shared_polygon<T, 3, ArenaDimension, Attributes...>;
+
+    template<gl_floating_point T, dimensionality ArenaDimension, class... Attributes>
+    using shared_quad = shared_polygon<T, 4, ArenaDimension, Attributes...>;
+}
@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Profiling/CallTracer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace avocet::opengl {
+    namespace {
+        /// Keyed by tracer id, which is never reused, so entries left behind by a destroyed tracer can never match.
+        /// Fixed in size, so that looking up a buffer never allocates; once full, entries are replaced in turn.
+        class buffer_cache {
+        public:
+            [[nodiscard]]
+            thread_trace_buffer* find(std::uint64_t tracerId) const noexcept {
+                const auto found{std::ranges::find(m_Entries, tracerId, &entry::tracer_id)};
+                return found != m_Entries.end() ? found->buffer : nullptr;
+            }
+
+            void insert(std::uint64_t tracerId, thread_trace_buffer* buffer) noexcept {
+                m_Entries[m_Next] = {tracerId, buffer};
+                m_Next = (m_Next + 1) % m_Entries.size();
+            }
+        private:
+            struct entry {
+                std::uint64_t tracer_id{};
+                thread_trace_buffer* buffer{};
+            };
+
+            std::array<entry, 4> m_Entries{};
+            std::size_t m_Next{};
+        };
+
+        thread_local buffer_cache t_Cache{};
+
+        std::atomic<std::uint64_t> s_NextTracerId{1};
+
+        [[nodiscard]]
+        std::string escape_json(std::string_view text) {
+            std::string escaped{};
+            escaped.reserve(text.size());
+            for(const char c : text) {
+                switch(c) {
+                case '"':  escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n";  break;
+                case '\t': escaped += "\\t";  break;
+                default:
+                    if(static_cast<unsigned char>(c) < 0x20)
+                        std::format_to(std::back_inserter(escaped), "\\u{:04x}", static_cast<unsigned>(c));
+                    else
+                        escaped += c;
+                }
+            }
+
+            return escaped;
+        }
+
+        [[nodiscard]]
+        std::string_view to_string(trace_category category) {
+            switch(category) {
+            case trace_category::gl_call: return "gl";
+            case trace_category::zone:    return "zone";
+            }
+
+            throw std::runtime_error{"trace_category: unrecognized value"};
+        }
+
+        [[nodiscard]]
+        double to_microseconds(std::chrono::nanoseconds t) {
+            return std::chrono::duration<double, std::micro>{t}.count();
+        }
+    }
+
+    thread_trace_buffer::thread_trace_buffer(events_per_thread capacity, std::size_t threadIndex, std::thread::id threadId)
+        : m_ThreadIndex{threadIndex}
+        , m_ThreadId{threadId}
+    {
+        m_Events.reserve(capacity.value);
+    }
+
+    void trace_prologue::operator()(const context&, const decorator_data&) const {
+        if(auto* pBuffer{m_Tracer->local_buffer()})
+            pBuffer->m_PendingStart = m_Tracer->now();
+    }
+
+    void trace_epilogue::operator()(const context& ctx, const decorator_data& data) const {
+        const auto end{m_Tracer->now()};
+        if(auto* pBuffer{m_Tracer->local_buffer()}) {
+            const auto start{pBuffer->m_PendingStart};
+            pBuffer->record({data.fn_name, data.loc, start - m_Tracer->m_Origin, end - start, trace_category::gl_call});
+        }
+
+        m_Next(ctx, data);
+    }
+
+    call_tracer::call_tracer(events_per_thread capacity)
+        : m_Id{s_NextTracerId.fetch_add(1, std::memory_order_relaxed)}
+        , m_Capacity{capacity}
+        , m_Origin{std::chrono::steady_clock::now()}
+    {}
+
+    void call_tracer::record(std::string_view name, std::source_location loc, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end, trace_category category) noexcept {
+        if(auto* pBuffer{local_buffer()})
+            pBuffer->record({name, loc, start - m_Origin, end - start, category});
+    }
+
+    [[nodiscard]]
+    thread_trace_buffer* call_tracer::local_buffer() noexcept {
+        if(auto* pBuffer{t_Cache.find(m_Id)})
+            return pBuffer;
+
+        try {
+            return &find_or_register_thread();
+        }
+        catch(...) {
+            return nullptr;
+        }
+    }
+
+    [[nodiscard]]
+    thread_trace_buffer& call_tracer::find_or_register_thread() {
+        const std::scoped_lock lock{m_Mutex};
+
+        const auto id{std::this_thread::get_id()};
+        auto found{std::ranges::find_if(m_Buffers, [id](const auto& pBuffer) { return pBuffer->m_ThreadId == id; })};
+        if(found == m_Buffers.end())
+            found = m_Buffers.insert(m_Buffers.end(), std::make_unique<thread_trace_buffer>(m_Capacity, m_Buffers.size(), id));
+
+        t_Cache.insert(m_Id, found->get());
+        return **found;
+    }
+
+    void call_tracer::write_chrome_trace(std::ostream& stream) const {
+        const std::scoped_lock lock{m_Mutex};
+
+        stream << "{\"traceEvents\":[";
+        bool first{true};
+        for(const auto& pBuffer : m_Buffers) {
+            for(const auto& event : pBuffer->events()) {
+                stream << (first ? "\n" : ",\n")
+                       << std::format(
+                              R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":0,"tid":{},"args":{{"file":"{}","line":{}}}}})",
+                              escape_json(event.name),
+                              to_string(event.category),
+                              to_microseconds(event.start),
+                              to_microseconds(event.duration),
+                              pBuffer->thread_index(),
+                              escape_json(event.loc.file_name()),
+                              event.loc.line()
+                          );
+                first = false;
+            }
+        }
+
+        stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    void call_tracer::write_chrome_trace(const std::filesystem::path& file) const {
+        std::ofstream stream{file};
+        if(!stream)
+            throw std::runtime_error{std::format("call_tracer: unable to open {} for writing", file.generic_string())};
+
+        write_chrome_trace(stream);
+    }
+
+    void call_tracer::clear() {
+        const std::scoped_lock lock{m_Mutex};
+        for(auto& pBuffer : m_Buffers)
+            pBuffer->clear();
+    }
+
+    [[nodiscard]]
+    std::size_t call_tracer::num_dropped() const {
+        const std::scoped_lock lock{m_Mutex};
+        return std::ranges::fold_left(m_Buffers, std::size_t{}, [](std::size_t n, const auto& pBuffer) { return n + pBuffer->num_dropped(); });
+    }
+}
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Context/DecorationPolicy.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <source_location>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace avocet::opengl {
+    struct events_per_thread { std::size_t value{}; };
+
+    enum class trace_category { gl_call, zone };
+
+    struct trace_event {
+        std::string_view name{};
+        std::source_location loc{};
+        std::chrono::nanoseconds start{}, duration{};
+        trace_category category{};
+    };
+
+    class call_tracer;
+    class trace_prologue;
+    class trace_epilogue;
+
+    /// Events recorded on a single thread. Storage is reserved up front and events which
+    /// do not fit are counted but otherwise discarded, so recording never allocates.
+    class thread_trace_buffer {
+    public:
+        thread_trace_buffer(events_per_thread capacity, std::size_t threadIndex, std::thread::id threadId);
+
+        void record(const trace_event& event) noexcept {
+            if(m_Events.size() < m_Events.capacity())
+                m_Events.push_back(event);
+            else
+                ++m_NumDropped;
+        }
+
+        [[nodiscard]]
+        std::span<const trace_event> events() const noexcept { return m_Events; }
+
+        [[nodiscard]]
+        std::size_t thread_index() const noexcept { return m_ThreadIndex; }
+
+        [[nodiscard]]
+        std::size_t num_dropped() const noexcept { return m_NumDropped; }
+
+        void clear() noexcept {
+            m_Events.clear();
+            m_NumDropped = 0;
+        }
+    private:
+        friend call_tracer;
+        friend trace_prologue;
+        friend trace_epilogue;
+
+        std::vector<trace_event> m_Events{};
+        std::size_t m_ThreadIndex{}, m_NumDropped{};
+        std::thread::id m_ThreadId{};
+        std::chrono::steady_clock::time_point m_PendingStart{};
+    };
+
+    class trace_prologue {
+        call_tracer* m_Tracer{};
+    public:
+        explicit trace_prologue(call_tracer& tracer) noexcept : m_Tracer{&tracer} {}
+
+        void operator()(const context& ctx, const decorator_data& data) const;
+    };
+
+    class trace_epilogue {
+        call_tracer* m_Tracer{};
+        decoration_policy m_Next{};
+    public:
+        trace_epilogue(call_tracer& tracer, decoration_policy next) : m_Tracer{&tracer}, m_Next{std::move(next)} {}
+
+        void operator()(const context& ctx, const decorator_data& data) const;
+    };
+
+    /// Records the timing of each gl call, plus any user zones, into per-thread buffers, which
+    /// may be exported as Chrome / Perfetto trace-event JSON. The tracer must outlive any context
+    /// on which its decorators are installed; names of zones must outlive the tracer.
+    class call_tracer {
+    public:
+        explicit call_tracer(events_per_thread capacity);
+
+        call_tracer(const call_tracer&)            = delete;
+        call_tracer& operator=(const call_tracer&) = delete;
+
+        [[nodiscard]]
+        trace_prologue prologue() noexcept { return trace_prologue{*this}; }
+
+        /// Timing stops before next is invoked, so that, for example, error checking is not attributed to the call
+        [[nodiscard]]
+        trace_epilogue epilogue(decoration_policy next = {}) { return trace_epilogue{*this, std::move(next)}; }
+
+        [[nodiscard]]
+        std::chrono::steady_clock::time_point now() const noexcept { return std::chrono::steady_clock::now(); }
+
+        void record(std::string_view name, std::source_location loc, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end, trace_category category) noexcept;
+
+        /// Neither of these may be invoked while any thread is tracing
+        void write_chrome_trace(std::ostream& stream) const;
+
+        void write_chrome_trace(const std::filesystem::path& file) const;
+
+        void clear();
+
+        [[nodiscard]]
+        std::size_t num_dropped() const;
+    private:
+        friend trace_prologue;
+        friend trace_epilogue;
+
+        std::uint64_t m_Id{};
+        events_per_thread m_Capacity{};
+        std::chrono::steady_clock::time_point m_Origin{};
+        mutable std::mutex m_Mutex{};
+        std::vector<std::unique_ptr<thread_trace_buffer>> m_Buffers{};
+
+        /// Returns null only if a buffer for a new thread cannot be allocated. Buffers are cached per thread for a
+        /// few tracers at once, so that tracers used alternately on a thread do not each take the mutex on every call.
+        [[nodiscard]]
+        thread_trace_buffer* local_buffer() noexcept;
+
+        [[nodiscard]]
+        thread_trace_buffer& find_or_register_thread();
+    };
+
+    /// Scoped user zone; does nothing if the tracer is null
+    class [[nodiscard]] trace_zone {
+        call_tracer* m_Tracer{};
+        std::string_view m_Name{};
+        std::source_location m_Loc{};
+        std::chrono::steady_clock::time_point m_Start{};
+    public:
+        trace_zone(call_tracer* tracer, std::string_view name, std::source_location loc = std::source_location::current())
+            : m_Tracer{tracer}
+            , m_Name{name}
+            , m_Loc{loc}
+            , m_Start{tracer ? tracer->now() : std::chrono::steady_clock::time_point{}}
+        {}
+
+        trace_zone(const trace_zone&)            = delete;
+        trace_zone& operator=(const trace_zone&) = delete;
+
+        ~trace_zone() {
+            if(m_Tracer)
+                m_Tracer->record(m_Name, m_Loc, m_Start, m_Tracer->now(), trace_category::zone);
+        }
+    };
+}
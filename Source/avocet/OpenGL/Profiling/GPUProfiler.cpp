@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Profiling/GPUProfiler.hpp"
+#include "avocet/OpenGL/Context/Version.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+namespace avocet::opengl {
+    gpu_profiler::gpu_profiler(const resourceful_context& ctx, frames_in_flight frames, zones_per_frame zones)
+        : m_Context{&ctx}
+        , m_DebugGroups{debug_output_supported(ctx.fundamental_characteristics().version())}
+        , m_Slots(frames.value)
+    {
+        if(!frames.value)
+            throw std::runtime_error{"gpu_profiler: at least one frame must be in flight"};
+
+        for(auto& slot : m_Slots) {
+            slot.queries.reserve(2 * zones.value);
+            for(std::size_t i{}; i < 2 * zones.value; ++i)
+                slot.queries.emplace_back(ctx, null_label);
+
+            slot.zones.reserve(zones.value);
+        }
+
+        // The zones' groups are for the benefit of external captures; pushing and popping them should not be reported,
+        // though any other groups still are
+        if(m_DebugGroups && ctx.fundamental_characteristics().debug_output_enabled()) {
+            for(const GLenum groupType : {GL_DEBUG_TYPE_PUSH_GROUP, GL_DEBUG_TYPE_POP_GROUP})
+                gl_function{&GladGLContext::DebugMessageControl}(ctx, GL_DEBUG_SOURCE_APPLICATION, groupType, GL_DONT_CARE, 1, &zone_group_id, GL_FALSE);
+        }
+
+        m_OpenZones.reserve(zones.value);
+        m_LatestTimings.reserve(zones.value);
+    }
+
+    void gpu_profiler::begin_frame() {
+        if(!m_OpenZones.empty())
+            throw std::runtime_error{std::format("gpu_profiler::begin_frame: {} zone(s) still open", m_OpenZones.size())};
+
+        const auto numSlots{m_Slots.size()};
+        for(std::size_t i{}; i < numSlots; ++i) {
+            auto& slot{m_Slots[(m_NumFrames + i) % numSlots]};
+            if(slot.in_flight && !try_collect(slot))
+                break;
+        }
+
+        auto& slot{m_Slots[m_NumFrames % numSlots]};
+        if(slot.in_flight) {
+            ++m_NumDroppedFrames;
+        }
+
+        slot.zones.clear();
+        slot.frame     = m_NumFrames++;
+        slot.in_flight = true;
+    }
+
+    void gpu_profiler::open_zone(std::string_view name) {
+        auto& slot{current_slot()};
+        if(m_DebugGroups)
+            gl_function{&GladGLContext::PushDebugGroup}(*m_Context, GL_DEBUG_SOURCE_APPLICATION, zone_group_id, checked_conversion_to<GLsizei>(name.size()), name.data());
+
+        // Each zone is timed by a pair of queries; the zones' capacity may exceed the number of pairs
+        if(slot.zones.size() < slot.queries.size() / 2) {
+            m_OpenZones.push_back(slot.zones.size());
+            slot.queries[2 * slot.zones.size()].record_timestamp();
+            slot.zones.push_back({name, m_OpenZones.size() - 1});
+        }
+        else {
+            m_OpenZones.push_back(dropped_zone);
+            ++m_NumDroppedZones;
+        }
+    }
+
+    void gpu_profiler::close_zone() {
+        if(m_OpenZones.empty())
+            throw std::runtime_error{"gpu_profiler::close_zone: no open zone"};
+
+        const auto zone{m_OpenZones.back()};
+        m_OpenZones.pop_back();
+        if(zone != dropped_zone)
+            current_slot().queries[2 * zone + 1].record_timestamp();
+
+        if(m_DebugGroups)
+            gl_function{&GladGLContext::PopDebugGroup}(*m_Context);
+    }
+
+    [[nodiscard]]
+    gpu_profiler::frame_slot& gpu_profiler::current_slot() {
+        if(!m_NumFrames)
+            throw std::runtime_error{"gpu_profiler: begin_frame must be invoked before any zones are opened"};
+
+        return m_Slots[(m_NumFrames - 1) % m_Slots.size()];
+    }
+
+    [[nodiscard]]
+    bool gpu_profiler::try_collect(frame_slot& slot) {
+        const std::span issued{slot.queries.data(), 2 * slot.zones.size()};
+        if(!std::ranges::all_of(issued, [](const timestamp_query& q) { return q.result_available(); }))
+            return false;
+
+        m_LatestTimings.clear();
+        const auto origin{slot.zones.empty() ? GLuint64{} : issued.front().result()};
+        for(std::size_t i{}; i < slot.zones.size(); ++i) {
+            const auto begin{issued[2 * i].result()}, end{issued[2 * i + 1].result()};
+            m_LatestTimings.push_back({
+                slot.zones[i].name,
+                slot.zones[i].depth,
+                std::chrono::nanoseconds{begin - origin},
+                std::chrono::nanoseconds{end - begin}
+            });
+        }
+
+        m_LatestFrame  = slot.frame;
+        slot.in_flight = false;
+        return true;
+    }
+}
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Resources/Queries.hpp"
+
+#include <chrono>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace avocet::opengl {
+    struct frames_in_flight { std::size_t value{}; };
+
+    struct zones_per_frame { std::size_t value{}; };
+
+    struct gpu_zone_timing {
+        std::string_view name{};
+        std::size_t depth{};
+        std::chrono::nanoseconds start{}, duration{};
+
+        [[nodiscard]]
+        friend bool operator==(const gpu_zone_timing&, const gpu_zone_timing&) noexcept = default;
+    };
+
+    /// Times zones of gpu work with pairs of GL_TIMESTAMP queries which, unlike GL_TIME_ELAPSED,
+    /// allows zones to nest. Each frame in flight has its own queries; a frame's results are read
+    /// back, without stalling, only once the frame's queries are about to be reused, by which time
+    /// they are very likely to be available. If they are not, the frame is dropped. Zone names
+    /// must outlive the profiler. Where supported, each zone is also pushed as a debug group.
+    class gpu_profiler {
+    public:
+        gpu_profiler(const resourceful_context& ctx, frames_in_flight frames, zones_per_frame zones);
+
+        gpu_profiler(const gpu_profiler&)            = delete;
+        gpu_profiler& operator=(const gpu_profiler&) = delete;
+
+        void begin_frame();
+
+        void open_zone(std::string_view name);
+
+        void close_zone();
+
+        /// Timings of the most recently completed frame, with starts relative to the frame's first zone
+        [[nodiscard]]
+        std::span<const gpu_zone_timing> latest_timings() const noexcept { return m_LatestTimings; }
+
+        [[nodiscard]]
+        std::optional<std::size_t> latest_frame() const noexcept { return m_LatestFrame; }
+
+        [[nodiscard]]
+        std::size_t num_dropped_zones() const noexcept { return m_NumDroppedZones; }
+
+        [[nodiscard]]
+        std::size_t num_dropped_frames() const noexcept { return m_NumDroppedFrames; }
+    private:
+        struct zone_record {
+            std::string_view name{};
+            std::size_t depth{};
+        };
+
+        struct frame_slot {
+            std::vector<timestamp_query> queries{};
+            std::vector<zone_record> zones{};
+            std::size_t frame{};
+            bool in_flight{};
+        };
+
+        constexpr static auto dropped_zone{static_cast<std::size_t>(-1)};
+
+        /// Identifies the debug groups pushed for zones, so that only their messages are silenced
+        constexpr static GLuint zone_group_id{0x7a6f6e65};
+
+        const resourceful_context* m_Context{};
+        bool m_DebugGroups{};
+        std::vector<frame_slot> m_Slots{};
+        std::vector<std::size_t> m_OpenZones{};
+        std::vector<gpu_zone_timing> m_LatestTimings{};
+        std::optional<std::size_t> m_LatestFrame{};
+        std::size_t m_NumFrames{}, m_NumDroppedZones{}, m_NumDroppedFrames{};
+
+        [[nodiscard]]
+        frame_slot& current_slot();
+
+        [[nodiscard]]
+        bool try_collect(frame_slot& slot);
+    };
+
+    /// Scoped gpu zone; does nothing if the profiler is null
+    class [[nodiscard]] gpu_zone {
+        gpu_profiler* m_Profiler{};
+    public:
+        gpu_zone(gpu_profiler* profiler, std::string_view name)
+            : m_Profiler{profiler}
+        {
+            if(m_Profiler)
+                m_Profiler->open_zone(name);
+        }
+
+        gpu_zone(const gpu_zone&)            = delete;
+        gpu_zone& operator=(const gpu_zone&) = delete;
+
+        ~gpu_zone() {
+            if(m_Profiler)
+                m_Profiler->close_zone();
+        }
+    };
+}
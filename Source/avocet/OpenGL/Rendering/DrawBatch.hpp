@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Resources/BufferArena.hpp"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace avocet::opengl {
+    /// The layout consumed by glMultiDrawElementsIndirect
+    struct draw_elements_indirect_command {
+        GLuint count{}, instance_count{}, first_index{};
+        GLint  base_vertex{};
+        GLuint base_instance{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const draw_elements_indirect_command&, const draw_elements_indirect_command&) noexcept = default;
+    };
+
+    template<>
+    struct is_legal_gl_buffer_value_type<draw_elements_indirect_command> : std::true_type {};
+
+    /// Sizes are in bytes, and must be powers of two
+    struct draw_batch_configurator {
+        std::size_t page_size{1 << 20}, min_block_size{256};
+        optional_label label;
+    };
+
+    /// Gathered by the most recent call to draw
+    struct draw_batch_statistics {
+        std::size_t draws{}, multi_draws{}, commands_uploaded{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const draw_batch_statistics&, const draw_batch_statistics&) noexcept = default;
+    };
+
+    /// Gathers indexed triangle meshes sharing a vertex format, and so a program, into suballocated storage, drawing
+    /// them with one glMultiDrawElementsIndirect per pair of vertex and index pages. Commands are kept on the CPU and
+    /// only those which have changed are uploaded. Each draw is identified by its base instance, which the vertex
+    /// shader receives as the unsigned integer attribute at draw_id_location, for indexing per-draw data. Unlike
+    /// gl_BaseInstance, which requires GLSL 4.60 or ARB_shader_draw_parameters, this works wherever multi-draw
+    /// indirect does. The batch is pinned in memory, as are its arenas.
+    template<class Vertex>
+        requires is_legal_gl_buffer_value_type_v<Vertex>
+    class draw_batch {
+    public:
+        using vertex_type = Vertex;
+        using index_type  = GLuint;
+
+        constexpr static GLuint draw_id_location{num_vertex_locations_v<vertex_type>};
+
+        draw_batch(const resourceful_context& ctx, const draw_batch_configurator& config)
+            : m_Label{config.label}
+            , m_Vertices{ctx, {.page_size{config.page_size}, .min_block_size{config.min_block_size}, .label{config.label}}}
+            , m_Indices{ctx, {.page_size{config.page_size}, .min_block_size{config.min_block_size}, .label{config.label}}}
+            , m_DrawIds{make_draw_ids(ctx, st_MinCommandCapacity, config.label)}
+        {
+            if(!multi_draw_indirect_supported(ctx.fundamental_characteristics().version()))
+                throw std::runtime_error{"draw_batch: multi-draw indirect requires OpenGL 4.3"};
+        }
+
+        draw_batch(const draw_batch&)            = delete;
+        draw_batch& operator=(const draw_batch&) = delete;
+
+        /// Indices are relative to the first of the vertices. The identifier returned, which is stable until
+        /// the draw is removed, is also its base instance.
+        [[nodiscard]]
+        std::size_t add(std::span<const vertex_type> vertices, std::span<const index_type> indices, GLuint instanceCount = 1) {
+            if(vertices.empty() || indices.empty())
+                throw std::runtime_error{std::format("draw_batch::add: cannot draw {} vertices with {} indices", vertices.size(), indices.size())};
+
+            auto vertexAllocation{m_Vertices.template allocate<vertex_type>(vertices.size())};
+            auto indexAllocation{m_Indices.template allocate<index_type>(indices.size())};
+            m_Vertices.write(vertexAllocation, vertices);
+            m_Indices.write(indexAllocation, indices);
+
+            const auto vertexLocation{m_Vertices.locate(vertexAllocation)};
+            const auto indexLocation{m_Indices.locate(indexAllocation)};
+            const auto g{find_or_make_group(vertexLocation.page, indexLocation.page)};
+            const auto id{acquire_id()};
+
+            auto& group{m_Groups[g]};
+            group.commands.push_back({
+                .count{checked_conversion_to<GLuint>(indices.size())},
+                .instance_count{instanceCount},
+                .first_index{checked_conversion_to<GLuint>(indexLocation.offset / sizeof(index_type))},
+                .base_vertex{checked_conversion_to<GLint>(vertexLocation.offset / sizeof(vertex_type))},
+                .base_instance{checked_conversion_to<GLuint>(id)}
+            });
+            group.ids.push_back(id);
+            group.touch(group.commands.size() - 1);
+
+            m_Entries[id].emplace(std::move(vertexAllocation), std::move(indexAllocation), g, group.commands.size() - 1);
+            return id;
+        }
+
+        /// The last command of the group is moved into the place of the one removed, so that at most one is uploaded
+        void remove(std::size_t id) {
+            auto& e{entry(id, "remove")};
+            auto& group{m_Groups[e.group]};
+            if(const auto last{group.commands.size() - 1}; e.position != last) {
+                group.commands[e.position] = group.commands[last];
+                group.ids[e.position]      = group.ids[last];
+                m_Entries[group.ids[last]]->position = e.position;
+                group.touch(e.position);
+            }
+
+            group.commands.pop_back();
+            group.ids.pop_back();
+            m_Entries[id].reset();
+            m_FreeIds.push_back(id);
+        }
+
+        /// Overwrites vertices in place, leaving the commands untouched
+        void update_vertices(std::size_t id, std::span<const vertex_type> vertices, std::size_t first = 0) {
+            m_Vertices.write(entry(id, "update_vertices").vertices, vertices, first);
+        }
+
+        void set_instance_count(std::size_t id, GLuint instanceCount) {
+            const auto& e{entry(id, "set_instance_count")};
+            auto& group{m_Groups[e.group]};
+            group.commands[e.position].instance_count = instanceCount;
+            group.touch(e.position);
+        }
+
+        [[nodiscard]]
+        const draw_elements_indirect_command& command(this const draw_batch& self, std::size_t id) {
+            const auto& e{self.entry(id, "command")};
+            return self.m_Groups[e.group].commands[e.position];
+        }
+
+        [[nodiscard]]
+        std::size_t num_draws() const noexcept { return m_Entries.size() - m_FreeIds.size(); }
+
+        /// Uploads the commands changed since the previous call, and then issues the multi-draws
+        void draw() {
+            m_Statistics = {};
+            if(m_Entries.size() > m_DrawIds.size())
+                grow_draw_ids();
+
+            for(auto& group : m_Groups) {
+                if(group.commands.empty())
+                    continue;
+
+                m_Statistics.commands_uploaded += group.upload(m_Label);
+
+                const auto& ctx{group.vao.context()};
+                group.vao.bind();
+                group.buffer.bind();
+                static_gl_function<&GladGLContext::MultiDrawElementsIndirect>{}(ctx, GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, checked_conversion_to<GLsizei>(group.commands.size()), 0);
+
+                ++m_Statistics.multi_draws;
+                m_Statistics.draws += group.commands.size();
+            }
+        }
+
+        [[nodiscard]]
+        const draw_batch_statistics& statistics() const noexcept { return m_Statistics; }
+    private:
+        using command_buffer_type = indirect_buffer_object<draw_elements_indirect_command>;
+        using draw_id_buffer_type = vertex_buffer_object<sequoia::mem_ordered_tuple<GLuint>>;
+
+        constexpr static std::size_t st_MinCommandCapacity{16};
+
+        /// The draw id is fetched from base_instance + instance / divisor; a divisor of one would advance it with each instance
+        constexpr static GLuint st_DrawIdDivisor{std::numeric_limits<GLuint>::max()};
+
+        struct batch_entry {
+            arena_allocation<buffer_species::array> vertices;
+            arena_allocation<buffer_species::element_array> indices;
+            std::size_t group{}, position{};
+        };
+
+        struct draw_group {
+            std::size_t vertex_page{}, index_page{};
+            vertex_attribute_object vao;
+            command_buffer_type buffer;
+            std::vector<draw_elements_indirect_command> commands{};
+            std::vector<std::size_t> ids{};
+            std::size_t dirty_begin{std::numeric_limits<std::size_t>::max()}, dirty_end{};
+
+            void touch(std::size_t position) noexcept {
+                dirty_begin = std::min(dirty_begin, position);
+                dirty_end   = std::max(dirty_end, position + 1);
+            }
+
+            /// Returns the number of commands uploaded
+            std::size_t upload(const optional_label& label) {
+                if(commands.size() > buffer.size()) {
+                    buffer = command_buffer_type{buffer.context(), buffer_reservation{std::max(2 * buffer.size(), commands.size())}, label};
+                    dirty_begin = 0;
+                    dirty_end   = commands.size();
+                }
+
+                const auto end{std::min(dirty_end, commands.size())};
+                const auto uploaded{dirty_begin < end ? end - dirty_begin : 0};
+                if(uploaded)
+                    buffer.update(dirty_begin, std::span{commands}.subspan(dirty_begin, uploaded));
+
+                dirty_begin = std::numeric_limits<std::size_t>::max();
+                dirty_end   = 0;
+                return uploaded;
+            }
+        };
+
+        optional_label m_Label{};
+        vertex_arena m_Vertices;
+        element_arena m_Indices;
+        draw_id_buffer_type m_DrawIds;
+        std::vector<draw_group> m_Groups{};
+        std::vector<std::optional<batch_entry>> m_Entries{};
+        std::vector<std::size_t> m_FreeIds{};
+        draw_batch_statistics m_Statistics{};
+
+        [[nodiscard]]
+        auto& entry(this auto& self, std::size_t id, std::string_view fn) {
+            if((id >= self.m_Entries.size()) || !self.m_Entries[id])
+                throw std::runtime_error{std::format("draw_batch::{}: no draw with id {}", fn, id)};
+
+            return *self.m_Entries[id];
+        }
+
+        [[nodiscard]]
+        std::size_t acquire_id() {
+            if(m_FreeIds.empty()) {
+                m_Entries.emplace_back();
+                return m_Entries.size() - 1;
+            }
+
+            const auto id{m_FreeIds.back()};
+            m_FreeIds.pop_back();
+            return id;
+        }
+
+        /// Holds 0, 1, ..., n - 1, such that each draw fetches its own id
+        [[nodiscard]]
+        static draw_id_buffer_type make_draw_ids(const resourceful_context& ctx, std::size_t n, const optional_label& label) {
+            std::vector<sequoia::mem_ordered_tuple<GLuint>> ids{};
+            ids.reserve(n);
+            for(std::size_t i{}; i < n; ++i)
+                ids.push_back(sequoia::mem_ordered_tuple<GLuint>{checked_conversion_to<GLuint>(i)});
+
+            return draw_id_buffer_type{ctx, ids, label};
+        }
+
+        [[nodiscard]]
+        vertex_attribute_object make_vertex_array(std::size_t vertexPage, std::size_t indexPage) const {
+            const auto& vertexPageBuffer{m_Vertices.page(vertexPage)};
+            vertex_attribute_object vao{vertexPageBuffer.context(), m_Label, vertexPageBuffer, vertex_layout<vertex_type>, m_DrawIds, st_DrawIdDivisor};
+            vao.attach(m_Indices.page(indexPage));
+            return vao;
+        }
+
+        /// The vertex arrays refer to the buffer of draw ids, and so are remade along with it
+        void grow_draw_ids() {
+            m_DrawIds = make_draw_ids(m_DrawIds.context(), std::max(2 * m_DrawIds.size(), m_Entries.size()), m_Label);
+            for(auto& group : m_Groups)
+                group.vao = make_vertex_array(group.vertex_page, group.index_page);
+        }
+
+        [[nodiscard]]
+        std::size_t find_or_make_group(std::size_t vertexPage, std::size_t indexPage) {
+            const auto found{std::ranges::find_if(m_Groups, [=](const draw_group& g) { return (g.vertex_page == vertexPage) && (g.index_page == indexPage); })};
+            if(found != m_Groups.end())
+                return static_cast<std::size_t>(std::ranges::distance(m_Groups.begin(), found));
+
+            const auto& ctx{m_Vertices.page(vertexPage).context()};
+            m_Groups.push_back({vertexPage, indexPage, make_vertex_array(vertexPage, indexPage), command_buffer_type{ctx, buffer_reservation{st_MinCommandCapacity}, m_Label}});
+            return m_Groups.size() - 1;
+        }
+    };
+}
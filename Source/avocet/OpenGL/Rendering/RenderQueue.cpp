@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Rendering/RenderQueue.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace avocet::opengl {
+    namespace {
+        /// Key layout, from the most significant bit:
+        ///   layer (4) | ordering (2) | program (10) | state (10) | textures (14) | depth (24)
+        /// except for back_to_front, for which the inverted depth is promoted above the program
+        constexpr std::size_t layer_bits{4}, ordering_bits{2}, program_bits{10}, state_bits{10}, texture_bits{14}, depth_bits{24};
+
+        static_assert(layer_bits + ordering_bits + program_bits + state_bits + texture_bits + depth_bits == 64);
+
+        constexpr std::uint64_t max_depth{(std::uint64_t{1} << depth_bits) - 1};
+
+        template<std::size_t Bits, class Key>
+        [[nodiscard]]
+        std::uint16_t intern(std::unordered_map<Key, std::uint16_t>& ids, const Key& key, std::size_t firstId, std::string_view description) {
+            if(const auto found{ids.find(key)}; found != ids.end())
+                return found->second;
+
+            const auto id{firstId + ids.size()};
+            if(id >= (std::size_t{1} << Bits))
+                throw std::runtime_error{std::format("render_queue: more than {} distinct {} in a single frame", (std::size_t{1} << Bits) - firstId, description)};
+
+            ids.emplace(key, static_cast<std::uint16_t>(id));
+            return static_cast<std::uint16_t>(id);
+        }
+
+        [[nodiscard]]
+        std::uint64_t quantize(draw_depth depth) {
+            const auto clamped{std::isnan(depth.value) ? 0.0 : std::clamp(static_cast<double>(depth.value), 0.0, 1.0)};
+            return static_cast<std::uint64_t>(std::lround(clamped * max_depth));
+        }
+
+        [[nodiscard]]
+        std::uint64_t make_sort_key(render_layer layer, std::uint64_t program, std::uint64_t state, std::uint64_t textures, draw_depth depth) {
+            if(layer.index >= (1 << layer_bits))
+                throw std::runtime_error{std::format("render_queue: layer index {} exceeds the maximum of {}", layer.index, (1 << layer_bits) - 1)};
+
+            const auto prefix{(std::uint64_t{layer.index} << (64 - layer_bits)) | (std::uint64_t{std::to_underlying(layer.ordering)} << (64 - layer_bits - ordering_bits))};
+
+            switch(layer.ordering) {
+            case layer_ordering::by_state:
+                return prefix
+                    | (program  << (state_bits + texture_bits + depth_bits))
+                    | (state    << (texture_bits + depth_bits))
+                    | (textures << depth_bits)
+                    | quantize(depth);
+            case layer_ordering::back_to_front:
+                return prefix
+                    | ((max_depth - quantize(depth)) << (program_bits + state_bits + texture_bits))
+                    | (program  << (state_bits + texture_bits))
+                    | (state    << texture_bits)
+                    | textures;
+            case layer_ordering::as_submitted:
+                return prefix;
+            }
+
+            throw std::runtime_error{"render_queue: unrecognized layer ordering"};
+        }
+    }
+
+    void radix_sort(std::vector<sort_entry>& entries, std::vector<sort_entry>& buffer) {
+        constexpr std::size_t radix{256}, numPasses{sizeof(std::uint64_t)};
+
+        std::array<std::array<std::size_t, radix>, numPasses> histograms{};
+        for(const auto& entry : entries) {
+            for(std::size_t pass{}; pass < numPasses; ++pass)
+                ++histograms[pass][(entry.key >> (8 * pass)) & (radix - 1)];
+        }
+
+        buffer.resize(entries.size());
+        for(std::size_t pass{}; pass < numPasses; ++pass) {
+            auto& offsets{histograms[pass]};
+            if(std::ranges::contains(offsets, entries.size()))
+                continue;
+
+            std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), std::size_t{});
+            for(const auto& entry : entries)
+                buffer[offsets[(entry.key >> (8 * pass)) & (radix - 1)]++] = entry;
+
+            entries.swap(buffer);
+        }
+    }
+
+    void render_queue::do_submit(const shader_program& program, const capable_context::state_block& block, const void* textureOwner, draw_item item, render_layer layer, draw_depth depth) {
+        if(m_Items.size() >= std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error{"render_queue: too many draws in a single frame"};
+
+        item.program = intern<program_bits>(m_ProgramIds, &program, 0, "programs");
+        if(item.program == m_Programs.size())
+            m_Programs.push_back(&program);
+
+        item.state = intern<state_bits>(m_StateIds, block.key(), 0, "state blocks");
+        if(item.state == m_Blocks.size())
+            m_Blocks.push_back(block);
+
+        // Id zero is reserved for draws without textures
+        if(textureOwner)
+            item.textures = intern<texture_bits>(m_TextureIds, textureOwner, 1, "texture sets");
+
+        m_Keys.push_back({make_sort_key(layer, item.program, item.state, item.textures, depth), static_cast<std::uint32_t>(m_Items.size())});
+        m_Items.push_back(std::move(item));
+    }
+
+    render_queue_statistics render_queue::flush() {
+        radix_sort(m_Keys, m_Buffer);
+
+        render_queue_statistics stats{};
+        const draw_item* prev{};
+        try {
+            for(const auto& entry : m_Keys) {
+                const auto& item{m_Items[entry.index]};
+                if(!prev || (item.state != prev->state)) {
+                    m_Context.new_payload(m_Blocks[item.state]);
+                    ++stats.state_changes;
+                }
+
+                if(!prev || (item.program != prev->program)) {
+                    m_Programs[item.program]->use();
+                    ++stats.program_changes;
+                }
+
+                if(item.textures && (!prev || (item.textures != prev->textures)))
+                    ++stats.texture_changes;
+
+                if(item.prepare)
+                    item.prepare();
+
+                item.draw(item.drawable, item.units.data());
+                ++stats.draws;
+                prev = &item;
+            }
+        }
+        catch(...) {
+            clear();
+            throw;
+        }
+
+        clear();
+        return stats;
+    }
+
+    void render_queue::clear() {
+        m_Items.clear();
+        m_Keys.clear();
+        m_Programs.clear();
+        m_Blocks.clear();
+        m_ProgramIds.clear();
+        m_StateIds.clear();
+        m_TextureIds.clear();
+    }
+}
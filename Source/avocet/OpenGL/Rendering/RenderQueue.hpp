@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Resources/ShaderProgram.hpp"
+#include "avocet/OpenGL/Resources/Textures.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace avocet::opengl {
+    /// How the draws within a layer are ordered relative to one another
+    enum class layer_ordering : std::uint8_t {
+        by_state,      ///< Minimizes changes of program, then state, then textures; ties are broken front to back
+        back_to_front, ///< For transparency: depth dominates, with changes minimized only between draws at equal depth
+        as_submitted   ///< For order-dependent effects, such as stencil writes followed by stencil tests
+    };
+
+    /// Layers are drawn in ascending order of index, so that constraints such as opaque before transparent,
+    /// or stencil writes before stencil tests, may be expressed. The index must be less than 16.
+    struct render_layer {
+        std::uint8_t index{};
+        layer_ordering ordering{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const render_layer&, const render_layer&) noexcept = default;
+    };
+
+    /// Normalized depth; values outside [0, 1] are clamped
+    struct draw_depth {
+        GLfloat value{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const draw_depth&, const draw_depth&) noexcept = default;
+    };
+
+    struct draw_options {
+        render_layer layer{};
+        draw_depth depth{};
+        /// Invoked once the program is in use, for example to set uniforms; must not change the program in use
+        std::function<void()> prepare{};
+    };
+
+    struct sort_entry {
+        std::uint64_t key{};
+        std::uint32_t index{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const sort_entry&, const sort_entry&) noexcept = default;
+    };
+
+    /// Stable, least-significant-byte first; passes over bytes shared by every key are skipped
+    void radix_sort(std::vector<sort_entry>& entries, std::vector<sort_entry>& buffer);
+
+    struct render_queue_statistics {
+        std::size_t draws{}, program_changes{}, state_changes{}, texture_changes{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const render_queue_statistics&, const render_queue_statistics&) noexcept = default;
+    };
+
+    template<class T>
+    concept queueable_polygon =
+           requires { typename T::polygon_base_type; }
+        && std::derived_from<T, typename T::polygon_base_type>;
+
+    /// Draws are submitted during a frame and issued by flush, sorted by a 64-bit key built from
+    /// the layer, program, state block, textures and depth. Programs, state blocks and polygons
+    /// must outlive the subsequent flush; state blocks must be made by the queue's context.
+    class render_queue {
+    public:
+        constexpr static std::size_t max_textures_per_draw{8};
+
+        explicit render_queue(const capable_context& ctx)
+            : m_Context{ctx}
+        {}
+
+        render_queue(const render_queue&)            = delete;
+        render_queue& operator=(const render_queue&) = delete;
+
+        template<queueable_polygon Polygon>
+            requires (Polygon::num_textures <= max_textures_per_draw)
+        void submit(const shader_program& program, const capable_context::state_block& block, const Polygon& poly, std::span<const texture_unit, Polygon::num_textures> units, draw_options options = {}) {
+            draw_item item{
+                .drawable{&poly},
+                .draw{&draw_polygon<Polygon>},
+                .units{},
+                .prepare{std::move(options.prepare)}
+            };
+
+            std::ranges::copy(units, item.units.begin());
+            do_submit(program, block, Polygon::num_textures ? &poly : nullptr, std::move(item), options.layer, options.depth);
+        }
+
+        template<queueable_polygon Polygon>
+            requires (Polygon::num_textures == 0)
+        void submit(const shader_program& program, const capable_context::state_block& block, const Polygon& poly, draw_options options = {}) {
+            submit(program, block, poly, std::span<const texture_unit, 0>{}, std::move(options));
+        }
+
+        template<queueable_polygon Polygon>
+            requires (Polygon::num_textures == 1)
+        void submit(const shader_program& program, const capable_context::state_block& block, const Polygon& poly, texture_unit unit, draw_options options = {}) {
+            submit(program, block, poly, std::span<const texture_unit, 1>{&unit, 1}, std::move(options));
+        }
+
+        /// Sorts and issues all submitted draws, after which the queue is empty
+        render_queue_statistics flush();
+
+        void clear();
+
+        [[nodiscard]]
+        std::size_t size() const noexcept { return m_Items.size(); }
+    private:
+        struct draw_item {
+            const void* drawable{};
+            void (*draw)(const void*, const texture_unit*){};
+            std::array<texture_unit, max_textures_per_draw> units{};
+            std::function<void()> prepare{};
+            std::uint16_t program{}, state{}, textures{};
+        };
+
+        const capable_context& m_Context;
+        std::vector<draw_item> m_Items{};
+        std::vector<sort_entry> m_Keys{}, m_Buffer{};
+        std::vector<const shader_program*> m_Programs{};
+        std::vector<capable_context::state_block> m_Blocks{};
+        std::unordered_map<const shader_program*, std::uint16_t> m_ProgramIds{};
+        std::unordered_map<std::uint64_t, std::uint16_t> m_StateIds{};
+        std::unordered_map<const void*, std::uint16_t> m_TextureIds{};
+
+        template<queueable_polygon Polygon>
+        static void draw_polygon(const void* poly, const texture_unit* units) {
+            static_cast<const Polygon*>(poly)->draw(std::span<const texture_unit, Polygon::num_textures>{units, Polygon::num_textures});
+        }
+
+        /// Textures are owned by polygons, and so are identified by the address of their owner
+        void do_submit(const shader_program& program, const capable_context::state_block& block, const void* textureOwner, draw_item item, render_layer layer, draw_depth depth);
+    };
+}
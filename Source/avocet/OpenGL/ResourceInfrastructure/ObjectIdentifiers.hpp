@@ -28,6 +28,10 @@ namespace avocet::opengl {
         not_applicable,
         opt_out,
         program,
-        framebuffer
+        framebuffer,
+        vertex_array,
+        array_buffer,
+        element_array_buffer,
+        texture_2d
     };
 }
\ No newline at end of file
@@ -0,0 +1,305 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/Core/Memory/BuddyAllocator.hpp"
+#include "avocet/OpenGL/Resources/Buffers.hpp"
+
+#include <algorithm>
+#include <format>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace avocet::opengl {
+    /// Sizes are in bytes, and must be powers of two
+    struct arena_configurator {
+        std::size_t page_size{};
+        std::size_t min_block_size{256};
+        optional_label label;
+    };
+
+    /// Where an allocation currently lives; the offset and size are in bytes
+    struct arena_location {
+        std::size_t page{}, offset{}, size{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const arena_location&, const arena_location&) noexcept = default;
+    };
+
+    /// In bytes, save for the counts. The difference between reserved and requested is lost to rounding
+    /// blocks up to powers of two; that between capacity and reserved is free, though not necessarily contiguous.
+    struct arena_statistics {
+        std::size_t pages{}, allocations{}, capacity{}, reserved{}, requested{}, largest_free_block{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const arena_statistics&, const arena_statistics&) noexcept = default;
+    };
+
+    template<buffer_species Species>
+    class buffer_arena;
+
+    /// Returns its storage to the arena on destruction
+    template<buffer_species Species>
+    class [[nodiscard]] arena_allocation {
+    public:
+        arena_allocation(arena_allocation&& other) noexcept
+            : m_Arena{std::exchange(other.m_Arena, nullptr)}
+            , m_Id{other.m_Id}
+        {}
+
+        arena_allocation& operator=(arena_allocation&& other) noexcept {
+            std::ranges::swap(m_Arena, other.m_Arena);
+            std::ranges::swap(m_Id, other.m_Id);
+            return *this;
+        }
+
+        ~arena_allocation() { if(m_Arena) m_Arena->release(m_Id); }
+
+        [[nodiscard]]
+        bool is_null() const noexcept { return m_Arena == nullptr; }
+    private:
+        friend buffer_arena<Species>;
+
+        buffer_arena<Species>* m_Arena{};
+        std::size_t m_Id{};
+
+        arena_allocation(buffer_arena<Species>& arena, std::size_t id)
+            : m_Arena{&arena}
+            , m_Id{id}
+        {}
+    };
+
+    /// Serves many small allocations from a few large buffers, each managed by a buddy_allocator, so that
+    /// meshes may share buffers and so be drawn without rebinding. Pages are added as required. The arena
+    /// is pinned in memory, since allocations refer back to it.
+    template<buffer_species Species>
+    class buffer_arena {
+    public:
+        using page_type = std::conditional_t<
+            Species == buffer_species::array,
+            vertex_buffer_object<GLubyte, buffer_usage::dynamic_draw>,
+            element_buffer_object<GLubyte, buffer_usage::dynamic_draw>
+        >;
+
+        buffer_arena(const resourceful_context& ctx, const arena_configurator& config)
+            : m_Context{&ctx}
+            , m_Label{config.label}
+            , m_EmptyPage{config.page_size, config.min_block_size}
+        {}
+
+        buffer_arena(const buffer_arena&)            = delete;
+        buffer_arena& operator=(const buffer_arena&) = delete;
+
+        /// The offset is a multiple of alignment, which need not be a power of two
+        [[nodiscard]]
+        arena_allocation<Species> allocate(std::size_t size, std::size_t alignment = 1) {
+            // Blocks are aligned to at least the minimum block size, beyond which padding may be required
+            const auto blockSize{size + ((alignment && (m_EmptyPage.min_block_size() % alignment)) ? alignment - 1 : 0)};
+            if(!size || !alignment || (blockSize > page_size()))
+                throw std::runtime_error{std::format("buffer_arena::allocate: cannot allocate {} bytes, aligned to {}, from pages of {} bytes", size, alignment, page_size())};
+
+            for(std::size_t i{}; i < m_Pages.size(); ++i) {
+                if(const auto block{m_Pages[i].allocator.allocate(blockSize)})
+                    return make_allocation(i, *block, blockSize, size, alignment);
+            }
+
+            m_Pages.push_back({page_type{*m_Context, buffer_reservation{page_size()}, m_Label}, m_EmptyPage});
+            return make_allocation(m_Pages.size() - 1, m_Pages.back().allocator.allocate(blockSize).value(), blockSize, size, alignment);
+        }
+
+        /// Aligned to the size of T, so that the offset may be expressed in elements, for example as a base vertex
+        template<class T>
+            requires is_legal_gl_buffer_value_type_v<T>
+        [[nodiscard]]
+        arena_allocation<Species> allocate(std::size_t count) { return allocate(count * sizeof(T), sizeof(T)); }
+
+        [[nodiscard]]
+        arena_location locate(const arena_allocation<Species>& allocation) const {
+            const auto& r{record(allocation)};
+            return {r.page, r.offset, r.size};
+        }
+
+        [[nodiscard]]
+        const page_type& page(std::size_t i) const {
+            if(i >= m_Pages.size())
+                throw std::runtime_error{std::format("buffer_arena::page: index {} out of range for {} pages", i, m_Pages.size())};
+
+            return m_Pages[i].buffer;
+        }
+
+        [[nodiscard]]
+        std::size_t num_pages() const noexcept { return m_Pages.size(); }
+
+        [[nodiscard]]
+        std::size_t page_size() const noexcept { return m_EmptyPage.capacity(); }
+
+        /// Overwrites the elements [first, first + data.size()) of the allocation, viewed as an array of T
+        template<class T>
+            requires is_legal_gl_buffer_value_type_v<T>
+        void write(const arena_allocation<Species>& allocation, std::span<const T> data, std::size_t first = 0) {
+            const auto& r{checked_record<T>(allocation, "write", first, data.size())};
+            m_Pages[r.page].buffer.update(r.offset + first * sizeof(T), std::span<const GLubyte>{reinterpret_cast<const GLubyte*>(data.data()), data.size_bytes()});
+        }
+
+        template<class T>
+            requires is_legal_gl_buffer_value_type_v<T>
+        void read(const arena_allocation<Species>& allocation, std::span<T> destination, std::size_t first = 0) const {
+            const auto& r{checked_record<T>(allocation, "read", first, destination.size())};
+            m_Pages[r.page].buffer.extract_data(std::span<GLubyte>{reinterpret_cast<GLubyte*>(destination.data()), destination.size_bytes()}, r.offset + first * sizeof(T));
+        }
+
+        [[nodiscard]]
+        arena_statistics statistics() const {
+            arena_statistics stats{.pages{m_Pages.size()}, .allocations{}, .capacity{m_Pages.size() * page_size()}, .reserved{}, .requested{m_Requested}, .largest_free_block{}};
+            for(const auto& p : m_Pages) {
+                stats.allocations        += p.allocator.num_allocations();
+                stats.reserved           += p.allocator.allocated();
+                stats.largest_free_block =  std::max(stats.largest_free_block, p.allocator.largest_free_block());
+            }
+
+            return stats;
+        }
+
+        /// Packs the allocations of each page into fresh storage, with the largest first, and releases any empty
+        /// pages at the end. Returns the number of allocations moved; if non-zero, locations obtained beforehand,
+        /// and anything built from them, are invalidated, which is signalled by a change of generation.
+        std::size_t defragment() {
+            std::size_t moved{};
+            for(std::size_t i{}; i < m_Pages.size(); ++i)
+                moved += repack(i);
+
+            while(!m_Pages.empty() && !m_Pages.back().allocator.num_allocations())
+                m_Pages.pop_back();
+
+            if(moved)
+                ++m_Generation;
+
+            return moved;
+        }
+
+        [[nodiscard]]
+        std::size_t generation() const noexcept { return m_Generation; }
+    private:
+        friend arena_allocation<Species>;
+
+        struct arena_page {
+            page_type buffer;
+            buddy_allocator allocator;
+        };
+
+        struct allocation_record {
+            std::size_t page{}, block{}, block_size{}, offset{}, size{}, alignment{};
+        };
+
+        const resourceful_context* m_Context{};
+        optional_label m_Label{};
+        buddy_allocator m_EmptyPage;
+        std::vector<arena_page> m_Pages{};
+        std::vector<std::optional<allocation_record>> m_Records{};
+        std::vector<std::size_t> m_FreeIds{};
+        std::size_t m_Requested{}, m_Generation{};
+
+        [[nodiscard]]
+        static std::size_t aligned(std::size_t block, std::size_t alignment) noexcept { return (block + alignment - 1) / alignment * alignment; }
+
+        [[nodiscard]]
+        arena_allocation<Species> make_allocation(std::size_t page, std::size_t block, std::size_t blockSize, std::size_t size, std::size_t alignment) {
+            const allocation_record r{page, block, blockSize, aligned(block, alignment), size, alignment};
+            std::size_t id{m_Records.size()};
+            if(m_FreeIds.empty()) {
+                m_Records.push_back(r);
+            }
+            else {
+                id = m_FreeIds.back();
+                m_FreeIds.pop_back();
+                m_Records[id] = r;
+            }
+
+            m_Requested += size;
+            return {*this, id};
+        }
+
+        [[nodiscard]]
+        const allocation_record& record(const arena_allocation<Species>& allocation) const {
+            if(allocation.m_Arena != this)
+                throw std::runtime_error{"buffer_arena: allocation belongs to a different arena"};
+
+            return *m_Records[allocation.m_Id];
+        }
+
+        template<class T>
+        [[nodiscard]]
+        const allocation_record& checked_record(const arena_allocation<Species>& allocation, std::string_view fn, std::size_t first, std::size_t count) const {
+            const auto& r{record(allocation)};
+            const auto capacity{r.size / sizeof(T)};
+            if((first > capacity) || (count > capacity - first))
+                throw std::runtime_error{std::format("buffer_arena::{}: elements [{}, {}) lie outside an allocation of {} elements", fn, first, first + count, capacity)};
+
+            return r;
+        }
+
+        void release(std::size_t id) noexcept {
+            auto& r{m_Records[id]};
+            m_Pages[r->page].allocator.free(r->block);
+            m_Requested -= r->size;
+            r.reset();
+            m_FreeIds.push_back(id);
+        }
+
+        std::size_t repack(std::size_t i) {
+            std::vector<std::size_t> ids{};
+            for(std::size_t id{}; id < m_Records.size(); ++id) {
+                if(m_Records[id] && (m_Records[id]->page == i))
+                    ids.push_back(id);
+            }
+
+            // Allocating in descending order of size leaves no gaps between buddy blocks
+            std::ranges::sort(ids, [this](std::size_t lhs, std::size_t rhs) {
+                const auto& l{*m_Records[lhs]};
+                const auto& r{*m_Records[rhs]};
+                return (l.block_size != r.block_size) ? (l.block_size > r.block_size) : (l.block < r.block);
+            });
+
+            buddy_allocator packed{m_EmptyPage};
+            std::vector<std::size_t> blocks{};
+            blocks.reserve(ids.size());
+            for(auto id : ids)
+                blocks.push_back(packed.allocate(m_Records[id]->block_size).value());
+
+            std::size_t moved{};
+            for(const auto& [id, block] : std::views::zip(ids, blocks))
+                if(aligned(block, m_Records[id]->alignment) != m_Records[id]->offset) ++moved;
+
+            if(!moved)
+                return 0;
+
+            auto& p{m_Pages[i]};
+            page_type fresh{*m_Context, buffer_reservation{page_size()}, m_Label};
+            for(const auto& [id, block] : std::views::zip(ids, blocks)) {
+                auto& r{*m_Records[id]};
+                r.block  = block;
+                const auto offset{aligned(block, r.alignment)};
+                p.buffer.copy(fresh, {r.offset, r.size}, offset);
+                r.offset = offset;
+            }
+
+            p.buffer    = std::move(fresh);
+            p.allocator = std::move(packed);
+            return moved;
+        }
+    };
+
+    using vertex_arena  = buffer_arena<buffer_species::array>;
+    using element_arena = buffer_arena<buffer_species::element_array>;
+}
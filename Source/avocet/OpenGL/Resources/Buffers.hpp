@@ -10,12 +10,22 @@
 #include "avocet/OpenGL/Context/GLFunction.hpp"
 #include "avocet/OpenGL/ResourceInfrastructure/Labels.hpp"
 #include "avocet/OpenGL/Resources/GenericResource.hpp"
+#include "avocet/OpenGL/Resources/VertexFormats.hpp"
 #include "avocet/OpenGL/Utilities/Casts.hpp"
 #include "avocet/OpenGL/Utilities/TypeTraits.hpp"
 
 #include "sequoia/Core/DataStructures/MemOrderedTuple.hpp"
 #include "sequoia/Core/Meta/TypeTraits.hpp"
 
+#include <algorithm>
+#include <array>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace avocet::opengl {
@@ -47,15 +57,76 @@ namespace avocet::opengl {
     template<gl_arithmetic T>
     struct is_legal_gl_buffer_value_type<T> : std::true_type {};
 
+    /// For example, the columns of a matrix
+    template<gl_arithmetic T, std::size_t N>
+    struct is_legal_gl_buffer_value_type<std::array<T, N>> : std::true_type {};
+
+    template<gl_integral T, std::size_t N>
+    struct is_legal_gl_buffer_value_type<normalized<T, N>> : std::true_type {};
+
+    template<std::size_t N>
+    struct is_legal_gl_buffer_value_type<half_float<N>> : std::true_type {};
+
+    template<>
+    struct is_legal_gl_buffer_value_type<packed_snorm_10_10_10_2> : std::true_type {};
+
     template<class... Ts>
         requires (is_legal_gl_buffer_value_type_v<Ts> && ...)
               && (sizeof(sequoia::mem_ordered_tuple<Ts...>) == (sizeof(Ts) + ...))
     struct is_legal_gl_buffer_value_type<sequoia::mem_ordered_tuple<Ts...>> : std::true_type
     {};
 
+    /// How the vertex shader receives an attribute: integral attributes arrive unconverted, unless normalized
+    enum class attribute_interpretation { floating, normalized, integral, double_precision };
+
+    /// Attributes of more than four components, such as matrices, occupy one location per column
+    struct attribute_format {
+        GLenum type{};
+        GLint components{};
+        std::size_t columns{1};
+        attribute_interpretation interpretation{};
+    };
+
+    template<class Attribute>
+    struct vertex_attribute_format {
+        using value_type = gl_arithmetic_type_of_t<Attribute>;
+
+        constexpr static std::size_t total_components{sizeof(Attribute) / sizeof(value_type)};
+        constexpr static std::size_t columns{total_components > 4 ? total_components / 4 : 1uz};
+        static_assert((columns == 1) || (!std::is_same_v<value_type, GLdouble> && (total_components % 4 == 0)), "Attributes spanning several locations must comprise columns of four single-precision components");
+
+        constexpr static attribute_format value{
+            to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>),
+            static_cast<GLint>(total_components / columns),
+            columns,
+              std::is_same_v<value_type, GLdouble> ? attribute_interpretation::double_precision
+            : gl_integral<value_type>              ? attribute_interpretation::integral
+                                                   : attribute_interpretation::floating
+        };
+    };
+
+    template<gl_integral T, std::size_t N>
+    struct vertex_attribute_format<normalized<T, N>> {
+        constexpr static attribute_format value{to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<T>), static_cast<GLint>(N), 1, attribute_interpretation::normalized};
+    };
+
+    template<std::size_t N>
+    struct vertex_attribute_format<half_float<N>> {
+        constexpr static attribute_format value{GL_HALF_FLOAT, static_cast<GLint>(N), 1, attribute_interpretation::floating};
+    };
+
+    template<>
+    struct vertex_attribute_format<packed_snorm_10_10_10_2> {
+        constexpr static attribute_format value{GL_INT_2_10_10_10_REV, 4, 1, attribute_interpretation::normalized};
+    };
+
+    template<class Attribute>
+    inline constexpr attribute_format vertex_attribute_format_v{vertex_attribute_format<Attribute>::value};
+
     struct vao_lifecycle_events {
         constexpr static auto identifier{ object_identifier::vertex_array};
-        constexpr static auto caching_id{caching_identifier::opt_out};
+        constexpr static auto caching_id{caching_identifier::vertex_array};
+        constexpr static bool direct_state_access{true};
 
         struct configurator {
             optional_label label;
@@ -63,7 +134,10 @@ namespace avocet::opengl {
 
         template<std::size_t N>
         static void generate(const decorated_context& ctx, raw_indices<N>& indices) {
-            gl_function{&GladGLContext::GenVertexArrays}(ctx, N, indices.data());
+            if(uses_direct_state_access(ctx))
+                gl_function{&GladGLContext::CreateVertexArrays}(ctx, N, indices.data());
+            else
+                gl_function{&GladGLContext::GenVertexArrays}(ctx, N, indices.data());
         }
 
         template<std::size_t N>
@@ -72,7 +146,7 @@ namespace avocet::opengl {
         }
 
         static void bind(decorated_contextual_resource_view crv) {
-            gl_function{&GladGLContext::BindVertexArray}(crv.context(), get_index(crv));
+            static_gl_function<&GladGLContext::BindVertexArray>{}(crv.context(), get_index(crv));
         }
 
         static void configure(decorated_contextual_resource_view crv, const configurator& config) {
@@ -85,15 +159,33 @@ namespace avocet::opengl {
 
     enum class buffer_species : GLenum {
         array         = GL_ARRAY_BUFFER,
-        element_array = GL_ELEMENT_ARRAY_BUFFER
+        element_array = GL_ELEMENT_ARRAY_BUFFER,
+        draw_indirect = GL_DRAW_INDIRECT_BUFFER
+    };
+
+    /// Requests storage of undefined content for the given number of elements
+    struct buffer_reservation {
+        std::size_t count{};
+    };
+
+    /// Hints to the driver of how often the contents of a buffer are respecified
+    enum class buffer_usage : GLenum {
+        static_draw  = GL_STATIC_DRAW,
+        dynamic_draw = GL_DYNAMIC_DRAW,
+        stream_draw  = GL_STREAM_DRAW
     };
 
     struct common_buffer_lifecycle_events {
         constexpr static auto identifier{object_identifier::buffer};
-        constexpr static auto caching_id{caching_identifier::opt_out};
+        constexpr static bool direct_state_access{true};
 
         template<std::size_t N>
-        static void generate(const decorated_context& ctx, raw_indices<N>& indices) { gl_function{&GladGLContext::GenBuffers}(ctx, N, indices.data()); }
+        static void generate(const decorated_context& ctx, raw_indices<N>& indices) {
+            if(uses_direct_state_access(ctx))
+                gl_function{&GladGLContext::CreateBuffers}(ctx, N, indices.data());
+            else
+                gl_function{&GladGLContext::GenBuffers}(ctx, N, indices.data());
+        }
 
         template<std::size_t N>
         static void destroy(const decorated_context& ctx, const raw_indices<N>& indices) { gl_function{&GladGLContext::DeleteBuffers}(ctx, N, indices.data()); }
@@ -102,123 +194,668 @@ namespace avocet::opengl {
         friend constexpr bool operator==(const common_buffer_lifecycle_events&, const common_buffer_lifecycle_events&) noexcept = default;
     };
 
-    template<buffer_species Species, class T>
+    template<buffer_species Species, class T, buffer_usage Usage=buffer_usage::static_draw>
         requires is_legal_gl_buffer_value_type_v<T>
     struct buffer_lifecycle_events : common_buffer_lifecycle_events {
+        constexpr static auto caching_id{
+              Species == buffer_species::array         ? caching_identifier::array_buffer
+            : Species == buffer_species::element_array ? caching_identifier::element_array_buffer
+                                                       : caching_identifier::opt_out
+        };
+
         struct configurator {
             std::span<const T> buffer_data;
             optional_label label;
+            /// Elements of undefined content to allocate when there is no buffer_data
+            std::size_t reserved{};
         };
 
-        static void bind(decorated_contextual_resource_view crv) { gl_function{&GladGLContext::BindBuffer}(crv.context(), to_gl_underlying_value<GLenum>(Species), get_index(crv)); }
+        static void bind(decorated_contextual_resource_view crv) { static_gl_function<&GladGLContext::BindBuffer>{}(crv.context(), to_gl_underlying_value<GLenum>(Species), get_index(crv)); }
 
         static void configure(decorated_contextual_resource_view crv, const configurator& config) {
             add_label(identifier, crv, config.label);
-            gl_function{&GladGLContext::BufferData}(crv.context(), to_gl_underlying_value<GLenum>(Species), sizeof(T) * config.buffer_data.size(), config.buffer_data.data(), GL_STATIC_DRAW);
+
+            const auto count{config.buffer_data.empty() ? config.reserved : config.buffer_data.size()};
+            const auto size{checked_conversion_to<GLsizeiptr>(sizeof(T) * count)};
+            const T* data{config.buffer_data.empty() ? nullptr : config.buffer_data.data()};
+            if(uses_direct_state_access(crv.context()))
+                gl_function{&GladGLContext::NamedBufferData}(crv.context(), get_index(crv), size, data, to_gl_underlying_value<GLenum>(Usage));
+            else
+                gl_function{&GladGLContext::BufferData}(crv.context(), to_gl_underlying_value<GLenum>(Species), size, data, to_gl_underlying_value<GLenum>(Usage));
         }
 
         [[nodiscard]]
         friend constexpr bool operator==(const buffer_lifecycle_events&, const buffer_lifecycle_events&) noexcept = default;
     };
 
-    template<class T>
+    template<class T, buffer_usage Usage=buffer_usage::static_draw>
     class vertex_buffer_object;
 
+    template<gl_integral T, buffer_usage Usage=buffer_usage::static_draw>
+    class element_buffer_object;
+
+    template<buffer_usage Usage, class... Attributes>
+        requires (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class separate_vertex_buffers;
+
+    /// Tags the layout of the vertices held by a buffer of raw bytes
+    template<class Vertex>
+    inline constexpr std::type_identity<Vertex> vertex_layout{};
+
+    /// Attributes wider than 16 bytes occupy consecutive locations
+    [[nodiscard]]
+    constexpr std::size_t num_attribute_locations(std::size_t attributeSize) noexcept { return 1 + (attributeSize - 1) / 16; }
+
+    /// The locations occupied by the attributes of a vertex, and so the first available to those of an instance
+    template<class Vertex>
+    inline constexpr GLuint num_vertex_locations_v{};
+
+    template<class... Attributes>
+    inline constexpr GLuint num_vertex_locations_v<sequoia::mem_ordered_tuple<Attributes...>>{
+        checked_conversion_to<GLuint>((num_attribute_locations(sizeof(Attributes)) + ...))
+    };
+
     class vertex_attribute_object : public generic_resource<num_resources{1}, vao_lifecycle_events> {
     public:
         using generic_resource_type = generic_resource<num_resources{1}, vao_lifecycle_events>;
 
+        template<buffer_usage Usage, class... Attributes>
+        vertex_attribute_object(const resourceful_context& ctx, const optional_label& label, const vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>, Usage>& vbo)
+            : generic_resource_type{ctx, vao_lifecycle_events{}, {{label}}}
+        {
+            attrib_ptr_info info{};
+            set_attribute_stream<Attributes...>(info, vbo);
+        }
+
+        /// Interprets raw bytes, for example a page of a vertex_arena, as interleaved vertices
+        template<buffer_usage Usage, class... Attributes>
+        vertex_attribute_object(const resourceful_context& ctx, const optional_label& label, const vertex_buffer_object<GLubyte, Usage>& vbo, std::type_identity<sequoia::mem_ordered_tuple<Attributes...>>)
+            : generic_resource_type{ctx, vao_lifecycle_events{}, {{label}}}
+        {
+            attrib_ptr_info info{};
+            set_attribute_stream<Attributes...>(info, vbo);
+        }
+
+        /// Raw bytes interpreted as interleaved vertices, together with per-instance attributes sourced from binding 1,
+        /// which advance once every divisor instances
+        template<buffer_usage Usage, class... Attributes, buffer_usage InstanceUsage, class... InstanceAttributes>
+        vertex_attribute_object(const resourceful_context& ctx,
+                                const optional_label& label,
+                                const vertex_buffer_object<GLubyte, Usage>& vbo,
+                                std::type_identity<sequoia::mem_ordered_tuple<Attributes...>>,
+                                const vertex_buffer_object<sequoia::mem_ordered_tuple<InstanceAttributes...>, InstanceUsage>& instances,
+                                GLuint divisor)
+            : generic_resource_type{ctx, vao_lifecycle_events{}, {{label}}}
+        {
+            attrib_ptr_info info{};
+            set_attribute_stream<Attributes...>(info, vbo);
+            set_attribute_stream<InstanceAttributes...>(info, instances, {.binding{1}, .divisor{divisor}});
+        }
+
+        /// Per-vertex attributes are sourced from binding 0 and per-instance attributes, which advance once per instance,
+        /// from binding 1. Locations are assigned to the per-vertex attributes first, and then continue into the latter.
+        template<buffer_usage VertexUsage, class... Attributes, buffer_usage InstanceUsage, class... InstanceAttributes>
+        vertex_attribute_object(const resourceful_context& ctx,
+                                const optional_label& label,
+                                const vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>, VertexUsage>& vbo,
+                                const vertex_buffer_object<sequoia::mem_ordered_tuple<InstanceAttributes...>, InstanceUsage>& instances)
+            : generic_resource_type{ctx, vao_lifecycle_events{}, {{label}}}
+        {
+            attrib_ptr_info info{};
+            set_attribute_stream<Attributes...>(info, vbo);
+            set_attribute_stream<InstanceAttributes...>(info, instances, {.binding{1}, .divisor{1}});
+        }
+
+        /// Each attribute is sourced from its own buffer, attribute i from binding point i
+        template<buffer_usage Usage, class... Attributes>
+        vertex_attribute_object(const resourceful_context& ctx, const optional_label& label, const separate_vertex_buffers<Usage, Attributes...>& buffers)
+            : generic_resource_type{ctx, vao_lifecycle_events{}, {{label}}}
+        {
+            attrib_ptr_info info{};
+            [&] <std::size_t... Is>(std::index_sequence<Is...>) {
+                (set_attribute_stream<Attributes>(info, buffers.template stream<Is>(), {.binding{Is}}), ...);
+            }(std::index_sequence_for<Attributes...>{});
+        }
+
+        /// Specifies the attribute formats alone, sourced from binding point 0, to which any vertex buffer of the
+        /// layout may subsequently be bound. Requires OpenGL 4.3.
         template<class... Attributes>
-        vertex_attribute_object(const resourceful_context& ctx, const optional_label& label, const vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>>& vbo)
+        vertex_attribute_object(const resourceful_context& ctx, const optional_label& label, std::type_identity<sequoia::mem_ordered_tuple<Attributes...>>)
             : generic_resource_type{ctx, vao_lifecycle_events{}, {{label}}}
         {
-            vbo.do_utilize();
+            if(!vertex_attrib_binding_supported(ctx.fundamental_characteristics().version()))
+                throw std::runtime_error{"vertex_attribute_object: separate attribute formats require OpenGL 4.3"};
 
             attrib_ptr_info info{};
-            constexpr auto stride{(sizeof(Attributes) + ...)};
-            (set_attribute_ptr<Attributes>(info, stride), ...);
+            constexpr auto stride{checked_conversion_to<GLsizei>((sizeof(Attributes) + ...))};
+            (set_attribute_ptr<Attributes>(info, stride, {.separate_format{true}}), ...);
         }
 
         void bind(this const vertex_attribute_object& self) { self.do_utilize(); }
+
+        /// Binds vbo to the binding point, unless the context records that it is already there
+        template<class T, buffer_usage Usage>
+        void bind_vertex_buffer(this const vertex_attribute_object& self, const vertex_buffer_object<T, Usage>& vbo, GLuint binding = 0) {
+            const auto& ctx{self.context()};
+            const auto vao{get_index(self.contextual_handle_view())}, buffer{get_index(vbo.contextual_handle_view())};
+            if(!ctx.cache_vertex_buffer(vao, binding, buffer))
+                return;
+
+            constexpr auto stride{checked_conversion_to<GLsizei>(sizeof(T))};
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::VertexArrayVertexBuffer}(ctx, vao, binding, buffer, 0, stride);
+            }
+            else {
+                self.bind();
+                static_gl_function<&GladGLContext::BindVertexBuffer>{}(ctx, binding, buffer, 0, stride);
+            }
+        }
+
+        /// Binds ebo, through the bind cache, to this vertex array, which is left bound
+        template<gl_integral T, buffer_usage Usage>
+        void bind_element_buffer(this const vertex_attribute_object& self, const element_buffer_object<T, Usage>& ebo) {
+            self.bind();
+            ebo.do_utilize();
+        }
+
+        /// Makes ebo part of the state of this vertex array. Intended for use while building geometry:
+        /// with direct state access, the vertex array is not bound, though the context still records the attachment.
+        template<gl_integral T, buffer_usage Usage>
+        void attach(this const vertex_attribute_object& self, const element_buffer_object<T, Usage>& ebo) {
+            const auto& ctx{self.context()};
+            if(uses_direct_state_access(ctx)) {
+                const auto vao{get_index(self.contextual_handle_view())}, buffer{get_index(ebo.contextual_handle_view())};
+                if(ctx.cache_element_buffer(vao, buffer))
+                    gl_function{&GladGLContext::VertexArrayElementBuffer}(ctx, vao, buffer);
+            }
+            else {
+                self.bind();
+                ebo.do_utilize();
+            }
+        }
     private:
         struct attrib_ptr_info {
             GLint       index{};
             std::size_t offset{};
 
             void advance(std::size_t attSize) {
-                index  += checked_conversion_to<GLint>(1 + (attSize - 1) / 16);
+                index  += checked_conversion_to<GLint>(num_attribute_locations(attSize));
                 offset += attSize;
             }
         };
 
+        struct attrib_stream_info {
+            GLuint binding{}, divisor{};
+            bool separate_format{};
+        };
+
+        template<class... Attributes, class Buffer>
+        void set_attribute_stream(attrib_ptr_info& info, const Buffer& vbo, attrib_stream_info stream = {}) {
+            constexpr auto stride{checked_conversion_to<GLsizei>((sizeof(Attributes) + ...))};
+            const auto& ctx{this->context()};
+            if(uses_direct_state_access(ctx)) {
+                const auto vao{get_index(this->contextual_handle_view())};
+                gl_function{&GladGLContext::VertexArrayVertexBuffer}(ctx, vao, stream.binding, get_index(vbo.contextual_handle_view()), 0, stride);
+                if(stream.divisor)
+                    gl_function{&GladGLContext::VertexArrayBindingDivisor}(ctx, vao, stream.binding, stream.divisor);
+            }
+            else {
+                vbo.do_utilize();
+            }
+
+            info.offset = 0;
+            (set_attribute_ptr<Attributes>(info, stride, stream), ...);
+        }
+
         template<class Attribute>
-        void set_attribute_ptr(attrib_ptr_info& info, GLsizei stride) {
-            using value_type = gl_arithmetic_type_of_t<Attribute>;
+        void set_attribute_ptr(attrib_ptr_info& info, GLsizei stride, attrib_stream_info stream) {
+            constexpr auto format{vertex_attribute_format_v<Attribute>};
+            constexpr auto normalize{format.interpretation == attribute_interpretation::normalized ? GL_TRUE : GL_FALSE};
+            constexpr auto columnSize{sizeof(Attribute) / format.columns};
 
-            constexpr auto sizeofAtt{sizeof(Attribute)};
-            constexpr auto typeSpecifier{to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>)};
-            constexpr auto components{checked_conversion_to<GLint>(sizeofAtt / sizeof(value_type))};
             const auto& ctx{this->context()};
-            if constexpr(std::is_same_v<value_type, GLdouble>) {
-                gl_function{&GladGLContext::VertexAttribLPointer}(ctx, info.index, components, typeSpecifier, stride, std::bit_cast<GLvoid*>(info.offset));
+            for(std::size_t c{}; c < format.columns; ++c) {
+                const auto location{info.index + checked_conversion_to<GLint>(c)};
+                const auto offset{info.offset + c * columnSize};
+                if(uses_direct_state_access(ctx)) {
+                    const auto vao{get_index(this->contextual_handle_view())};
+                    const auto relativeOffset{checked_conversion_to<GLuint>(offset)};
+                    if constexpr(format.interpretation == attribute_interpretation::double_precision) {
+                        gl_function{&GladGLContext::VertexArrayAttribLFormat}(ctx, vao, location, format.components, format.type, relativeOffset);
+                    }
+                    else if constexpr(format.interpretation == attribute_interpretation::integral) {
+                        gl_function{&GladGLContext::VertexArrayAttribIFormat}(ctx, vao, location, format.components, format.type, relativeOffset);
+                    }
+                    else {
+                        gl_function{&GladGLContext::VertexArrayAttribFormat}(ctx, vao, location, format.components, format.type, normalize, relativeOffset);
+                    }
+                    gl_function{&GladGLContext::VertexArrayAttribBinding}(ctx, vao, location, stream.binding);
+                    gl_function{&GladGLContext::EnableVertexArrayAttrib}(ctx, vao, location);
+                }
+                else {
+                    if(stream.separate_format) {
+                        const auto relativeOffset{checked_conversion_to<GLuint>(offset)};
+                        if constexpr(format.interpretation == attribute_interpretation::double_precision) {
+                            gl_function{&GladGLContext::VertexAttribLFormat}(ctx, location, format.components, format.type, relativeOffset);
+                        }
+                        else if constexpr(format.interpretation == attribute_interpretation::integral) {
+                            gl_function{&GladGLContext::VertexAttribIFormat}(ctx, location, format.components, format.type, relativeOffset);
+                        }
+                        else {
+                            gl_function{&GladGLContext::VertexAttribFormat}(ctx, location, format.components, format.type, normalize, relativeOffset);
+                        }
+                        gl_function{&GladGLContext::VertexAttribBinding}(ctx, location, stream.binding);
+                    }
+                    else {
+                        if constexpr(format.interpretation == attribute_interpretation::double_precision) {
+                            gl_function{&GladGLContext::VertexAttribLPointer}(ctx, location, format.components, format.type, stride, std::bit_cast<GLvoid*>(offset));
+                        }
+                        else if constexpr(format.interpretation == attribute_interpretation::integral) {
+                            gl_function{&GladGLContext::VertexAttribIPointer}(ctx, location, format.components, format.type, stride, std::bit_cast<GLvoid*>(offset));
+                        }
+                        else {
+                            gl_function{&GladGLContext::VertexAttribPointer}(ctx, location, format.components, format.type, normalize, stride, std::bit_cast<GLvoid*>(offset));
+                        }
+
+                        if(stream.divisor)
+                            gl_function{&GladGLContext::VertexAttribDivisor}(ctx, location, stream.divisor);
+                    }
+
+                    gl_function{&GladGLContext::EnableVertexAttribArray}(ctx, location);
+                }
+            }
+
+            info.advance(sizeof(Attribute));
+        }
+    };
+
+    /// A range of elements within a buffer
+    struct buffer_range {
+        std::size_t offset{}, count{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const buffer_range&, const buffer_range&) noexcept = default;
+    };
+
+    /// Read-only view of a range of a buffer, mapped on construction and unmapped on destruction. The buffer
+    /// must outlive the view, and must not be otherwise accessed while mapped. Without direct state access,
+    /// the buffer is mapped through GL_COPY_READ_BUFFER.
+    template<class T>
+    class [[nodiscard]] mapped_buffer_view {
+    public:
+        mapped_buffer_view(const decorated_context& ctx, GLuint buffer, buffer_range range)
+            : m_Context{&ctx}
+            , m_Buffer{buffer}
+        {
+            if(!range.count)
+                return;
+
+            const auto offset{checked_conversion_to<GLintptr>(sizeof(T) * range.offset)};
+            const auto size{checked_conversion_to<GLsizeiptr>(sizeof(T) * range.count)};
+            void* ptr{};
+            if(uses_direct_state_access(ctx)) {
+                ptr = gl_function{&GladGLContext::MapNamedBufferRange}(ctx, buffer, offset, size, GL_MAP_READ_BIT);
             }
             else {
-                gl_function{&GladGLContext::VertexAttribPointer}(ctx, info.index, components, typeSpecifier, GL_FALSE, stride, std::bit_cast<GLvoid*>(info.offset));
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_READ_BUFFER, buffer);
+                ptr = gl_function{&GladGLContext::MapBufferRange}(ctx, GL_COPY_READ_BUFFER, offset, size, GL_MAP_READ_BIT);
             }
-            gl_function{&GladGLContext::EnableVertexAttribArray}(ctx, info.index);
 
-            info.advance(sizeofAtt);
+            if(!ptr)
+                throw std::runtime_error{"mapped_buffer_view: unable to map buffer"};
+
+            m_Data = {static_cast<const T*>(ptr), range.count};
         }
+
+        ~mapped_buffer_view() { unmap(); }
+
+        mapped_buffer_view(mapped_buffer_view&& other) noexcept
+            : m_Context{other.m_Context}
+            , m_Buffer{other.m_Buffer}
+            , m_Data{std::exchange(other.m_Data, {})}
+        {}
+
+        mapped_buffer_view& operator=(mapped_buffer_view&& other) noexcept {
+            std::ranges::swap(m_Context, other.m_Context);
+            std::ranges::swap(m_Buffer, other.m_Buffer);
+            std::ranges::swap(m_Data, other.m_Data);
+            return *this;
+        }
+
+        /// Returns false if the contents became undefined while mapped, for example following a change of display mode
+        bool unmap() {
+            if(m_Data.empty())
+                return true;
+
+            m_Data = {};
+            if(uses_direct_state_access(*m_Context))
+                return gl_function{&GladGLContext::UnmapNamedBuffer}(*m_Context, m_Buffer) == GL_TRUE;
+
+            static_gl_function<&GladGLContext::BindBuffer>{}(*m_Context, GL_COPY_READ_BUFFER, m_Buffer);
+            return gl_function{&GladGLContext::UnmapBuffer}(*m_Context, GL_COPY_READ_BUFFER) == GL_TRUE;
+        }
+
+        [[nodiscard]]
+        std::span<const T> data() const noexcept { return m_Data; }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept { return m_Data.size(); }
+
+        [[nodiscard]]
+        bool empty() const noexcept { return m_Data.empty(); }
+
+        [[nodiscard]]
+        const T& operator[](std::size_t i) const { return m_Data[i]; }
+
+        [[nodiscard]]
+        auto begin() const noexcept { return m_Data.begin(); }
+
+        [[nodiscard]]
+        auto end() const noexcept { return m_Data.end(); }
+    private:
+        const decorated_context* m_Context{};
+        GLuint m_Buffer{};
+        std::span<const T> m_Data{};
     };
 
-    template<buffer_species Species, class T>
+    template<buffer_species Species, class T, buffer_usage Usage=buffer_usage::static_draw>
         requires is_legal_gl_buffer_value_type_v<T>
-    class generic_buffer_object : public generic_resource<num_resources{1}, buffer_lifecycle_events<Species, T>>
+    class generic_buffer_object : public generic_resource<num_resources{1}, buffer_lifecycle_events<Species, T, Usage>>
     {
     public:
         constexpr static auto species{Species};
+        constexpr static auto usage{Usage};
         using value_type            = T;
-        using generic_resource_type = generic_resource<num_resources{1}, buffer_lifecycle_events<Species, T>>;
+        using generic_resource_type = generic_resource<num_resources{1}, buffer_lifecycle_events<Species, T, Usage>>;
 
         generic_buffer_object(const resourceful_context& ctx, std::span<const T> data, const optional_label& label)
-            : generic_resource_type{ctx, buffer_lifecycle_events<Species, T>{}, {{data, label}}}
+            : generic_resource_type{ctx, buffer_lifecycle_events<Species, T, Usage>{}, {{data, label}}}
+            , m_Size{data.size()}
+            , m_Capacity{data.size()}
+        {}
+
+        generic_buffer_object(const resourceful_context& ctx, buffer_reservation reservation, const optional_label& label)
+            requires (Usage != buffer_usage::static_draw)
+            : generic_resource_type{ctx, buffer_lifecycle_events<Species, T, Usage>{}, {{std::span<const T>{}, label, reservation.count}}}
+            , m_Size{reservation.count}
+            , m_Capacity{reservation.count}
         {}
 
+        /// The number of elements holding data, which may be fewer than the capacity
+        [[nodiscard]]
+        std::size_t size() const noexcept { return m_Size; }
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept
+            requires (Usage != buffer_usage::static_draw)
+        {
+            return m_Capacity;
+        }
+
+        /// Overwrites the elements [offset, offset + data.size()), which must lie within the current size
+        void update(this const generic_buffer_object& self, std::size_t offset, std::span<const T> data)
+            requires (Usage != buffer_usage::static_draw)
+        {
+            self.check_range("update", {offset, data.size()});
+            self.sub_data(offset, data);
+        }
+
+        /// Copies elements between buffers on the GPU; the source and destination ranges must not overlap if the buffers are the same
+        void copy(this const generic_buffer_object& self, const generic_buffer_object& destination, buffer_range source, std::size_t destinationOffset) {
+            self.check_range("copy", source);
+            destination.check_range("copy", {destinationOffset, source.count});
+            if(!source.count)
+                return;
+
+            const auto& ctx{self.context()};
+            const auto readOffset{checked_conversion_to<GLintptr>(sizeof(T) * source.offset)};
+            const auto writeOffset{checked_conversion_to<GLintptr>(sizeof(T) * destinationOffset)};
+            const auto bytes{checked_conversion_to<GLsizeiptr>(sizeof(T) * source.count)};
+            const auto readName{get_index(self.contextual_handle_view())}, writeName{get_index(destination.contextual_handle_view())};
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::CopyNamedBufferSubData}(ctx, readName, writeName, readOffset, writeOffset, bytes);
+            }
+            else {
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_READ_BUFFER, readName);
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_WRITE_BUFFER, writeName);
+                gl_function{&GladGLContext::CopyBufferSubData}(ctx, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, readOffset, writeOffset, bytes);
+            }
+        }
+
+        /// Detaches the current storage, so that subsequent writes need not wait for draws still reading it
+        void orphan(this const generic_buffer_object& self)
+            requires (Usage != buffer_usage::static_draw)
+        {
+            self.respecify(self.m_Capacity);
+        }
+
+        /// Replaces the entire contents. The storage is orphaned, growing geometrically if data exceeds
+        /// the capacity; the name of the buffer, and so any vertex array state referring to it, is unchanged.
+        void replace(this generic_buffer_object& self, std::span<const T> data)
+            requires (Usage != buffer_usage::static_draw)
+        {
+            const auto capacity{data.size() > self.m_Capacity ? std::max(data.size(), 2 * self.m_Capacity) : self.m_Capacity};
+            self.respecify(capacity);
+            self.sub_data(0, data);
+            self.m_Capacity = capacity;
+            self.m_Size     = data.size();
+        }
+
         [[nodiscard]]
         std::vector<T> extract_data(this const generic_buffer_object& self) {
-            self.do_utilize();
-            const auto size{get_buffer_size(self.context())};
-            std::vector<T> buffer(size / sizeof(T));
-            gl_function{&GladGLContext::GetBufferSubData}(self.context(), to_gl_underlying_value<GLenum>(Species), 0, size, buffer.data());
+            std::vector<T> buffer(self.m_Size);
+            self.extract_data(buffer);
             return buffer;
         }
-    private:
+
+        /// Copies the elements [offset, offset + destination.size()) into destination, without allocating
+        void extract_data(this const generic_buffer_object& self, std::span<T> destination, std::size_t offset = 0) {
+            self.check_range("extract_data", {offset, destination.size()});
+            if(destination.empty())
+                return;
+
+            const auto& ctx{self.context()};
+            const auto name{get_index(self.contextual_handle_view())};
+            const auto byteOffset{checked_conversion_to<GLintptr>(sizeof(T) * offset)};
+            const auto bytes{checked_conversion_to<GLsizeiptr>(sizeof(T) * destination.size())};
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::GetNamedBufferSubData}(ctx, name, byteOffset, bytes, destination.data());
+            }
+            else {
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_READ_BUFFER, name);
+                gl_function{&GladGLContext::GetBufferSubData}(ctx, GL_COPY_READ_BUFFER, byteOffset, bytes, destination.data());
+            }
+        }
+
+        /// Views the range in place, avoiding both an allocation and a copy
         [[nodiscard]]
-        static GLint get_buffer_size(const decorated_context& ctx) {
-            GLint param{};
-            gl_function{&GladGLContext::GetBufferParameteriv}(ctx, to_gl_underlying_value<GLenum>(Species), GL_BUFFER_SIZE, &param);
-            return param;
+        mapped_buffer_view<T> map_read(this const generic_buffer_object& self, buffer_range range) {
+            self.check_range("map_read", range);
+            return {self.context(), get_index(self.contextual_handle_view()), range};
+        }
+
+        [[nodiscard]]
+        mapped_buffer_view<T> map_read(this const generic_buffer_object& self) { return self.map_read({0, self.m_Size}); }
+    private:
+        std::size_t m_Size{}, m_Capacity{};
+
+        void check_range(std::string_view fn, buffer_range range) const {
+            if((range.offset > m_Size) || (range.count > m_Size - range.offset))
+                throw std::runtime_error{std::format("generic_buffer_object::{}: elements [{}, {}) lie outside a buffer of size {}", fn, range.offset, range.offset + range.count, m_Size)};
+        }
+
+        /// Without direct state access, edits are made through GL_COPY_WRITE_BUFFER: binding an element
+        /// buffer to GL_ELEMENT_ARRAY_BUFFER would attach it to whichever vertex array is bound.
+        void respecify(std::size_t capacity) const {
+            const auto& ctx{this->context()};
+            const auto bytes{checked_conversion_to<GLsizeiptr>(sizeof(T) * capacity)};
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::NamedBufferData}(ctx, get_index(this->contextual_handle_view()), bytes, nullptr, to_gl_underlying_value<GLenum>(Usage));
+            }
+            else {
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_WRITE_BUFFER, get_index(this->contextual_handle_view()));
+                gl_function{&GladGLContext::BufferData}(ctx, GL_COPY_WRITE_BUFFER, bytes, nullptr, to_gl_underlying_value<GLenum>(Usage));
+            }
+        }
+
+        void sub_data(std::size_t offset, std::span<const T> data) const {
+            if(data.empty()) return;
+
+            const auto& ctx{this->context()};
+            const auto byteOffset{checked_conversion_to<GLintptr>(sizeof(T) * offset)};
+            const auto bytes{checked_conversion_to<GLsizeiptr>(sizeof(T) * data.size())};
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::NamedBufferSubData}(ctx, get_index(this->contextual_handle_view()), byteOffset, bytes, data.data());
+            }
+            else {
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_WRITE_BUFFER, get_index(this->contextual_handle_view()));
+                gl_function{&GladGLContext::BufferSubData}(ctx, GL_COPY_WRITE_BUFFER, byteOffset, bytes, data.data());
+            }
         }
     };
 
-    template<gl_arithmetic T>
-    class vertex_buffer_object<T> : public generic_buffer_object<buffer_species::array, T> {
+    template<class T>
+    inline constexpr bool is_mem_ordered_tuple_v{false};
+
+    template<class... Ts>
+    inline constexpr bool is_mem_ordered_tuple_v<sequoia::mem_ordered_tuple<Ts...>>{true};
+
+    /// A single value per vertex: for example raw bytes, or one stream of separate_vertex_buffers
+    template<class T, buffer_usage Usage>
+        requires (!is_mem_ordered_tuple_v<T>)
+    class vertex_buffer_object<T, Usage> : public generic_buffer_object<buffer_species::array, T, Usage> {
+        friend class vertex_attribute_object;
     public:
-        using generic_buffer_object<buffer_species::array, T>::generic_buffer_object;
+        using generic_buffer_object<buffer_species::array, T, Usage>::generic_buffer_object;
     };
 
-    template<class... Attributes>
+    /// Interleaved vertices; for non-static usage, update and replace take spans of whole vertices
+    template<buffer_usage Usage, class... Attributes>
         requires (is_legal_gl_buffer_value_type_v<Attributes> && ...)
-    class vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>> : public generic_buffer_object<buffer_species::array, sequoia::mem_ordered_tuple<Attributes...>> {
+    class vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>, Usage> : public generic_buffer_object<buffer_species::array, sequoia::mem_ordered_tuple<Attributes...>, Usage> {
         friend class vertex_attribute_object;
     public:
-        using generic_buffer_object<buffer_species::array, sequoia::mem_ordered_tuple<Attributes...>>::generic_buffer_object;
+        using generic_buffer_object<buffer_species::array, sequoia::mem_ordered_tuple<Attributes...>, Usage>::generic_buffer_object;
     };
 
-    template<gl_integral T>
-    class element_buffer_object : public generic_buffer_object<buffer_species::element_array, T> {
+    template<gl_integral T, buffer_usage Usage>
+    class element_buffer_object : public generic_buffer_object<buffer_species::element_array, T, Usage> {
+        friend class vertex_attribute_object;
     public:
-        using generic_buffer_object<buffer_species::element_array, T>::generic_buffer_object;
+        using generic_buffer_object<buffer_species::element_array, T, Usage>::generic_buffer_object;
     };
 
+    /// One tightly packed buffer per attribute, rather than a single buffer of interleaved vertices, so that an
+    /// attribute which changes frequently, such as position, may be updated without resending the others
+    template<buffer_usage Usage, class... Attributes>
+        requires (is_legal_gl_buffer_value_type_v<Attributes> && ...)
+    class separate_vertex_buffers {
+    public:
+        constexpr static auto usage{Usage};
+        using vertex_type = sequoia::mem_ordered_tuple<Attributes...>;
+
+        template<std::size_t I>
+        using attribute_type = std::tuple_element_t<I, std::tuple<Attributes...>>;
+
+        template<std::size_t I>
+        using stream_type = vertex_buffer_object<attribute_type<I>, Usage>;
+
+        /// Splits interleaved vertices into streams
+        separate_vertex_buffers(const resourceful_context& ctx, std::span<const vertex_type> vertices, const optional_label& label)
+            : m_Streams{make_streams(ctx, vertices, label, std::index_sequence_for<Attributes...>{})}
+        {}
+
+        separate_vertex_buffers(const resourceful_context& ctx, std::span<const Attributes>... streams, const optional_label& label)
+            : m_Streams{stream_type_of<Attributes>{ctx, check_sizes(streams, streams...), label}...}
+        {}
+
+        template<std::size_t I>
+        [[nodiscard]]
+        const stream_type<I>& stream() const noexcept { return std::get<I>(m_Streams); }
+
+        /// Overwrites the elements [offset, offset + data.size()) of stream I alone
+        template<std::size_t I>
+        void update(this const separate_vertex_buffers& self, std::size_t offset, std::span<const attribute_type<I>> data)
+            requires (Usage != buffer_usage::static_draw)
+        {
+            self.template stream<I>().update(offset, data);
+        }
+
+        template<std::size_t I>
+        void orphan(this const separate_vertex_buffers& self)
+            requires (Usage != buffer_usage::static_draw)
+        {
+            self.template stream<I>().orphan();
+        }
+
+        /// The number of vertices
+        [[nodiscard]]
+        std::size_t size() const noexcept { return std::get<0>(m_Streams).size(); }
+
+        [[nodiscard]]
+        friend bool operator==(const separate_vertex_buffers&, const separate_vertex_buffers&) noexcept = default;
+    private:
+        template<class Attribute>
+        using stream_type_of = vertex_buffer_object<Attribute, Usage>;
+
+        std::tuple<stream_type_of<Attributes>...> m_Streams;
+
+        template<class T, class... Ts>
+        [[nodiscard]]
+        static std::span<const T> check_sizes(std::span<const T> stream, std::span<const Ts>... streams) {
+            if(((streams.size() != stream.size()) || ...))
+                throw std::runtime_error{std::format("separate_vertex_buffers: a stream of {} elements does not match the others", stream.size())};
+
+            return stream;
+        }
+
+        template<std::size_t... Is>
+        [[nodiscard]]
+        static std::tuple<stream_type_of<Attributes>...> make_streams(const resourceful_context& ctx, std::span<const vertex_type> vertices, const optional_label& label, std::index_sequence<Is...>) {
+            return {stream_type<Is>{ctx, extract<Is>(vertices), label}...};
+        }
+
+        template<std::size_t I>
+        [[nodiscard]]
+        static std::vector<attribute_type<I>> extract(std::span<const vertex_type> vertices) {
+            std::vector<attribute_type<I>> attributes{};
+            attributes.reserve(vertices.size());
+            for(const auto& v : vertices)
+                attributes.push_back(sequoia::get<I>(v));
+
+            return attributes;
+        }
+    };
+
+    /// Selects, at compile time, between interleaved vertices and one buffer per attribute; both may be
+    /// constructed from a span of interleaved vertices, and both may be passed to a vertex_attribute_object
+    enum class attribute_layout { interleaved, separate };
+
+    template<attribute_layout Layout, buffer_usage Usage, class... Attributes>
+    using vertex_buffers = std::conditional_t<
+        Layout == attribute_layout::interleaved,
+        vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>, Usage>,
+        separate_vertex_buffers<Usage, Attributes...>
+    >;
+
+    /// Holds the parameters of indirect draws, which are sourced from whichever buffer is bound
+    template<class T, buffer_usage Usage=buffer_usage::dynamic_draw>
+    class indirect_buffer_object : public generic_buffer_object<buffer_species::draw_indirect, T, Usage> {
+    public:
+        using generic_buffer_object<buffer_species::draw_indirect, T, Usage>::generic_buffer_object;
+
+        void bind(this const indirect_buffer_object& self) { self.do_utilize(); }
+    };
+
+    template<class T>
+    using dynamic_vertex_buffer_object = vertex_buffer_object<T, buffer_usage::dynamic_draw>;
+
+    template<class T>
+    using stream_vertex_buffer_object = vertex_buffer_object<T, buffer_usage::stream_draw>;
+
+    template<gl_integral T>
+    using dynamic_element_buffer_object = element_buffer_object<T, buffer_usage::dynamic_draw>;
+
+    template<gl_integral T>
+    using stream_element_buffer_object = element_buffer_object<T, buffer_usage::stream_draw>;
 }
@@ -36,7 +36,11 @@ namespace avocet::opengl {
     }
 
     void framebuffer_object::check_framebuffer_status() {
-        const auto status{gl_function{&GladGLContext::CheckFramebufferStatus}(this->context(), GL_FRAMEBUFFER)};
+        const auto& ctx{this->context()};
+        const auto status{
+            uses_direct_state_access(ctx) ? gl_function{&GladGLContext::CheckNamedFramebufferStatus}(ctx, get_index(contextual_handle_view()), GL_FRAMEBUFFER)
+                                          : gl_function{&GladGLContext::CheckFramebufferStatus}(ctx, GL_FRAMEBUFFER)
+        };
         if(const auto optError{to_error_string(status)}; optError)
             throw std::runtime_error{std::format("Framebuffer incomplete: {}", optError.value())};
     }
@@ -19,10 +19,14 @@ namespace avocet::opengl {
 
         constexpr static auto identifier{ object_identifier::framebuffer};
         constexpr static auto caching_id{caching_identifier::framebuffer};
+        constexpr static bool direct_state_access{true};
 
         template<std::size_t N>
         static void generate(const decorated_context& ctx, raw_indices<N>& indices) {
-            gl_function{&GladGLContext::GenFramebuffers}(ctx, N, indices.data());
+            if(uses_direct_state_access(ctx))
+                gl_function{&GladGLContext::CreateFramebuffers}(ctx, N, indices.data());
+            else
+                gl_function{&GladGLContext::GenFramebuffers}(ctx, N, indices.data());
         }
 
         template<std::size_t N>
@@ -31,7 +35,7 @@ namespace avocet::opengl {
         }
 
         static void bind(decorated_contextual_resource_view h) {
-            gl_function{&GladGLContext::BindFramebuffer}(h.context(), GL_FRAMEBUFFER, get_index(h));
+            static_gl_function<&GladGLContext::BindFramebuffer>{}(h.context(), GL_FRAMEBUFFER, get_index(h));
         }
 
         static void configure(decorated_contextual_resource_view h, const configurator& config) {
@@ -56,15 +60,29 @@ namespace avocet::opengl {
             : generic_resource_type{ctx, framebuffer_lifecycle_events{}, {{fboConfig.label}}}
             , m_Texture{ctx, texConfig}
         {
-            gl_function{&GladGLContext::FramebufferTexture}(
-                ctx,
-                GL_FRAMEBUFFER,
-                GL_COLOR_ATTACHMENT0,
-                get_index(m_Texture.contextual_handle_view()),
-                0
-            );
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::NamedFramebufferTexture}(
+                    ctx,
+                    get_index(contextual_handle_view()),
+                    GL_COLOR_ATTACHMENT0,
+                    get_index(m_Texture.contextual_handle_view()),
+                    0
+                );
+            }
+            else {
+                gl_function{&GladGLContext::FramebufferTexture}(
+                    ctx,
+                    GL_FRAMEBUFFER,
+                    GL_COLOR_ATTACHMENT0,
+                    get_index(m_Texture.contextual_handle_view()),
+                    0
+                );
+            }
 
             check_framebuffer_status();
+
+            // Whichever the path, a newly constructed framebuffer is left bound, ready to be rendered to
+            do_utilize();
         }
 
         [[nodiscard]]
@@ -34,6 +34,24 @@ namespace avocet::opengl {
            }
     };
 
+    /// Lifecycles which, on contexts supporting it, create, configure and read back their resources without binding them
+    template<class LifeEvents>
+    concept direct_state_accessible = requires { requires LifeEvents::direct_state_access; };
+
+    [[nodiscard]]
+    inline bool uses_direct_state_access(const decorated_context& ctx) noexcept {
+        return ctx.fundamental_characteristics().direct_state_access_available();
+    }
+
+    template<class LifeEvents>
+    [[nodiscard]]
+    bool configured_without_binding(const decorated_context& ctx) noexcept {
+        if constexpr(direct_state_accessible<LifeEvents>)
+            return uses_direct_state_access(ctx);
+        else
+            return false;
+    }
+
     template<class LifeEvents>
     inline constexpr bool has_common_lifecycle_v{
            sequoia::pseudoregular<LifeEvents>
@@ -41,15 +59,20 @@ namespace avocet::opengl {
         && has_configure_event_v<LifeEvents>
     };
 
+    /// Resources such as queries are generated but are never bound
     template<class LifeEvents, num_resources NumResources>
-    concept standard_lifecycle_for =
+    concept generated_lifecycle_for =
            has_common_lifecycle_v<LifeEvents>
-        && has_bind_event_v<LifeEvents>
         && requires(const LifeEvents& lifeEvents, raw_indices<NumResources.value>&indices, decorated_contextual_resource_view crv) {
                lifeEvents.generate(crv.context(), indices);
                lifeEvents.destroy(crv.context(), indices);
            };
 
+    template<class LifeEvents, num_resources NumResources>
+    concept standard_lifecycle_for =
+           generated_lifecycle_for<LifeEvents, NumResources>
+        && has_bind_event_v<LifeEvents>;
+
     template<class LifeEvents>
     concept program_lifecycle =
            has_common_lifecycle_v<LifeEvents>
@@ -60,7 +83,7 @@ namespace avocet::opengl {
 
     template<class LifeEvents, num_resources NumResources>
     concept resource_lifecycle_for
-        =    ((NumResources  > num_resources{0}) && standard_lifecycle_for<LifeEvents, NumResources>)
+        =    ((NumResources  > num_resources{0}) && generated_lifecycle_for<LifeEvents, NumResources>)
           || ((NumResources == num_resources{1}) && program_lifecycle<LifeEvents>);
 
     template<num_resources NumResources, class LifeEvents>
@@ -86,6 +109,12 @@ namespace avocet::opengl {
             crv.context().utilize(self.life_events(), crv.handle());
         }
 
+        void utilize(this const resource_lifecycle_base& self, resourceful_contextual_resource_view crv, GLuint textureUnit)
+            requires has_utilization_event_v<LifeEvents> && (LifeEvents::caching_id == caching_identifier::texture_2d)
+        {
+            crv.context().utilize(self.life_events(), crv.handle(), textureUnit);
+        }
+
         void configure(this const resource_lifecycle_base& self, resourceful_contextual_resource_view crv, const configurator_type& config) {
             self.life_events().configure(crv, config);
         }
@@ -122,7 +151,7 @@ namespace avocet::opengl {
     template<num_resources NumResources, class LifeEvents>
     class resource_lifecycle;
 
-    template<num_resources NumResources, standard_lifecycle_for<NumResources> LifeEvents>
+    template<num_resources NumResources, generated_lifecycle_for<NumResources> LifeEvents>
     class resource_lifecycle<NumResources, LifeEvents> : public resource_lifecycle_base<NumResources, LifeEvents>
     {
     public:
@@ -209,7 +238,8 @@ namespace avocet::opengl {
                     throw std::runtime_error{"generic_resource - null resource"};
 
                 if constexpr (standard_lifecycle_for<LifeEvents, NumResources>) {
-                    do_utilize(ctxRsrc);
+                    if(!configured_without_binding<LifeEvents>(ctx))
+                        do_utilize(ctxRsrc);
                 }
 
                 m_Resource.lifecycle().configure(ctxRsrc, config);
@@ -252,6 +282,12 @@ namespace avocet::opengl {
 
         void do_utilize(this const generic_resource& self) requires (N == 1) { self.do_utilize(index<0>{}); }
 
+        void do_utilize_on_unit(this const generic_resource& self, GLuint textureUnit)
+            requires (N == 1) && (LifeEvents::caching_id == caching_identifier::texture_2d)
+        {
+            self.m_Resource.lifecycle().utilize(self.contextual_handle_view(index<0>{}), textureUnit);
+        }
+
         [[nodiscard]]
         const contextual_resource_handles<N>& contextual_handles() const noexcept { return m_Resource.contextual_handles(); }
 
@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Context/GLFunction.hpp"
+#include "avocet/OpenGL/Resources/GenericResource.hpp"
+#include "avocet/OpenGL/ResourceInfrastructure/Labels.hpp"
+#include "avocet/OpenGL/Utilities/Casts.hpp"
+
+#include <optional>
+
+namespace avocet::opengl {
+    enum class query_target : GLenum {
+        samples_passed       = GL_SAMPLES_PASSED,
+        any_samples_passed   = GL_ANY_SAMPLES_PASSED,
+        primitives_generated = GL_PRIMITIVES_GENERATED,
+        time_elapsed         = GL_TIME_ELAPSED,
+        timestamp            = GL_TIMESTAMP
+    };
+
+    template<query_target Target>
+    struct query_lifecycle_events {
+        constexpr static auto identifier{object_identifier::query};
+        constexpr static auto caching_id{caching_identifier::not_applicable};
+
+        struct configurator {
+            optional_label label;
+        };
+
+        template<std::size_t N>
+        static void generate(const decorated_context& ctx, raw_indices<N>& indices) {
+            gl_function{&GladGLContext::GenQueries}(ctx, N, indices.data());
+        }
+
+        template<std::size_t N>
+        static void destroy(const decorated_context& ctx, const raw_indices<N>& indices) {
+            gl_function{&GladGLContext::DeleteQueries}(ctx, N, indices.data());
+        }
+
+        /// A name returned by glGenQueries does not refer to a query object until the query is first issued,
+        /// before which it cannot be labelled
+        static void configure(decorated_contextual_resource_view crv, const configurator& config) {
+            if(!config.label)
+                return;
+
+            if constexpr(Target == query_target::timestamp) {
+                gl_function{&GladGLContext::QueryCounter}(crv.context(), get_index(crv), GL_TIMESTAMP);
+            }
+            else {
+                gl_function{&GladGLContext::BeginQuery}(crv.context(), to_gl_underlying_value<GLenum>(Target), get_index(crv));
+                gl_function{&GladGLContext::EndQuery}(crv.context(), to_gl_underlying_value<GLenum>(Target));
+            }
+
+            add_label(identifier, crv, config.label);
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const query_lifecycle_events&, const query_lifecycle_events&) noexcept = default;
+    };
+
+    template<query_target Target>
+    class query_object : public generic_resource<num_resources{1}, query_lifecycle_events<Target>> {
+    public:
+        constexpr static auto target{Target};
+        using generic_resource_type = generic_resource<num_resources{1}, query_lifecycle_events<Target>>;
+
+        query_object(const resourceful_context& ctx, const optional_label& label)
+            : generic_resource_type{ctx, query_lifecycle_events<Target>{}, {{label}}}
+        {}
+
+        void begin(this const query_object& self) requires (Target != query_target::timestamp) {
+            gl_function{&GladGLContext::BeginQuery}(self.context(), to_gl_underlying_value<GLenum>(Target), self.index());
+        }
+
+        void end(this const query_object& self) requires (Target != query_target::timestamp) {
+            gl_function{&GladGLContext::EndQuery}(self.context(), to_gl_underlying_value<GLenum>(Target));
+        }
+
+        void record_timestamp(this const query_object& self) requires (Target == query_target::timestamp) {
+            gl_function{&GladGLContext::QueryCounter}(self.context(), self.index(), GL_TIMESTAMP);
+        }
+
+        [[nodiscard]]
+        bool result_available() const {
+            GLuint available{};
+            gl_function{&GladGLContext::GetQueryObjectuiv}(this->context(), index(), GL_QUERY_RESULT_AVAILABLE, &available);
+            return available == GL_TRUE;
+        }
+
+        /// Never stalls the pipeline
+        [[nodiscard]]
+        std::optional<GLuint64> try_result() const {
+            return result_available() ? std::optional{result()} : std::nullopt;
+        }
+
+        /// Blocks until the result is available
+        [[nodiscard]]
+        GLuint64 result() const {
+            GLuint64 value{};
+            gl_function{&GladGLContext::GetQueryObjectui64v}(this->context(), index(), GL_QUERY_RESULT, &value);
+            return value;
+        }
+    private:
+        [[nodiscard]]
+        GLuint index() const noexcept { return get_index(this->contextual_handle_view()); }
+    };
+
+    using timestamp_query    = query_object<query_target::timestamp>;
+    using time_elapsed_query = query_object<query_target::time_elapsed>;
+}
@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Resources/Buffers.hpp"
+#include "avocet/OpenGL/Resources/Sync.hpp"
+
+#include <deque>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace avocet::opengl {
+    inline constexpr GLbitfield persistent_mapping_flags{GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT};
+
+    enum class indexed_buffer_target : GLenum {
+        uniform        = GL_UNIFORM_BUFFER,
+        shader_storage = GL_SHADER_STORAGE_BUFFER
+    };
+
+    template<class T>
+        requires is_legal_gl_buffer_value_type_v<T>
+    struct ring_buffer_lifecycle_events : common_buffer_lifecycle_events {
+        constexpr static auto caching_id{caching_identifier::not_applicable};
+
+        struct configurator {
+            std::size_t capacity{};
+            optional_label label;
+        };
+
+        /// Without direct state access, the storage is specified through GL_COPY_WRITE_BUFFER, so that
+        /// no binding relevant to drawing is disturbed
+        static void configure(decorated_contextual_resource_view crv, const configurator& config) {
+            const auto& ctx{crv.context()};
+            if(!buffer_storage_supported(ctx.fundamental_characteristics().version()))
+                throw std::runtime_error{"ring_buffer: persistently mapped storage requires OpenGL 4.4"};
+
+            if(!config.capacity)
+                throw std::runtime_error{"ring_buffer: capacity must be non-zero"};
+
+            const auto size{checked_conversion_to<GLsizeiptr>(sizeof(T) * config.capacity)};
+            if(uses_direct_state_access(ctx)) {
+                gl_function{&GladGLContext::NamedBufferStorage}(ctx, get_index(crv), size, nullptr, persistent_mapping_flags);
+            }
+            else {
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_WRITE_BUFFER, get_index(crv));
+                gl_function{&GladGLContext::BufferStorage}(ctx, GL_COPY_WRITE_BUFFER, size, nullptr, persistent_mapping_flags);
+            }
+
+            add_label(identifier, crv, config.label);
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const ring_buffer_lifecycle_events&, const ring_buffer_lifecycle_events&) noexcept = default;
+    };
+
+    template<class T>
+        requires is_legal_gl_buffer_value_type_v<T>
+    class ring_buffer;
+
+    /// A region of a ring_buffer, writable for as long as the allocation lives
+    template<class T>
+    class [[nodiscard]] ring_allocation {
+    public:
+        ring_allocation(ring_allocation&& other) noexcept
+            : m_Ring{std::exchange(other.m_Ring, nullptr)}
+            , m_Data{other.m_Data}
+            , m_Offset{other.m_Offset}
+        {}
+
+        ring_allocation& operator=(ring_allocation&& other) noexcept {
+            std::ranges::swap(m_Ring, other.m_Ring);
+            std::ranges::swap(m_Data, other.m_Data);
+            std::ranges::swap(m_Offset, other.m_Offset);
+            return *this;
+        }
+
+        ~ring_allocation() { if(m_Ring) m_Ring->release(); }
+
+        [[nodiscard]]
+        std::span<T> data() const noexcept { return m_Data; }
+
+        /// In elements, from the start of the buffer; for example, the base vertex of a draw
+        [[nodiscard]]
+        std::size_t offset() const noexcept { return m_Offset; }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept { return m_Data.size(); }
+    private:
+        friend ring_buffer<T>;
+
+        ring_buffer<T>* m_Ring{};
+        std::span<T> m_Data{};
+        std::size_t m_Offset{};
+
+        ring_allocation(ring_buffer<T>& ring, std::span<T> data, std::size_t offset)
+            : m_Ring{&ring}
+            , m_Data{data}
+            , m_Offset{offset}
+        {}
+    };
+
+    /// Streams data through storage which stays mapped for the lifetime of the buffer. Writes are made through
+    /// allocations; once the draws consuming them are issued, fence() marks the end of their use by the GPU.
+    /// Allocations wait for any fence guarding the region they reuse, throttling the CPU to the GPU.
+    /// The ring is pinned in memory, since allocations refer back to it.
+    template<class T>
+        requires is_legal_gl_buffer_value_type_v<T>
+    class ring_buffer : public generic_resource<num_resources{1}, ring_buffer_lifecycle_events<T>> {
+    public:
+        using value_type            = T;
+        using configurator          = ring_buffer_lifecycle_events<T>::configurator;
+        using generic_resource_type = generic_resource<num_resources{1}, ring_buffer_lifecycle_events<T>>;
+
+        ring_buffer(const resourceful_context& ctx, const configurator& config)
+            : generic_resource_type{ctx, ring_buffer_lifecycle_events<T>{}, {config}}
+            , m_Data{map(this->contextual_handle_view(), config.capacity)}
+        {}
+
+        ring_buffer(const ring_buffer&)            = delete;
+        ring_buffer& operator=(const ring_buffer&) = delete;
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept { return m_Data.size(); }
+
+        /// Hands out n contiguous elements, the offset of which is a multiple of alignment; blocks
+        /// while the GPU may still be reading the region. Throws if the region was written since the
+        /// last fence, in which case the capacity is too small for the data streamed between fences.
+        [[nodiscard]]
+        ring_allocation<T> allocate(std::size_t n, std::size_t alignment = 1) {
+            if(!n || (n > capacity()) || !alignment)
+                throw std::runtime_error{std::format("ring_buffer::allocate: cannot allocate {} elements, aligned to {}, from a ring of capacity {}", n, alignment, capacity())};
+
+            // Positions increase monotonically, and are reduced modulo the capacity only to address storage;
+            // it is the offset within the storage which is aligned, since the capacity need not be a multiple
+            auto offset{(m_Head % capacity() + alignment - 1) / alignment * alignment};
+            auto lap{m_Head - m_Head % capacity()};
+            if(offset + n > capacity()) {
+                lap += capacity();
+                offset = 0;
+            }
+
+            const auto begin{lap + offset}, end{begin + n};
+            if(const auto reused{end > capacity() ? end - capacity() : 0}; reused > m_Completed) {
+                if(reused > m_Fenced)
+                    throw std::runtime_error{std::format("ring_buffer::allocate: {} elements requested would overwrite data which has not been fenced", n)};
+
+                while(m_Fences.front().head < reused) m_Fences.pop_front();
+
+                m_Fences.front().sync.wait();
+                m_Completed = m_Fences.front().head;
+                m_Fences.pop_front();
+            }
+
+            m_Head = end;
+            ++m_Outstanding;
+            return {*this, m_Data.subspan(offset, n), offset};
+        }
+
+        /// To be called once the draws reading the allocations made since the previous fence have been issued
+        void fence() {
+            if(m_Outstanding)
+                throw std::runtime_error{std::format("ring_buffer::fence: {} allocations are still being written", m_Outstanding)};
+
+            if(m_Head == m_Fenced)
+                return;
+
+            m_Fences.push_back({fence_sync{this->context()}, m_Head});
+            m_Fenced = m_Head;
+        }
+
+        void bind_range(this const ring_buffer& self, indexed_buffer_target target, GLuint binding, const ring_allocation<T>& allocation) {
+            gl_function{&GladGLContext::BindBufferRange}(
+                self.context(),
+                to_gl_underlying_value<GLenum>(target),
+                binding,
+                get_index(self.contextual_handle_view()),
+                checked_conversion_to<GLintptr>(sizeof(T) * allocation.offset()),
+                checked_conversion_to<GLsizeiptr>(sizeof(T) * allocation.size())
+            );
+        }
+    private:
+        friend ring_allocation<T>;
+
+        struct pending_fence {
+            fence_sync sync;
+            std::size_t head{};
+        };
+
+        std::span<T> m_Data;
+        std::deque<pending_fence> m_Fences{};
+        std::size_t m_Head{}, m_Fenced{}, m_Completed{}, m_Outstanding{};
+
+        [[nodiscard]]
+        static std::span<T> map(resourceful_contextual_resource_view crv, std::size_t capacity) {
+            const auto& ctx{crv.context()};
+            const auto size{checked_conversion_to<GLsizeiptr>(sizeof(T) * capacity)};
+            void* ptr{};
+            if(uses_direct_state_access(ctx)) {
+                ptr = gl_function{&GladGLContext::MapNamedBufferRange}(ctx, get_index(crv), 0, size, persistent_mapping_flags);
+            }
+            else {
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GL_COPY_WRITE_BUFFER, get_index(crv));
+                ptr = gl_function{&GladGLContext::MapBufferRange}(ctx, GL_COPY_WRITE_BUFFER, 0, size, persistent_mapping_flags);
+            }
+
+            if(!ptr)
+                throw std::runtime_error{"ring_buffer: unable to map storage"};
+
+            return {static_cast<T*>(ptr), capacity};
+        }
+
+        void release() noexcept { --m_Outstanding; }
+    };
+}
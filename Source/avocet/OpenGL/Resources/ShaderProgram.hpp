@@ -38,7 +38,7 @@ namespace avocet::opengl {
         }
 
         static void use(decorated_contextual_resource_view crv) {
-            gl_function{ &GladGLContext::UseProgram }(crv.context(), get_index(crv));
+            static_gl_function<&GladGLContext::UseProgram>{}(crv.context(), get_index(crv));
         }
 
         static void configure(resourceful_contextual_resource_view progView, const configurator& config);
@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#include "avocet/OpenGL/Resources/Sync.hpp"
+#include "avocet/OpenGL/Context/GLFunction.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace avocet::opengl {
+    fence_sync::fence_sync(const decorated_context& ctx)
+        : m_Context{&ctx}
+        , m_Sync{gl_function{&GladGLContext::FenceSync}(ctx, GL_SYNC_GPU_COMMANDS_COMPLETE, 0)}
+    {
+        if(!m_Sync)
+            throw std::runtime_error{"fence_sync: unable to create fence"};
+    }
+
+    fence_sync::~fence_sync() {
+        if(m_Sync)
+            gl_function{&GladGLContext::DeleteSync}(*m_Context, m_Sync);
+    }
+
+    [[nodiscard]]
+    bool fence_sync::signaled() const {
+        const auto status{client_wait(0, 0)};
+        return (status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED);
+    }
+
+    bool fence_sync::wait(std::chrono::nanoseconds timeout) const {
+        const auto status{client_wait(GL_SYNC_FLUSH_COMMANDS_BIT, static_cast<GLuint64>(std::max(timeout.count(), std::chrono::nanoseconds::rep{})))};
+        return (status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED);
+    }
+
+    void fence_sync::wait() const {
+        while(!wait(std::chrono::nanoseconds{std::numeric_limits<std::chrono::nanoseconds::rep>::max()})) {}
+    }
+
+    [[nodiscard]]
+    GLenum fence_sync::client_wait(GLbitfield flags, GLuint64 timeout) const {
+        if(!m_Sync)
+            throw std::runtime_error{"fence_sync: null fence"};
+
+        const auto status{gl_function{&GladGLContext::ClientWaitSync}(*m_Context, m_Sync, flags, timeout)};
+        if(status == GL_WAIT_FAILED)
+            throw std::runtime_error{"fence_sync: wait failed"};
+
+        return status;
+    }
+}
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Context/DecoratedContext.hpp"
+
+#include <chrono>
+#include <utility>
+
+namespace avocet::opengl {
+    /// Owns a fence inserted into the command stream on construction. Unlike other resources,
+    /// syncs are identified by an opaque pointer rather than a name, and so are not generic_resources.
+    class fence_sync {
+    public:
+        explicit fence_sync(const decorated_context& ctx);
+
+        ~fence_sync();
+
+        fence_sync(fence_sync&& other) noexcept
+            : m_Context{other.m_Context}
+            , m_Sync{std::exchange(other.m_Sync, nullptr)}
+        {}
+
+        fence_sync& operator=(fence_sync&& other) noexcept {
+            std::ranges::swap(m_Context, other.m_Context);
+            std::ranges::swap(m_Sync, other.m_Sync);
+            return *this;
+        }
+
+        /// Never stalls the pipeline
+        [[nodiscard]]
+        bool signaled() const;
+
+        /// Blocks until the commands preceding the fence have completed, flushing them if necessary;
+        /// returns false if the timeout expires first
+        bool wait(std::chrono::nanoseconds timeout) const;
+
+        void wait() const;
+
+        [[nodiscard]]
+        bool is_null() const noexcept { return m_Sync == nullptr; }
+
+        [[nodiscard]]
+        friend bool operator==(const fence_sync&, const fence_sync&) noexcept = default;
+    private:
+        const decorated_context* m_Context{};
+        GLsync m_Sync{};
+
+        [[nodiscard]]
+        GLenum client_wait(GLbitfield flags, GLuint64 timeout) const;
+    };
+}
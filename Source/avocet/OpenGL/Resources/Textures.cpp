@@ -10,9 +10,20 @@
 namespace avocet::opengl {
 
     [[nodiscard]]
-    GLint extract_texture_2d_param(const decorated_context& ctx, GLenum paramName) {
+    GLint extract_texture_2d_param(decorated_contextual_resource_view crv, GLenum paramName) {
         GLint param{};
-        gl_function{&GladGLContext::GetTexLevelParameteriv}(ctx, GL_TEXTURE_2D, 0, paramName, &param);
+        if(uses_direct_state_access(crv.context()))
+            gl_function{&GladGLContext::GetTextureLevelParameteriv}(crv.context(), get_index(crv), 0, paramName, &param);
+        else
+            gl_function{&GladGLContext::GetTexLevelParameteriv}(crv.context(), GL_TEXTURE_2D, 0, paramName, &param);
+
         return param;
     }
+
+    void set_texture_parameter(decorated_contextual_resource_view crv, GLenum paramName, GLint param) {
+        if(uses_direct_state_access(crv.context()))
+            gl_function{&GladGLContext::TextureParameteri}(crv.context(), get_index(crv), paramName, param);
+        else
+            gl_function{&GladGLContext::TexParameteri}(crv.context(), GL_TEXTURE_2D, paramName, param);
+    }
 }
\ No newline at end of file
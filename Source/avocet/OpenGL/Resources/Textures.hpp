@@ -67,6 +67,22 @@ namespace avocet::opengl {
         throw std::runtime_error{std::format("to_internal_format: unrecognized value of texture_format, {}", to_gl_underlying_value<GLenum>(format))};
     }
 
+    /// Immutable storage, as allocated with direct state access, requires a sized format
+    [[nodiscard]]
+    constexpr GLenum to_sized_internal_format(texture_internal_format format) {
+        switch(format) {
+            using enum texture_internal_format;
+        case red  : return GL_R8;
+        case rg   : return GL_RG8;
+        case rgb  : return GL_RGB8;
+        case srgb : return GL_SRGB8;
+        case rgba : return GL_RGBA8;
+        case srgba: return GL_SRGB8_ALPHA8;
+        }
+
+        throw std::runtime_error{std::format("to_sized_internal_format: unrecognized value of texture_internal_format, {}", to_gl_underlying_value<GLint>(format))};
+    }
+
     [[nodiscard]]
     constexpr colour_channels to_num_channels(texture_format format) {
         switch(format) {
@@ -89,7 +105,10 @@ namespace avocet::opengl {
     }
 
     [[nodiscard]]
-    GLint extract_texture_2d_param(const decorated_context& ctx, GLenum paramName);
+    GLint extract_texture_2d_param(decorated_contextual_resource_view crv, GLenum paramName);
+
+    /// For use in a texture's parameter_setter, in which the texture is bound only in the absence of direct state access
+    void set_texture_parameter(decorated_contextual_resource_view crv, GLenum paramName, GLint param);
 
     template<gl_arithmetic T>
     struct raw_texture_2d_configurator {
@@ -110,11 +129,15 @@ namespace avocet::opengl {
 
     struct common_texture_2d_lifecycle_events {
         constexpr static auto identifier{ object_identifier::texture};
-        constexpr static auto caching_id{caching_identifier::opt_out};
+        constexpr static auto caching_id{caching_identifier::texture_2d};
+        constexpr static bool direct_state_access{true};
 
         template<std::size_t N>
         static void generate(const decorated_context& ctx, raw_indices<N>& indices) {
-            gl_function{&GladGLContext::GenTextures}(ctx, N, indices.data());
+            if(uses_direct_state_access(ctx))
+                gl_function{&GladGLContext::CreateTextures}(ctx, GL_TEXTURE_2D, N, indices.data());
+            else
+                gl_function{&GladGLContext::GenTextures}(ctx, N, indices.data());
         }
 
         template<std::size_t N>
@@ -123,7 +146,7 @@ namespace avocet::opengl {
         }
 
         static void bind(decorated_contextual_resource_view crv) {
-            gl_function{&GladGLContext::BindTexture}(crv.context(), GL_TEXTURE_2D, get_index(crv));
+            static_gl_function<&GladGLContext::BindTexture>{}(crv.context(), GL_TEXTURE_2D, get_index(crv));
         }
 
         template<class Self>
@@ -136,21 +159,44 @@ namespace avocet::opengl {
             using value_type = Self::configurator::value_type;
             const raw_texture_2d_configurator<value_type> rawConfig{Self::to_raw_configurator(config)};
 
-            gl_function{&GladGLContext::TexImage2D}(
-                crv.context(),
-                GL_TEXTURE_2D,
-                0,
-                to_gl_underlying_value<GLint>(to_internal_format(rawConfig.format, config.common_config.decoding)),
-                checked_conversion_to<GLsizei>(rawConfig.extent.width),
-                checked_conversion_to<GLsizei>(rawConfig.extent.height),
-                0,
-                to_gl_underlying_value<GLenum>(rawConfig.format),
-                to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>),
-                rawConfig.image_span.data()
-            );
+            const auto internalFormat{to_internal_format(rawConfig.format, config.common_config.decoding)};
+            const auto width{checked_conversion_to<GLsizei>(rawConfig.extent.width)}, height{checked_conversion_to<GLsizei>(rawConfig.extent.height)};
+            constexpr auto typeSpecifier{to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>)};
+
+            if(uses_direct_state_access(crv.context())) {
+                gl_function{&GladGLContext::TextureStorage2D}(crv.context(), get_index(crv), 1, to_sized_internal_format(internalFormat), width, height);
+                if(!rawConfig.image_span.empty()) {
+                    gl_function{&GladGLContext::TextureSubImage2D}(
+                        crv.context(),
+                        get_index(crv),
+                        0,
+                        0,
+                        0,
+                        width,
+                        height,
+                        to_gl_underlying_value<GLenum>(rawConfig.format),
+                        typeSpecifier,
+                        rawConfig.image_span.data()
+                    );
+                }
+            }
+            else {
+                gl_function{&GladGLContext::TexImage2D}(
+                    crv.context(),
+                    GL_TEXTURE_2D,
+                    0,
+                    to_gl_underlying_value<GLint>(internalFormat),
+                    width,
+                    height,
+                    0,
+                    to_gl_underlying_value<GLenum>(rawConfig.format),
+                    typeSpecifier,
+                    rawConfig.image_span.data()
+                );
+            }
 
             if(config.common_config.parameter_setter)
-                config.common_config.parameter_setter();
+                config.common_config.parameter_setter(crv);
         }
 
         [[nodiscard]]
@@ -161,9 +207,9 @@ namespace avocet::opengl {
     struct texture_configurator_common {
         using value_type = GLubyte;
 
-        sampling_decoding     decoding;
-        std::function<void()> parameter_setter;
-        optional_label        label{};
+        sampling_decoding                                       decoding;
+        std::function<void(decorated_contextual_resource_view)> parameter_setter;
+        optional_label                                          label{};
     };
 
     struct texture_2d_configurator {
@@ -244,11 +290,14 @@ namespace avocet::opengl {
 
         [[nodiscard]]
         unique_image extract_data(this const generic_texture_2d& self, texture_format format, alignment rowAlignment) {
-            self.do_utilize();
-
             const auto& ctx{self.context()};
-            const discrete_extent extent{checked_conversion_to<std::uint32_t>(extract_texture_2d_param(ctx, GL_TEXTURE_WIDTH)),
-                                         checked_conversion_to<std::uint32_t>(extract_texture_2d_param(ctx, GL_TEXTURE_HEIGHT))};
+            const bool direct{uses_direct_state_access(ctx)};
+            if(!direct)
+                self.do_utilize();
+
+            const auto crv{self.contextual_handle_view()};
+            const discrete_extent extent{checked_conversion_to<std::uint32_t>(extract_texture_2d_param(crv, GL_TEXTURE_WIDTH)),
+                                         checked_conversion_to<std::uint32_t>(extract_texture_2d_param(crv, GL_TEXTURE_HEIGHT))};
 
             const auto numChannels{to_num_channels(format)};
             const auto size{discrete_extent{padded_row_size(extent.width, numChannels, sizeof(value_type), rowAlignment), extent.height}.area()};
@@ -257,22 +306,32 @@ namespace avocet::opengl {
 
             gl_function{&GladGLContext::PixelStorei}(ctx, GL_PACK_ALIGNMENT, to_ogl_alignment(rowAlignment));
 
-            gl_function{&GladGLContext::GetTexImage}(
-                ctx,
-                GL_TEXTURE_2D,
-                0,
-                to_gl_underlying_value<GLenum>(format),
-                to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>),
-                texture.data()
-            );
+            if(direct) {
+                gl_function{&GladGLContext::GetTextureImage}(
+                    ctx,
+                    get_index(crv),
+                    0,
+                    to_gl_underlying_value<GLenum>(format),
+                    to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>),
+                    checked_conversion_to<GLsizei>(texture.size() * sizeof(value_type)),
+                    texture.data()
+                );
+            }
+            else {
+                gl_function{&GladGLContext::GetTexImage}(
+                    ctx,
+                    GL_TEXTURE_2D,
+                    0,
+                    to_gl_underlying_value<GLenum>(format),
+                    to_gl_underlying_value<GLenum>(to_gl_type_specifier_v<value_type>),
+                    texture.data()
+                );
+            }
 
             return {texture, extent, numChannels, rowAlignment};
         }
 
-        void bind(this const generic_texture_2d& self, texture_unit unit) {
-            gl_function{&GladGLContext::ActiveTexture}(self.context(), unit.gl_texture_unit());
-            self.do_utilize();
-        }
+        void bind(this const generic_texture_2d& self, texture_unit unit) { self.do_utilize_on_unit(unit.index); }
     protected:
         ~generic_texture_2d() = default;
 
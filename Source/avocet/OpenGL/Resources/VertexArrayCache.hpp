@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Resources/Buffers.hpp"
+
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
+
+namespace avocet::opengl {
+    /// Holds one vertex array per vertex format, whose attribute formats are specified once, and to which the buffers
+    /// of each draw are bound. Consecutive draws of geometry sharing a format therefore switch neither vertex array
+    /// nor, should the geometry also share buffers, anything else. Requires OpenGL 4.3.
+    class vertex_array_cache {
+    public:
+        vertex_array_cache(const resourceful_context& ctx, const optional_label& label)
+            : m_Context{&ctx}
+            , m_Label{label}
+        {
+            if(!vertex_attrib_binding_supported(ctx.fundamental_characteristics().version()))
+                throw std::runtime_error{"vertex_array_cache: separate attribute formats require OpenGL 4.3"};
+        }
+
+        /// The vertex array for the format, created on first request
+        template<class Vertex>
+            requires is_legal_gl_buffer_value_type_v<Vertex>
+        [[nodiscard]]
+        const vertex_attribute_object& vertex_array(std::type_identity<Vertex> layout) {
+            auto found{m_VertexArrays.find(typeid(Vertex))};
+            if(found == m_VertexArrays.end())
+                found = m_VertexArrays.emplace(typeid(Vertex), vertex_attribute_object{*m_Context, m_Label, layout}).first;
+
+            return found->second;
+        }
+
+        /// Binds the vertex array for the format of vbo, with vbo bound to binding point 0
+        template<class... Attributes, buffer_usage Usage>
+        const vertex_attribute_object& bind(const vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>, Usage>& vbo) {
+            const auto& vao{vertex_array(vertex_layout<sequoia::mem_ordered_tuple<Attributes...>>)};
+            vao.bind();
+            vao.bind_vertex_buffer(vbo);
+            return vao;
+        }
+
+        template<class... Attributes, buffer_usage VertexUsage, gl_integral T, buffer_usage ElementUsage>
+        const vertex_attribute_object& bind(const vertex_buffer_object<sequoia::mem_ordered_tuple<Attributes...>, VertexUsage>& vbo, const element_buffer_object<T, ElementUsage>& ebo) {
+            const auto& vao{bind(vbo)};
+            vao.bind_element_buffer(ebo);
+            return vao;
+        }
+
+        /// The number of distinct formats
+        [[nodiscard]]
+        std::size_t size() const noexcept { return m_VertexArrays.size(); }
+    private:
+        const resourceful_context* m_Context;
+        optional_label m_Label;
+        std::unordered_map<std::type_index, vertex_attribute_object> m_VertexArrays{};
+    };
+}
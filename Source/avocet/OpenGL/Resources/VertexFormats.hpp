@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/Context/Version.hpp"
+#include "avocet/OpenGL/Utilities/TypeTraits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+namespace avocet::opengl {
+    /// Integers which the vertex shader receives as floats in [0, 1] if unsigned, or [-1, 1] if signed. Wider
+    /// integers cannot be converted exactly from single precision, and would save no bandwidth if they could.
+    template<gl_integral T, std::size_t N>
+        requires (sizeof(T) <= 2) && (1 <= N) && (N <= 4)
+    struct normalized {
+        std::array<T, N> values{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const normalized&, const normalized&) noexcept = default;
+    };
+
+    /// IEEE binary16 values, which the vertex shader receives as floats. A wrapper is required since GLhalf is GLushort.
+    template<std::size_t N>
+        requires (1 <= N) && (N <= 4)
+    struct half_float {
+        std::array<GLhalf, N> values{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const half_float&, const half_float&) noexcept = default;
+    };
+
+    /// Four signed components, of 10 bits each for x, y and z and of 2 bits for w, packed from the least significant
+    /// bit upwards, which the vertex shader receives as floats in [-1, 1]. Suited to normals and tangents.
+    struct packed_snorm_10_10_10_2 {
+        GLuint bits{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(const packed_snorm_10_10_10_2&, const packed_snorm_10_10_10_2&) noexcept = default;
+    };
+
+    /// How the vertex shader converts a signed normalized integer, c, of b bits. From OpenGL 4.2, f = max(c / (2^(b-1) - 1), -1),
+    /// so that zero is exact. Before, and so on macOS, which stops at 4.1, f = (2c + 1) / (2^b - 1), for which it is not.
+    enum class snorm_convention { symmetric, asymmetric };
+
+    [[nodiscard]]
+    constexpr snorm_convention snorm_convention_for(opengl_version version) noexcept {
+        return version >= opengl_version{4, 2} ? snorm_convention::symmetric : snorm_convention::asymmetric;
+    }
+
+    namespace impl {
+        /// Clamps to [-1, 1] and then scales such that rounding gives the nearest signed integer whose maximum is max
+        [[nodiscard]]
+        constexpr GLfloat scale_snorm(GLfloat value, GLfloat max, snorm_convention convention) noexcept {
+            const auto clamped{std::clamp(value, -1.0f, 1.0f)};
+            return convention == snorm_convention::symmetric ? clamped * max : (clamped * (2 * max + 1) - 1) / 2;
+        }
+    }
+
+    /// Rounds to nearest, ties to even; values beyond the range of a half saturate to infinity
+    [[nodiscard]]
+    constexpr GLhalf to_half(GLfloat value) noexcept {
+        constexpr std::uint32_t f32Infinity{255u << 23}, f16Overflow{(127u + 16u) << 23}, f16MinNormal{113u << 23};
+        constexpr std::uint32_t denormMagic{((127u - 15u) + (23u - 10u) + 1u) << 23};
+
+        auto f{std::bit_cast<std::uint32_t>(value)};
+        const auto sign{f & 0x8000'0000u};
+        f ^= sign;
+
+        std::uint32_t h{};
+        if(f >= f16Overflow) {
+            h = (f > f32Infinity) ? 0x7e00u : 0x7c00u;
+        }
+        else if(f < f16MinNormal) {
+            // Adding the magic number shifts the mantissa into place, with the FPU doing the rounding
+            h = std::bit_cast<std::uint32_t>(std::bit_cast<GLfloat>(f) + std::bit_cast<GLfloat>(denormMagic)) - denormMagic;
+        }
+        else {
+            const auto mantissaOdd{(f >> 13) & 1u};
+            f += (std::uint32_t(15) << 23) - (std::uint32_t(127) << 23) + 0xfffu + mantissaOdd;
+            h = f >> 13;
+        }
+
+        return static_cast<GLhalf>(h | (sign >> 16));
+    }
+
+    [[nodiscard]]
+    constexpr GLfloat from_half(GLhalf value) noexcept {
+        constexpr std::uint32_t shiftedExponent{0x7c00u << 13};
+
+        std::uint32_t f{(value & 0x7fffu) << 13};
+        const auto exponent{f & shiftedExponent};
+        f += (127u - 15u) << 23;
+        if(exponent == shiftedExponent) {
+            f += (128u - 16u) << 23;
+        }
+        else if(!exponent) {
+            f += 1u << 23;
+            f = std::bit_cast<std::uint32_t>(std::bit_cast<GLfloat>(f) - std::bit_cast<GLfloat>(113u << 23));
+        }
+
+        return std::bit_cast<GLfloat>(f | ((value & 0x8000u) << 16));
+    }
+
+    /// Clamps to [-1, 1] for signed types and to [0, 1] for unsigned, and then rounds to the nearest representable value.
+    /// The convention matters only for signed types, and must match the version of the context which will read them.
+    template<gl_integral T>
+        requires (sizeof(T) <= 2)
+    [[nodiscard]]
+    constexpr T quantise(GLfloat value, snorm_convention convention = snorm_convention::symmetric) noexcept {
+        constexpr auto max{static_cast<GLfloat>(std::numeric_limits<T>::max())};
+        const auto scaled{std::is_signed_v<T> ? impl::scale_snorm(value, max, convention) : std::clamp(value, 0.0f, 1.0f) * max};
+        return static_cast<T>(scaled + (scaled < 0 ? -0.5f : 0.5f));
+    }
+
+    template<gl_integral T, std::size_t N>
+    [[nodiscard]]
+    constexpr normalized<T, N> make_normalized(std::span<const GLfloat, N> values, snorm_convention convention = snorm_convention::symmetric) noexcept {
+        normalized<T, N> n{};
+        std::ranges::transform(values, n.values.begin(), [convention](GLfloat v) { return quantise<T>(v, convention); });
+        return n;
+    }
+
+    template<std::size_t N>
+    [[nodiscard]]
+    constexpr half_float<N> make_half_float(std::span<const GLfloat, N> values) noexcept {
+        half_float<N> h{};
+        std::ranges::transform(values, h.values.begin(), to_half);
+        return h;
+    }
+
+    /// Each component is clamped to [-1, 1]; w defaults to 1, as for an absent fourth component
+    [[nodiscard]]
+    constexpr packed_snorm_10_10_10_2 make_packed_snorm_10_10_10_2(GLfloat x, GLfloat y, GLfloat z, GLfloat w = 1.0f, snorm_convention convention = snorm_convention::symmetric) noexcept {
+        const auto pack{
+            [convention](GLfloat v, GLfloat max, GLuint mask) {
+                const auto scaled{impl::scale_snorm(v, max, convention)};
+                return static_cast<GLuint>(static_cast<GLint>(scaled + (scaled < 0 ? -0.5f : 0.5f))) & mask;
+            }
+        };
+
+        return {pack(x, 511.0f, 0x3ffu) | (pack(y, 511.0f, 0x3ffu) << 10) | (pack(z, 511.0f, 0x3ffu) << 20) | (pack(w, 1.0f, 0x3u) << 30)};
+    }
+
+    /// Bulk conversions, for example of vertices generated in single precision, written as simple loops over
+    /// contiguous data so that the compiler may vectorise them
+    inline void convert_to_half(std::span<const GLfloat> source, std::span<GLhalf> destination) {
+        if(source.size() != destination.size())
+            throw std::runtime_error{std::format("convert_to_half: {} values cannot be converted into {}", source.size(), destination.size())};
+
+        std::ranges::transform(source, destination.begin(), to_half);
+    }
+
+    template<gl_integral T>
+        requires (sizeof(T) <= 2)
+    void convert_to_normalized(std::span<const GLfloat> source, std::span<T> destination, snorm_convention convention = snorm_convention::symmetric) {
+        if(source.size() != destination.size())
+            throw std::runtime_error{std::format("convert_to_normalized: {} values cannot be converted into {}", source.size(), destination.size())};
+
+        std::ranges::transform(source, destination.begin(), [convention](GLfloat v) { return quantise<T>(v, convention); });
+    }
+}
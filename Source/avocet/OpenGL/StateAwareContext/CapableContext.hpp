@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "avocet/Core/Geometry/Viewport.hpp"
+#include "avocet/Core/Utilities/ArithmeticCasts.hpp"
 #include "avocet/OpenGL/Capabilities/CapabilitiesConfiguration.hpp"
 #include "avocet/OpenGL/Context/GLFunction.hpp"
 #include "avocet/OpenGL/StateAwareContext/ResourcefulContext.hpp"
@@ -15,6 +17,13 @@
 #include "sequoia/Core/Meta/TypeAlgorithms.hpp"
 #include "sequoia/Core/Meta/Utilities.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
 namespace avocet::opengl {
     enum class attempt_to_compensate_for_driver_bugs : bool { no, yes };
 
@@ -25,6 +34,12 @@ namespace avocet::opengl {
             bool is_enabled{(T::capability == gl_capability::dither) or (T::capability == gl_capability::multi_sample)};
         };
 
+        /// For state which cannot be disabled
+        template<class T>
+        struct tracked_state {
+            T state{};
+        };
+
         using toggled_payload_type
             = std::tuple<
                   toggled_capability<capabilities::gl_blend>,
@@ -35,15 +50,22 @@ namespace avocet::opengl {
                   toggled_capability<capabilities::gl_polygon_offset_point>,
                   toggled_capability<capabilities::gl_sample_alpha_to_coverage>,
                   toggled_capability<capabilities::gl_sample_coverage>,
-                  toggled_capability<capabilities::gl_stencil_test>
+                  toggled_capability<capabilities::gl_stencil_test>,
+                  toggled_capability<capabilities::gl_cull_face>,
+                  toggled_capability<capabilities::gl_primitive_restart>,
+                  toggled_capability<capabilities::gl_program_point_size>,
+                  toggled_capability<capabilities::gl_scissor_test>,
+                  tracked_state<capabilities::gl_rasterization>
               >;
 
         mutable toggled_payload_type m_Payload{};
+        mutable capabilities::gl_clear_values m_ClearValues{};
+        mutable std::optional<viewport> m_Viewport{};
 
         template<class Cap>
         void disable(this const capable_context& self, toggled_capability<Cap>& cap) {
             if(cap.is_enabled) {
-                gl_function{&GladGLContext::Disable}(self, to_gl_underlying_value<GLenum>(Cap::capability));
+                static_gl_function<&GladGLContext::Disable>{}(self, to_gl_underlying_value<GLenum>(Cap::capability));
                 cap.is_enabled = false;
             }
         }
@@ -51,13 +73,13 @@ namespace avocet::opengl {
         template<class Cap>
         void enable(this const capable_context& self, toggled_capability<Cap>& cap) {
             if(!cap.is_enabled) {
-                gl_function{&GladGLContext::Enable}(self, to_gl_underlying_value<GLenum>(Cap::capability));
+                static_gl_function<&GladGLContext::Enable>{}(self, to_gl_underlying_value<GLenum>(Cap::capability));
                 cap.is_enabled = true;
             }
         }
 
-        template<class Cap>
-        void update_config(this const capable_context& self, toggled_capability<Cap>& current, const Cap& requested) {
+        template<class Tracked, class Cap>
+        void update_config(this const capable_context& self, Tracked& current, const Cap& requested) {
             if(current.state != requested) {
                 capabilities::impl::configure(self, current.state, requested);
                 current.state = requested;
@@ -76,6 +98,11 @@ namespace avocet::opengl {
                     self.update_config(current, requested.value());
             }
         }
+
+        template<class State>
+        void full_update(this const capable_context& self, tracked_state<State>& current, const std::optional<State>& requested) {
+            self.update_config(current, requested.value_or(State{}));
+        }
     public:
         using payload_type
             = std::tuple<
@@ -87,7 +114,12 @@ namespace avocet::opengl {
                   std::optional<capabilities::gl_polygon_offset_point>,
                   std::optional<capabilities::gl_sample_alpha_to_coverage>,
                   std::optional<capabilities::gl_sample_coverage>,
-                  std::optional<capabilities::gl_stencil_test>
+                  std::optional<capabilities::gl_stencil_test>,
+                  std::optional<capabilities::gl_cull_face>,
+                  std::optional<capabilities::gl_primitive_restart>,
+                  std::optional<capabilities::gl_program_point_size>,
+                  std::optional<capabilities::gl_scissor_test>,
+                  std::optional<capabilities::gl_rasterization>
               >;
 
         template<class Fn>
@@ -100,15 +132,195 @@ namespace avocet::opengl {
         capable_context(debugging_mode mode, Loader loader, Prologue prologue, Epilogue epilogue, attempt_to_compensate_for_driver_bugs compensate)
             : resourceful_context{mode, std::move(loader), std::move(prologue), std::move(epilogue)}
         {
-             sequoia::meta::for_each(m_Payload, [this](auto& cap) { disable(cap); });
+             sequoia::meta::for_each(m_Payload, [this](auto& cap) { if constexpr(requires { cap.is_enabled; }) disable(cap); });
+
+             // Unlike all other defaults, the initial scissor box depends on the window
+             const capabilities::gl_scissor_test& scissor{std::get<toggled_capability<capabilities::gl_scissor_test>>(m_Payload).state};
+             gl_function{&GladGLContext::Scissor}(*this, scissor.x, scissor.y, scissor.width, scissor.height);
+
              if(compensate == attempt_to_compensate_for_driver_bugs::yes)
                  capabilities::impl::compensate_for_driver_init_bugs(*this, capabilities::gl_stencil_test{});
         }
 
+        /// Only those clear values which differ from the current ones are set
+        void clear(this const capable_context& self, const capabilities::gl_clear_values& values, GLbitfield mask) {
+            if(values != self.m_ClearValues) {
+                capabilities::impl::configure(self, self.m_ClearValues, values);
+                self.m_ClearValues = values;
+            }
+
+            gl_function{&GladGLContext::Clear}(self, mask);
+        }
+
+        void new_viewport(this const capable_context& self, const viewport& requested) {
+            if(requested != self.m_Viewport) {
+                gl_function{&GladGLContext::Viewport}(
+                    self,
+                    requested.offset.x,
+                    requested.offset.y,
+                    checked_conversion_to<GLsizei>(requested.extent.width),
+                    checked_conversion_to<GLsizei>(requested.extent.height)
+                );
+
+                self.m_Viewport = requested;
+            }
+        }
+
+        /// A payload compiled against a particular context, which must outlive it. Each configured
+        /// capability is interned by the context, and the resulting ids packed into a 64-bit key.
+        /// Switching between blocks therefore costs a single comparison of keys and, if these differ,
+        /// work only for those capabilities whose ids have changed. Interned values are retained for the
+        /// lifetime of the context, so blocks are intended to be made up front, for a bounded set of
+        /// configurations; the scissor box, which may vary from frame to frame, is not interned.
+        class state_block {
+        public:
+            [[nodiscard]]
+            std::uint64_t key() const noexcept { return m_Key; }
+
+            [[nodiscard]]
+            const payload_type& payload() const noexcept { return m_Payload; }
+        private:
+            friend capable_context;
+
+            state_block(const capable_context& ctx, const payload_type& payload, std::uint64_t key)
+                : m_Context{&ctx}
+                , m_Payload{payload}
+                , m_Key{key}
+            {}
+
+            const capable_context* m_Context{};
+            payload_type m_Payload{};
+            std::uint64_t m_Key{};
+        };
+
+        /// Throws if a capability has more distinct configurations than its field of the key can identify
+        [[nodiscard]]
+        state_block make_state_block(this const capable_context& self, const payload_type& payload) {
+            const auto key{
+                [&] <std::size_t... Is>(std::index_sequence<Is...>) {
+                    return ((self.template intern<Is>(std::get<Is>(payload)) << field_offsets[Is]) | ...);
+                }(std::make_index_sequence<num_fields>{})
+            };
+
+            return {self, payload, key};
+        }
+
+        void new_payload(this const capable_context& self, const state_block& block) {
+            if(block.m_Context != &self)
+                throw std::runtime_error{"capable_context::new_payload: state block was made by a different context"};
+
+            const auto dirty{(self.m_Key ? dirty_fields(*self.m_Key, block.key()) : all_fields) | uninterned_fields};
+            [&] <std::size_t... Is>(std::index_sequence<Is...>) {
+                ((dirty & (1u << Is) ? self.full_update(std::get<Is>(self.m_Payload), std::get<Is>(block.payload())) : void()), ...);
+            }(std::make_index_sequence<num_fields>{});
+
+            self.m_Key = block.key();
+        }
+
+        /// Each capability is compared with the current state, rather than interned, so that transient
+        /// payloads consume nothing; the key of the current state is thereafter unknown
         void new_payload(this const capable_context& self, const payload_type& payload) {
             [&] <std::size_t... Is>(std::index_sequence<Is...>) {
                 (self.full_update(std::get<Is>(self.m_Payload), std::get<Is>(payload)), ...);
-            }(std::make_index_sequence<std::tuple_size_v<toggled_payload_type>>{});
+            }(std::make_index_sequence<num_fields>{});
+
+            self.m_Key.reset();
+        }
+    private:
+        constexpr static std::size_t num_fields{std::tuple_size_v<payload_type>};
+
+        template<std::size_t I>
+        using capability_type = std::tuple_element_t<I, payload_type>::value_type;
+
+        /// The scissor box is compared directly whenever a block is applied, since it commonly varies
+        /// from frame to frame, for example when clipping a user interface
+        template<class Cap>
+        constexpr static bool is_interned_v{!std::is_empty_v<Cap> && !std::same_as<Cap, capabilities::gl_scissor_test>};
+
+        /// Capabilities which are not interned need only record whether or not they are enabled; the
+        /// remaining bits are shared according to the expected number of distinct configurations
+        template<class Cap>
+        [[nodiscard]]
+        consteval static std::size_t field_width() {
+            using namespace capabilities;
+            if constexpr(!is_interned_v<Cap>)
+                return 1;
+            else if constexpr(std::same_as<Cap, gl_cull_face>)
+                return 3;
+            else if constexpr(std::same_as<Cap, gl_primitive_restart> || std::same_as<Cap, gl_sample_coverage>)
+                return 5;
+            else if constexpr(std::same_as<Cap, gl_depth_test>)
+                return 8;
+            else
+                return 10;
+        }
+
+        constexpr static std::array<std::size_t, num_fields> field_widths{
+            [] <std::size_t... Is>(std::index_sequence<Is...>) {
+                return std::array{field_width<capability_type<Is>>()...};
+            }(std::make_index_sequence<num_fields>{})
+        };
+
+        constexpr static std::array<std::size_t, num_fields> field_offsets{
+            [] {
+                std::array<std::size_t, num_fields> offsets{};
+                std::exclusive_scan(field_widths.begin(), field_widths.end(), offsets.begin(), 0uz);
+                return offsets;
+            }()
+        };
+
+        static_assert(field_offsets.back() + field_widths.back() <= 64);
+
+        constexpr static std::uint32_t all_fields{(1u << num_fields) - 1};
+
+        constexpr static std::uint32_t uninterned_fields{
+            [] <std::size_t... Is>(std::index_sequence<Is...>) {
+                return (((!std::is_empty_v<capability_type<Is>> && !is_interned_v<capability_type<Is>>) ? (1u << Is) : 0u) | ...);
+            }(std::make_index_sequence<num_fields>{})
+        };
+
+        template<class>
+        struct interned_values;
+
+        template<class... Caps>
+        struct interned_values<std::tuple<std::optional<Caps>...>> {
+            using type = std::tuple<std::vector<Caps>...>;
+        };
+
+        mutable interned_values<payload_type>::type m_Interned{};
+        /// Empty if the current state was last set by a payload, rather than a block
+        mutable std::optional<std::uint64_t> m_Key{std::uint64_t{}};
+
+        /// Zero signifies that the capability is disabled
+        template<std::size_t I>
+        [[nodiscard]]
+        std::uint64_t intern(this const capable_context& self, const std::optional<capability_type<I>>& cap) {
+            if(!cap)
+                return 0;
+
+            if constexpr(!is_interned_v<capability_type<I>>) {
+                return 1;
+            }
+            else {
+                auto& values{std::get<I>(self.m_Interned)};
+                auto found{std::ranges::find(values, cap.value())};
+                if(found == values.end()) {
+                    if(values.size() + 1 >= (1uz << field_widths[I]))
+                        throw std::runtime_error{"capable_context::make_state_block: too many distinct configurations of a capability"};
+
+                    found = values.insert(values.end(), cap.value());
+                }
+
+                return 1 + static_cast<std::uint64_t>(std::ranges::distance(values.begin(), found));
+            }
+        }
+
+        [[nodiscard]]
+        static std::uint32_t dirty_fields(std::uint64_t current, std::uint64_t key) noexcept {
+            const auto diff{key ^ current};
+            return [diff] <std::size_t... Is>(std::index_sequence<Is...>) {
+                return ((((diff >> field_offsets[Is]) & ((std::uint64_t{1} << field_widths[Is]) - 1)) ? (1u << Is) : 0u) | ...);
+            }(std::make_index_sequence<num_fields>{});
         }
     };
 }
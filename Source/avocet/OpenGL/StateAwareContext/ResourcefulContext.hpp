@@ -8,12 +8,19 @@
 #pragma once
 
 #include "avocet/OpenGL/Context/CharacteristicContext.hpp"
+#include "avocet/OpenGL/Context/GLFunction.hpp"
 
 #include "avocet/OpenGL/ResourceInfrastructure/ObjectIdentifiers.hpp"
 #include "avocet/OpenGL/ResourceInfrastructure/ContextualResourceView.hpp"
 
 #include "sequoia/Core/Meta/TypeAlgorithms.hpp"
 
+#include <algorithm>
+#include <ranges>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace avocet::opengl {
     struct num_resources {
         std::size_t value{};
@@ -64,15 +71,33 @@ namespace avocet::opengl {
         template<num_resources NumResources, class LifeEvents>
         friend class resource_lifecycle_base;
 
+        friend class vertex_attribute_object;
+
         template<caching_identifier id>
         struct index_cache {
             GLuint currently_active{};
         };
 
-        using tuple_t = std::tuple<index_cache<caching_identifier::framebuffer>, index_cache<caching_identifier::program>>;
+        using tuple_t
+            = std::tuple<
+                  index_cache<caching_identifier::framebuffer>,
+                  index_cache<caching_identifier::program>,
+                  index_cache<caching_identifier::vertex_array>,
+                  index_cache<caching_identifier::array_buffer>
+              >;
 
         mutable tuple_t m_Cache{};
 
+        /// The element array buffer binding is part of the state of a vertex array, and so is cached per vertex array
+        mutable std::unordered_map<GLuint, GLuint> m_ElementBufferCache{};
+
+        /// Likewise the vertex buffers, which are cached per vertex array and binding point
+        mutable std::unordered_map<GLuint, std::vector<GLuint>> m_VertexBufferCache{};
+
+        /// Indexed by texture unit
+        mutable std::vector<GLuint> m_TextureCache{};
+        mutable GLuint m_ActiveTextureUnit{};
+
         template<class LifeEvents>
             requires has_lifecycle_identifiers_v<LifeEvents>
         constexpr static bool opts_in_to_cache_v{
@@ -83,14 +108,26 @@ namespace avocet::opengl {
         template<class LifeEvents>
             requires has_lifecycle_identifiers_v<LifeEvents>
         constexpr static bool has_cache_v{
-            sequoia::meta::contains_v<tuple_t, index_cache<LifeEvents::caching_id>>
+               (LifeEvents::caching_id == caching_identifier::element_array_buffer)
+            || (LifeEvents::caching_id == caching_identifier::texture_2d)
+            || sequoia::meta::contains_v<tuple_t, index_cache<LifeEvents::caching_id>>
+        };
+
+        /// Deletion reverts bindings in the current context to zero, so the cache need merely be invalidated
+        template<class LifeEvents>
+            requires has_lifecycle_identifiers_v<LifeEvents>
+        constexpr static bool unbound_by_deletion_v{
+               (LifeEvents::caching_id == caching_identifier::vertex_array)
+            || (LifeEvents::caching_id == caching_identifier::array_buffer)
+            || (LifeEvents::caching_id == caching_identifier::element_array_buffer)
+            || (LifeEvents::caching_id == caching_identifier::texture_2d)
         };
 
         template<class LifeEvents>
             requires has_utilization_event_v<LifeEvents> && has_lifecycle_identifiers_v<LifeEvents>
         void utilize(this const resourceful_context& self, const LifeEvents& lifeEvents, const resource_handle& h) {
             if constexpr (opts_in_to_cache_v<LifeEvents>) {
-                if (auto& cache{self.get_cache(lifeEvents)}; cache.currently_active != h.index()) {
+                if (auto& cache{self.get_cache(lifeEvents)}; cache != h.index()) {
                     self.utilize_and_cache(lifeEvents, h, cache);
                 }
             }
@@ -102,11 +139,43 @@ namespace avocet::opengl {
             }
         }
 
+        /// If the texture is already bound to the unit, neither the unit is activated nor the texture bound
+        template<class LifeEvents>
+            requires has_bind_event_v<LifeEvents> && has_lifecycle_identifiers_v<LifeEvents> && (LifeEvents::caching_id == caching_identifier::texture_2d)
+        void utilize(this const resourceful_context& self, const LifeEvents& lifeEvents, const resource_handle& h, GLuint textureUnit) {
+            if (self.texture_cache(textureUnit) != h.index()) {
+                self.activate_texture_unit(textureUnit);
+                self.utilize_and_cache(lifeEvents, h, self.texture_cache(textureUnit));
+            }
+        }
+
         template<class LifeEvents>
             requires has_utilization_event_v<LifeEvents> && has_lifecycle_identifiers_v<LifeEvents>
         void reset(this const resourceful_context& self, const LifeEvents& lifeEvents, const resource_handle& h) {
-            if constexpr (opts_in_to_cache_v<LifeEvents>) {
-                if (auto& cache{self.get_cache(lifeEvents)}; cache.currently_active == h.index()) {
+            if constexpr (LifeEvents::caching_id == caching_identifier::element_array_buffer) {
+                for(auto& buffer : self.m_ElementBufferCache | std::views::values) {
+                    if(buffer == h.index()) buffer = 0;
+                }
+            }
+            else if constexpr (LifeEvents::caching_id == caching_identifier::texture_2d) {
+                std::ranges::replace(self.m_TextureCache, h.index(), GLuint{});
+            }
+            else if constexpr (unbound_by_deletion_v<LifeEvents>) {
+                if constexpr (LifeEvents::caching_id == caching_identifier::vertex_array) {
+                    self.m_ElementBufferCache.erase(h.index());
+                    self.m_VertexBufferCache.erase(h.index());
+                }
+                else if constexpr (LifeEvents::caching_id == caching_identifier::array_buffer) {
+                    for(auto& buffers : self.m_VertexBufferCache | std::views::values)
+                        std::ranges::replace(buffers, h.index(), GLuint{});
+                }
+
+                if (auto& cache{self.get_cache(lifeEvents)}; cache == h.index()) {
+                    cache = 0;
+                }
+            }
+            else if constexpr (opts_in_to_cache_v<LifeEvents>) {
+                if (auto& cache{self.get_cache(lifeEvents)}; cache == h.index()) {
                     self.utilize_and_cache(lifeEvents, resource_handle{}, cache);
                 }
             }
@@ -117,9 +186,9 @@ namespace avocet::opengl {
 
         template<class LifeEvents>
             requires has_utilization_event_v<LifeEvents>
-        void utilize_and_cache(this const resourceful_context& self, const LifeEvents& lifeEvents, const resource_handle& h, index_cache<LifeEvents::caching_id>& cache) {
+        void utilize_and_cache(this const resourceful_context& self, const LifeEvents& lifeEvents, const resource_handle& h, GLuint& cache) {
             self.do_utilize(lifeEvents, h);
-            cache.currently_active = h.index();
+            cache = h.index();
         }
 
         template<class LifeEvents>
@@ -134,11 +203,48 @@ namespace avocet::opengl {
             }
         }
 
+        /// Returns false if the buffer is already the element buffer of the vertex array
+        [[nodiscard]]
+        bool cache_element_buffer(this const resourceful_context& self, GLuint vertexArray, GLuint buffer) {
+            return std::exchange(self.m_ElementBufferCache[vertexArray], buffer) != buffer;
+        }
+
+        /// Returns false if the buffer is already bound to the binding point of the vertex array
+        [[nodiscard]]
+        bool cache_vertex_buffer(this const resourceful_context& self, GLuint vertexArray, GLuint binding, GLuint buffer) {
+            auto& buffers{self.m_VertexBufferCache[vertexArray]};
+            if(binding >= buffers.size())
+                buffers.resize(binding + 1);
+
+            return std::exchange(buffers[binding], buffer) != buffer;
+        }
+
+        void activate_texture_unit(this const resourceful_context& self, GLuint textureUnit) {
+            if(self.m_ActiveTextureUnit != textureUnit) {
+                static_gl_function<&GladGLContext::ActiveTexture>{}(self, GL_TEXTURE0 + textureUnit);
+                self.m_ActiveTextureUnit = textureUnit;
+            }
+        }
+
+        [[nodiscard]]
+        GLuint& texture_cache(this const resourceful_context& self, GLuint textureUnit) {
+            if(textureUnit >= self.m_TextureCache.size())
+                self.m_TextureCache.resize(textureUnit + 1);
+
+            return self.m_TextureCache[textureUnit];
+        }
+
         template<class LifeEvents>
-        index_cache<LifeEvents::caching_id>& get_cache(this const resourceful_context& self, const LifeEvents&) {
+        [[nodiscard]]
+        GLuint& get_cache(this const resourceful_context& self, const LifeEvents&) {
             static_assert(has_cache_v<LifeEvents>, "tuple_t does not contain the required caching_id");
 
-            return std::get<index_cache<LifeEvents::caching_id>>(self.m_Cache);
+            if constexpr (LifeEvents::caching_id == caching_identifier::element_array_buffer)
+                return self.m_ElementBufferCache[std::get<index_cache<caching_identifier::vertex_array>>(self.m_Cache).currently_active];
+            else if constexpr (LifeEvents::caching_id == caching_identifier::texture_2d)
+                return self.texture_cache(self.m_ActiveTextureUnit);
+            else
+                return std::get<index_cache<LifeEvents::caching_id>>(self.m_Cache).currently_active;
         }
     };
 }
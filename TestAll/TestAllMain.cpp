@@ -21,23 +21,42 @@
 #include "Core/Geometry/PolygonCoordinatesFreeTest.hpp"
 #include "Core/Geometry/ViewportTest.hpp"
 #include "Core/Geometry/ViewportTestingDiagnostics.hpp"
+#include "Core/Memory/BuddyAllocatorFreeTest.hpp"
 #include "Core/Utilities/ArithmeticCastsFreeTest.hpp"
 #include "OpenGL/Capabilities/CapabilitiesTest.hpp"
 #include "OpenGL/Capabilities/CapabilitiesTestingDiagnostics.hpp"
 #include "OpenGL/Capabilities/CapabilityManagerFreeTest.hpp"
+#include "OpenGL/Capabilities/StateBlockFreeTest.hpp"
+#include "OpenGL/Capture/CommandLogFreeTest.hpp"
+#include "OpenGL/Context/DecorationPolicyFreeTest.hpp"
+#include "OpenGL/Context/NullDriverFreeTest.hpp"
+#include "OpenGL/Context/StateShadowFreeTest.hpp"
 #include "OpenGL/Context/VersionFreeTest.hpp"
 #include "OpenGL/Debugging/IllegalGPUCallFreeTest.hpp"
 #include "OpenGL/Debugging/MultipleIllegalGPUCallsFreeTest.hpp"
 #include "OpenGL/Debugging/NullFunctionPointerFreeTest.hpp"
+#include "OpenGL/Geometry/InstancedPolygonFreeTest.hpp"
+#include "OpenGL/Geometry/MeshFreeTest.hpp"
 #include "OpenGL/Geometry/PolygonFreeTest.hpp"
+#include "OpenGL/Geometry/SharedPolygonFreeTest.hpp"
 #include "OpenGL/ResourceInfrastructure/ResourceHandleTest.hpp"
 #include "OpenGL/ResourceInfrastructure/ResourceHandleTestingDiagnostics.hpp"
+#include "OpenGL/Resources/BufferArenaFreeTest.hpp"
 #include "OpenGL/Resources/BufferMetaFreeTest.hpp"
 #include "OpenGL/Resources/BufferObjectLabellingTest.hpp"
 #include "OpenGL/Resources/BufferObjectTest.hpp"
 #include "OpenGL/Resources/BufferObjectTestingDiagnostics.hpp"
+#include "OpenGL/Profiling/CallTracerFreeTest.hpp"
+#include "OpenGL/Profiling/GPUProfilerFreeTest.hpp"
+#include "OpenGL/Rendering/DrawBatchFreeTest.hpp"
+#include "OpenGL/Rendering/RenderQueueFreeTest.hpp"
+#include "OpenGL/Resources/DirectStateAccessFreeTest.hpp"
+#include "OpenGL/Resources/DynamicBufferFreeTest.hpp"
 #include "OpenGL/Resources/FramebufferFreeTest.hpp"
 #include "OpenGL/Resources/FramebufferTrackingFreeTest.hpp"
+#include "OpenGL/Resources/MappedReadbackFreeTest.hpp"
+#include "OpenGL/Resources/RingBufferFreeTest.hpp"
+#include "OpenGL/Resources/SeparateVertexBuffersFreeTest.hpp"
 #include "OpenGL/Resources/ShaderProgramBrokenStagesFreeTest.hpp"
 #include "OpenGL/Resources/ShaderProgramBrokenUniformsFreeTest.hpp"
 #include "OpenGL/Resources/ShaderProgramFileExistenceFreeTest.hpp"
@@ -47,6 +66,9 @@
 #include "OpenGL/Resources/Texture2dLabellingTest.hpp"
 #include "OpenGL/Resources/Texture2dTest.hpp"
 #include "OpenGL/Resources/Texture2dTestingDiagnostics.hpp"
+#include "OpenGL/Resources/VertexArrayCacheFreeTest.hpp"
+#include "OpenGL/Resources/VertexFormatsFreeTest.hpp"
+#include "OpenGL/StateAwareContext/BindCacheFreeTest.hpp"
 #include "OpenGL/StateAwareContext/ResourcefulContextFreeTest.hpp"
 #include "OpenGL/Utilities/CastsFreeTest.hpp"
 #include "OpenGL/Utilities/MessagesFreeTest.hpp"
@@ -128,7 +150,8 @@ int main(int argc, char** argv)
             "Capability Manager",
             capabilities_false_negative_test{"False Negative Test"},
             capabilities_test{"Unit Test"},
-            capability_manager_free_test{"Capability Manager Free Test"}
+            capability_manager_free_test{"Capability Manager Free Test"},
+            state_block_free_test{"State Block Free Test"}
         );
 
         runner.add_test_suite(
@@ -174,6 +197,111 @@ int main(int argc, char** argv)
             version_free_test{"Version Free Test"}
         );
 
+        runner.add_test_suite(
+            "Decoration Policy",
+            decoration_policy_free_test{"Decoration Policy Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Null Driver",
+            null_driver_free_test{"Null Driver Free Test"}
+        );
+
+        runner.add_test_suite(
+            "State Shadow",
+            state_shadow_free_test{"State Shadow Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Call Tracer",
+            call_tracer_free_test{"Call Tracer Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Command Log",
+            command_log_free_test{"Command Log Free Test"}
+        );
+
+        runner.add_test_suite(
+            "GPU Profiler",
+            gpu_profiler_free_test{"GPU Profiler Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Render Queue",
+            render_queue_free_test{"Render Queue Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Bind Cache",
+            bind_cache_free_test{"Bind Cache Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Direct State Access",
+            direct_state_access_free_test{"Direct State Access Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Dynamic Buffers",
+            dynamic_buffer_free_test{"Dynamic Buffer Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Ring Buffer",
+            ring_buffer_free_test{"Ring Buffer Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Mapped Readback",
+            mapped_readback_free_test{"Mapped Readback Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Buddy Allocator",
+            buddy_allocator_free_test{"Buddy Allocator Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Buffer Arena",
+            buffer_arena_free_test{"Buffer Arena Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Shared Polygons",
+            shared_polygon_free_test{"Shared Polygon Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Instanced Polygons",
+            instanced_polygon_free_test{"Instanced Polygon Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Draw Batch",
+            draw_batch_free_test{"Draw Batch Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Meshes",
+            mesh_free_test{"Mesh Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Vertex Formats",
+            vertex_formats_free_test{"Vertex Formats Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Separate Vertex Buffers",
+            separate_vertex_buffers_free_test{"Separate Vertex Buffers Free Test"}
+        );
+
+        runner.add_test_suite(
+            "Vertex Array Cache",
+            vertex_array_cache_free_test{"Vertex Array Cache Free Test"}
+        );
+
         runner.add_test_suite(
             "Casts",
             casts_free_test{"Casts Free Test"}
@@ -0,0 +1,21 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+
+namespace curlew {
+    namespace agl = avocet::opengl;
+
+    /// An undecorated context, without debugging, whose calls are made to the driver; the driver must outlive it
+    [[nodiscard]]
+    inline agl::capable_context make_null_driver_context(agl::null_driver& driver) {
+        return {agl::debugging_mode::off, driver.loader(), agl::no_decoration{}, agl::no_decoration{}, agl::attempt_to_compensate_for_driver_bugs::no};
+    }
+}
@@ -24,7 +24,7 @@ namespace curlew {
         }
 
         void set_debug_context(const agl::debugging_mode mode, const agl::opengl_version& version) {
-            const bool advancedDebugging{(mode == agl::debugging_mode::dynamic) && agl::debug_output_supported(version)};
+            const bool advancedDebugging{agl::requests_debug_output(mode) && agl::debug_output_supported(version)};
             glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, advancedDebugging);
         }
 
@@ -155,7 +155,7 @@ namespace curlew {
     {}
 
     void window::update_viewport(const avocet::viewport& vp) {
-        agl::gl_function{&GladGLContext::Viewport}(m_Context, vp.offset.x, vp.offset.y, vp.extent.width, vp.extent.height);
+        m_Context.new_viewport(vp);
     }
 
     void window::make_context_current() {
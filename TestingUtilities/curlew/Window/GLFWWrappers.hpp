@@ -46,7 +46,7 @@ namespace curlew {
     std::vector<agl::message_id> ignored_warnings(const rendering_setup& setup);
 
     struct window_config {
-        using decorator_type = std::function<void(const agl::context&, const agl::decorator_data)>;
+        using decorator_type = agl::decoration_policy;
 
         avocet::discrete_extent extent{.width{800}, .height{600}};
         std::string name{};
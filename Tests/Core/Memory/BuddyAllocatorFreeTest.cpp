@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "BuddyAllocatorFreeTest.hpp"
+#include "avocet/Core/Memory/BuddyAllocator.hpp"
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path buddy_allocator_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void buddy_allocator_free_test::run_tests()
+    {
+        check_exception_thrown<std::runtime_error>("Capacity not a power of two", []() { return buddy_allocator{1000, 64}; });
+        check_exception_thrown<std::runtime_error>("Minimum block not a power of two", []() { return buddy_allocator{1024, 48}; });
+        check_exception_thrown<std::runtime_error>("Minimum block exceeds capacity", []() { return buddy_allocator{64, 128}; });
+
+        buddy_allocator allocator{1024, 64};
+        check(equality, "Largest free block", allocator.largest_free_block(), 1024uz);
+
+        check(equality, "Split down to 128", allocator.allocate(100).value(), 0uz);
+        check(equality, "Split down to the minimum", allocator.allocate(64).value(), 128uz);
+        check(equality, "Upper half", allocator.allocate(300).value(), 512uz);
+        check("Too large", !allocator.allocate(600));
+
+        check(equality, "Block size", allocator.block_size(128), 64uz);
+        check(equality, "Allocated", allocator.allocated(), 704uz);
+        check(equality, "Allocations", allocator.num_allocations(), 3uz);
+        check(equality, "Fragmented", allocator.largest_free_block(), 256uz);
+
+        check(equality, "Reuses the lowest remaining block", allocator.allocate(1).value(), 192uz);
+        allocator.free(192);
+
+        check_exception_thrown<std::runtime_error>("Freeing an unknown offset", [&allocator]() { allocator.free(32); });
+        check_exception_thrown<std::runtime_error>("Size of an unknown block", [&allocator]() { return allocator.block_size(256); });
+
+        allocator.free(0);
+        check(equality, "Buddy still live", allocator.largest_free_block(), 256uz);
+
+        allocator.free(128);
+        check(equality, "Coalesced lower half", allocator.largest_free_block(), 512uz);
+
+        allocator.free(512);
+        check("Fully coalesced", allocator == buddy_allocator{1024, 64});
+        check_exception_thrown<std::runtime_error>("Double free", [&allocator]() { allocator.free(512); });
+    }
+}
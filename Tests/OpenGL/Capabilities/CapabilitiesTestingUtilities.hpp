@@ -146,6 +146,44 @@ namespace sequoia::testing
         }
     };
 
+    template<>
+    struct value_tester<avocet::opengl::capabilities::gl_cull_face> {
+        template<test_mode Mode>
+        static void test(equality_check_t, test_logger<Mode>& logger, const agl::capabilities::gl_cull_face& obtained, const agl::capabilities::gl_cull_face& predicted) {
+            check(equality, "Face",       logger, obtained.face,       predicted.face);
+            check(equality, "Front Face", logger, obtained.front_face, predicted.front_face);
+        }
+    };
+
+    template<>
+    struct value_tester<avocet::opengl::capabilities::gl_scissor_test> {
+        template<test_mode Mode>
+        static void test(equality_check_t, test_logger<Mode>& logger, const agl::capabilities::gl_scissor_test& obtained, const agl::capabilities::gl_scissor_test& predicted) {
+            check(equality, "x",      logger, obtained.x,      predicted.x);
+            check(equality, "y",      logger, obtained.y,      predicted.y);
+            check(equality, "Width",  logger, obtained.width,  predicted.width);
+            check(equality, "Height", logger, obtained.height, predicted.height);
+        }
+    };
+
+    template<>
+    struct value_tester<avocet::opengl::capabilities::gl_primitive_restart> {
+        template<test_mode Mode>
+        static void test(equality_check_t, test_logger<Mode>& logger, const agl::capabilities::gl_primitive_restart& obtained, const agl::capabilities::gl_primitive_restart& predicted) {
+            check(equality, "Index", logger, obtained.index, predicted.index);
+        }
+    };
+
+    template<>
+    struct value_tester<avocet::opengl::capabilities::gl_rasterization> {
+        template<test_mode Mode>
+        static void test(equality_check_t, test_logger<Mode>& logger, const agl::capabilities::gl_rasterization& obtained, const agl::capabilities::gl_rasterization& predicted) {
+            check(equality, "Polygon Mode", logger, obtained.polygon_mode, predicted.polygon_mode);
+            check(equality, "Point Size",   logger, obtained.point_size,   predicted.point_size);
+            check(equality, "Line Width",   logger, obtained.line_width,   predicted.line_width);
+        }
+    };
+
     template<>
     struct value_tester<avocet::opengl::capable_context> {
         using payload_type = agl::capable_context::payload_type;
@@ -154,16 +192,21 @@ namespace sequoia::testing
         static void test(weak_equivalence_check_t, test_logger<Mode>& logger, const agl::capable_context& ctx, const payload_type& payload) {
             auto checkGPUState{
                     [&] <class Cap> (const std::optional<Cap>& cap) {
-                        testing::check(
-                            equality,
-                            std::format("{} is enabled", Cap::capability),
-                            logger,
-                            static_cast<bool>(agl::gl_function{&GladGLContext::IsEnabled}(ctx, to_gl_underlying_value<GLenum>(Cap::capability))),
-                            static_cast<bool>(cap)
-                        );
-
-                        if(cap)
-                            testing::check(weak_equivalence, "GPU State", logger, ctx, cap.value());
+                        if constexpr(agl::is_capability_v<Cap>) {
+                            testing::check(
+                                equality,
+                                std::format("{} is enabled", Cap::capability),
+                                logger,
+                                static_cast<bool>(agl::gl_function{&GladGLContext::IsEnabled}(ctx, to_gl_underlying_value<GLenum>(Cap::capability))),
+                                static_cast<bool>(cap)
+                            );
+
+                            if(cap)
+                                testing::check(weak_equivalence, "GPU State", logger, ctx, cap.value());
+                        }
+                        else {
+                            testing::check(weak_equivalence, "GPU State", logger, ctx, cap.value_or(Cap{}));
+                        }
                     }
             };
 
@@ -238,6 +281,34 @@ namespace sequoia::testing
 
             check_mask("Back Write Mask", logger, ctx, mask_names::stencil_back_writemask, predicted.back.write_mask.mask);
         }
+        template<test_mode Mode>
+        static void test(weak_equivalence_check_t, test_logger<Mode>& logger, const agl::capable_context& ctx, const agl::capabilities::gl_cull_face& predicted) {
+            using namespace avocet::opengl::testing;
+            using namespace avocet::opengl;
+            check(equality, "Face"      , logger, get_as<face_selection_mode>(ctx, int_names::cull_face_mode), predicted.face);
+            check(equality, "Front Face", logger, get_as<winding_order>      (ctx, int_names::front_face    ), predicted.front_face);
+        }
+
+        template<test_mode Mode>
+        static void test(weak_equivalence_check_t, test_logger<Mode>& logger, const agl::capable_context& ctx, const agl::capabilities::gl_scissor_test& predicted) {
+            using namespace avocet::opengl;
+            check(equality, "Box", logger, get(ctx, quadruple_int_names::scissor_box), std::array{predicted.x, predicted.y, predicted.width, predicted.height});
+        }
+
+        template<test_mode Mode>
+        static void test(weak_equivalence_check_t, test_logger<Mode>& logger, const agl::capable_context& ctx, const agl::capabilities::gl_primitive_restart& predicted) {
+            using namespace avocet::opengl::testing;
+            using namespace avocet::opengl;
+            check(equality, "Index", logger, get_as<GLuint>(ctx, int_names::primitive_restart_index), predicted.index);
+        }
+
+        /// GL_POLYGON_MODE may be reported as a pair of values, so is not checked
+        template<test_mode Mode>
+        static void test(weak_equivalence_check_t, test_logger<Mode>& logger, const agl::capable_context& ctx, const agl::capabilities::gl_rasterization& predicted) {
+            using namespace avocet::opengl;
+            check(equality, "Point Size", logger, get(ctx, float_names::point_size), predicted.point_size);
+            check(equality, "Line Width", logger, get(ctx, float_names::line_width), predicted.line_width);
+        }
     private:
       template<test_mode Mode>
       static void check_mask(std::string description, test_logger<Mode>& logger, const agl::capable_context& ctx, agl::mask_names name, GLuint predicted) {
@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "StateBlockFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using payload_type = agl::capable_context::payload_type;
+
+        template<class... Caps>
+        [[nodiscard]]
+        payload_type make_payload(const Caps&... caps) {
+            payload_type payload{};
+            ((std::get<std::optional<Caps>>(payload) = caps), ...);
+            return payload;
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path state_block_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void state_block_free_test::run_tests()
+    {
+        using namespace opengl;
+        using namespace opengl::capabilities;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const auto none{ctx.make_state_block({})};
+        const auto depth{ctx.make_state_block(make_payload(gl_depth_test{}))};
+        const auto depthAgain{ctx.make_state_block(make_payload(gl_depth_test{}))};
+        const auto depthWithOffset{ctx.make_state_block(make_payload(gl_depth_test{.poly_offset{.factor{}, .units{-1.0}}}, gl_polygon_offset_line{}))};
+        const auto depthAndBlend{ctx.make_state_block(make_payload(gl_depth_test{}, gl_blend{}))};
+
+        check(equality, "Nothing enabled", none.key(), std::uint64_t{});
+        check(equality, "Identical payloads share a key", depth.key(), depthAgain.key());
+        check("Distinct payloads have distinct keys", depth.key() != depthWithOffset.key());
+
+        driver.reset_call_counts();
+
+        ctx.new_payload(depth);
+        check("Depth test enabled", driver.is_enabled(GL_DEPTH_TEST));
+        check(equality, "Capability enabled once", driver.num_calls<&GladGLContext::Enable>(), 1uz);
+
+        ctx.new_payload(depthAgain);
+        check(equality, "Identical block issues no calls", driver.total_calls(), 1uz);
+
+        ctx.new_payload(depthAndBlend);
+        check("Blend enabled", driver.is_enabled(GL_BLEND));
+        check(equality, "Only the blend capability is touched", driver.num_calls<&GladGLContext::Enable>(), 2uz);
+        check(equality, "Depth test not reconfigured", driver.num_calls<&GladGLContext::DepthFunc>(), 0uz);
+
+        ctx.new_payload(depthWithOffset);
+        check("Blend disabled", !driver.is_enabled(GL_BLEND));
+        check("Polygon offset line enabled", driver.is_enabled(GL_POLYGON_OFFSET_LINE));
+        check(equality, "Depth test reconfigured", driver.num_calls<&GladGLContext::PolygonOffset>(), 1uz);
+
+        ctx.new_payload(none);
+        check("Depth test disabled", !driver.is_enabled(GL_DEPTH_TEST));
+        check("Polygon offset line disabled", !driver.is_enabled(GL_POLYGON_OFFSET_LINE));
+
+        ctx.new_payload(make_payload(gl_depth_test{}));
+        check("Payloads and blocks interoperate", driver.is_enabled(GL_DEPTH_TEST));
+
+        const auto wireframe{ctx.make_state_block(make_payload(gl_rasterization{.polygon_mode{polygon_rasterization_mode::line}}))};
+        const auto culled{ctx.make_state_block(make_payload(gl_cull_face{.face{face_selection_mode::front}}, gl_scissor_test{.x{1}, .y{2}, .width{3}, .height{4}}))};
+
+        driver.reset_call_counts();
+
+        ctx.new_payload(wireframe);
+        ctx.new_payload(wireframe);
+        check(equality, "Polygon mode set once", driver.num_calls<&GladGLContext::PolygonMode>(), 1uz);
+        check(equality, "Default point size retained", driver.num_calls<&GladGLContext::PointSize>(), 0uz);
+
+        ctx.new_payload(culled);
+        check(equality, "Absent rasterization state reverts to defaults", driver.num_calls<&GladGLContext::PolygonMode>(), 2uz);
+        check("Cull face enabled", driver.is_enabled(GL_CULL_FACE));
+        check("Scissor test enabled", driver.is_enabled(GL_SCISSOR_TEST));
+        check(equality, "Cull face configured", driver.num_calls<&GladGLContext::CullFace>(), 1uz);
+        check(equality, "Front face unchanged", driver.num_calls<&GladGLContext::FrontFace>(), 0uz);
+        check(equality, "Scissor box configured", driver.num_calls<&GladGLContext::Scissor>(), 1uz);
+
+        driver.reset_call_counts();
+
+        ctx.clear({.colour{0.2f, 0.3f, 0.3f, 1.0f}}, GL_COLOR_BUFFER_BIT);
+        ctx.clear({.colour{0.2f, 0.3f, 0.3f, 1.0f}}, GL_COLOR_BUFFER_BIT);
+        check(equality, "Clear colour set once", driver.num_calls<&GladGLContext::ClearColor>(), 1uz);
+        check(equality, "Default clear depth retained", driver.num_calls<&GladGLContext::ClearDepth>(), 0uz);
+        check(equality, "Every clear issued", driver.num_calls<&GladGLContext::Clear>(), 2uz);
+
+        ctx.new_viewport({.offset{0, 0}, .extent{800, 600}});
+        ctx.new_viewport({.offset{0, 0}, .extent{800, 600}});
+        check(equality, "Viewport set once", driver.num_calls<&GladGLContext::Viewport>(), 1uz);
+
+        const auto other{curlew::make_null_driver_context(driver)};
+        check_exception_thrown<std::runtime_error>("Block from a different context", [&other, &depth]() { other.new_payload(depth); });
+
+        test_interning_limits();
+    }
+
+    void state_block_free_test::test_interning_limits()
+    {
+        using namespace opengl;
+        using namespace opengl::capabilities;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        // Were these interned, the key would be exhausted within a few hundred iterations
+        driver.reset_call_counts();
+        for(int i{}; i < 1000; ++i)
+            ctx.new_payload(make_payload(gl_depth_test{.poly_offset{.factor{}, .units{static_cast<GLfloat>(i)}}}));
+
+        check(equality, "Transient payloads are not interned", driver.num_calls<&GladGLContext::PolygonOffset>(), 999uz);
+
+        driver.reset_call_counts();
+        for(GLint i{}; i < 1000; ++i)
+            ctx.new_payload(ctx.make_state_block(make_payload(gl_scissor_test{.x{i}, .y{}, .width{1}, .height{1}})));
+
+        check(equality, "Scissor boxes are not interned", driver.num_calls<&GladGLContext::Scissor>(), 1000uz);
+
+        const auto small{ctx.make_state_block(make_payload(gl_scissor_test{.x{}, .y{}, .width{1}, .height{1}}))};
+        const auto large{ctx.make_state_block(make_payload(gl_scissor_test{.x{}, .y{}, .width{100}, .height{100}}))};
+        check(equality, "Scissor boxes share a key", small.key(), large.key());
+
+        ctx.new_payload(small);
+        driver.reset_call_counts();
+        ctx.new_payload(large);
+        check(equality, "Scissor box compared despite equal keys", driver.num_calls<&GladGLContext::Scissor>(), 1uz);
+
+        const auto depth{ctx.make_state_block(make_payload(gl_depth_test{}))};
+        ctx.new_payload(depth);
+        ctx.new_payload(make_payload(gl_blend{}));
+        ctx.new_payload(depth);
+        check("Depth test enabled", driver.is_enabled(GL_DEPTH_TEST));
+        check("Block applied after a transient payload", !driver.is_enabled(GL_BLEND));
+
+        check_exception_thrown<std::runtime_error>(
+            "Precompiled configurations are bounded",
+            [&ctx]() {
+                for(int i{}; i < 1000; ++i)
+                    (void)ctx.make_state_block(make_payload(gl_depth_test{.poly_offset{.factor{}, .units{static_cast<GLfloat>(i)}}}));
+            }
+        );
+    }
+}
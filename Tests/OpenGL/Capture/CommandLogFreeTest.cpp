@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "CommandLogFreeTest.hpp"
+#include "avocet/OpenGL/Capture/CommandCapture.hpp"
+#include "avocet/OpenGL/Capture/CommandReplay.hpp"
+#include "avocet/OpenGL/Context/GLFunction.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+#include <array>
+#include <sstream>
+#include <string>
+
+namespace avocet::testing
+{
+    namespace
+    {
+        struct replay_observations
+        {
+            std::string uploaded{}, source{};
+            std::size_t draws{};
+            GLuint firstName{7};
+        };
+
+        replay_observations observed{};
+
+        [[nodiscard]]
+        GladGLContext make_stub_context()
+        {
+            GladGLContext ctx{};
+            ctx.BufferSubData = [](GLenum, GLintptr, GLsizeiptr size, const void* data) {
+                observed.uploaded.assign(static_cast<const char*>(data), static_cast<std::size_t>(size));
+            };
+            ctx.GenBuffers    = [](GLsizei n, GLuint* names) {
+                for(GLsizei i{}; i < n; ++i) names[i] = observed.firstName + static_cast<GLuint>(i);
+            };
+            ctx.CreateShader  = [](GLenum) -> GLuint { return 3; };
+            ctx.ShaderSource  = [](GLuint, GLsizei count, const GLchar* const* strings, const GLint*) {
+                for(GLsizei i{}; i < count; ++i) observed.source += strings[i];
+            };
+            ctx.DrawElements  = [](GLenum, GLsizei, GLenum, const void*) { ++observed.draws; };
+
+            return ctx;
+        }
+
+        /// Binds outside, inside and again outside a scoped_capture
+        template<class Context>
+        void make_scoped_calls(const Context& ctx, opengl::command_capture& capture)
+        {
+            using namespace opengl;
+
+            static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GLenum{GL_ARRAY_BUFFER}, GLuint{1});
+            {
+                const scoped_capture scope{capture};
+                static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GLenum{GL_ARRAY_BUFFER}, GLuint{2});
+                static_gl_function<&GladGLContext::BindVertexArray>{}(ctx, GLuint{3});
+            }
+            static_gl_function<&GladGLContext::BindBuffer>{}(ctx, GLenum{GL_ARRAY_BUFFER}, GLuint{4});
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path command_log_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void command_log_free_test::run_tests()
+    {
+        using namespace opengl;
+
+        const auto loc{std::source_location::current()};
+        command_capture capture{{5, 64}};
+
+        constexpr std::array<char, 6> vertices{'v', 'e', 'r', 't', 'e', 'x'};
+        capture.record({"BufferSubData", loc}, GLenum{GL_ARRAY_BUFFER}, GLintptr{}, GLsizeiptr{vertices.size()}, static_cast<const void*>(vertices.data()));
+
+        std::array<GLuint, 2> names{7, 8};
+        capture.record({"GenBuffers", loc}, GLsizei{2}, names.data());
+
+        capture.record_with_result({"CreateShader", loc}, GLuint{3}, GLenum{GL_VERTEX_SHADER});
+
+        const std::array<const GLchar*, 2> source{"void ", "main(){}"};
+        capture.record({"ShaderSource", loc}, GLuint{3}, GLsizei{2}, static_cast<const GLchar* const*>(source.data()), static_cast<const GLint*>(nullptr));
+
+        capture.record({"DrawElements", loc}, GLenum{GL_TRIANGLES}, GLsizei{6}, GLenum{GL_UNSIGNED_INT}, static_cast<const void*>(nullptr));
+
+        const auto log{capture.release()};
+        check(equality, "Calls captured", log.calls().size(), 5uz);
+
+        const auto uploadArgs{log.arguments(log.calls()[0])};
+        check(equality, "Upload snapshot", std::string(reinterpret_cast<const char*>(log.payload(uploadArgs[3]).data()), vertices.size()), std::string{"vertex"});
+        check("Generated names checked", log.arguments(log.calls()[1])[1].kind == argument_kind::checked_output);
+        check("Null offset", log.arguments(log.calls()[4])[3].kind == argument_kind::null);
+
+        std::stringstream stream{};
+        log.write(stream);
+        const auto readBack{command_log::read(stream)};
+
+        check(equality, "Calls round-tripped", readBack.calls().size(), log.calls().size());
+        check(equality, "Payload round-tripped", readBack.payload_bytes(), log.payload_bytes());
+
+        {
+            std::stringstream corrupt{"XXXX"};
+            check_exception_thrown<std::runtime_error>("Bad magic", [&corrupt]() { return command_log::read(corrupt); });
+        }
+
+        {
+            observed = {};
+            const auto report{replay(make_stub_context(), readBack)};
+
+            check(equality, "All calls replayed", report.replayed, 5uz);
+            check(equality, "No calls skipped", report.skipped, 0uz);
+            check(equality, "No divergences", report.divergences, 0uz);
+            check(equality, "Upload replayed", observed.uploaded, std::string{"vertex"});
+            check(equality, "Source replayed", observed.source, std::string{"void main(){}"});
+            check(equality, "Draw replayed", observed.draws, 1uz);
+        }
+
+        {
+            observed = {.firstName{9}};
+            auto ctx{make_stub_context()};
+            ctx.DrawElements = nullptr;
+            const auto report{replay(ctx, readBack)};
+
+            check(equality, "Null entry point skipped", report.skipped, 1uz);
+            check(equality, "Divergent names detected", report.divergences, 1uz);
+        }
+
+        {
+            null_driver driver{};
+            command_capture recorded{{2, 0}};
+            const fixed_decoration_context<no_decoration, capture_recorder> ctx{debugging_mode::off, driver.loader(), no_decoration{}, capture_recorder{recorded}};
+
+            make_scoped_calls(ctx, recorded);
+            check(equality, "Only calls within the scope captured", recorded.log().calls().size(), 2uz);
+            check("Recording stopped with the scope", !recorded.recording());
+            check(equality, "Calls forwarded to the driver", driver.num_calls<&GladGLContext::BindBuffer>(), 3uz);
+        }
+
+        {
+            null_driver driver{};
+            command_capture recorded{{2, 0}};
+            const capable_context ctx{debugging_mode::off, driver.loader(), no_decoration{}, capture_recorder{recorded}, attempt_to_compensate_for_driver_bugs::no};
+
+            make_scoped_calls(ctx, recorded);
+            check(equality, "Only calls within the scope captured through a decoration_policy", recorded.log().calls().size(), 2uz);
+        }
+    }
+}
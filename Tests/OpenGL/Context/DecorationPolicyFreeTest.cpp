@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "DecorationPolicyFreeTest.hpp"
+#include "avocet/OpenGL/Context/DecorationPolicy.hpp"
+#include "avocet/OpenGL/Context/GLFunction.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Debugging/DeferredErrorChecker.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path decoration_policy_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void decoration_policy_free_test::run_tests()
+    {
+        using namespace opengl;
+
+        const standard_error_checker checker{num_messages{10}, default_debug_info_processor{}};
+        auto logger{[](const context&, const decorator_data&) {}};
+
+        check("Default policy", decoration_policy{}.is_no_op());
+        check("no_decoration", decoration_policy{no_decoration{}}.is_no_op());
+        check("Empty runtime_decorator", decoration_policy{runtime_decorator{}}.is_no_op());
+        check("standard_error_checker with debugging off", decoration_policy{checker, debugging_mode::off}.is_no_op());
+        check("standard_error_checker with deferred debugging", decoration_policy{checker, debugging_mode::deferred}.is_no_op());
+
+        check("standard_error_checker with basic debugging", !decoration_policy{checker, debugging_mode::basic}.is_no_op());
+        check("standard_error_checker is not type erased", !decoration_policy{checker, debugging_mode::dynamic}.is_type_erased());
+        check("Runtime-wrapped standard_error_checker", decoration_policy{runtime_decorator{checker}, debugging_mode::off}.is_type_erased());
+        check("Arbitrary decorator", decoration_policy{logger}.is_type_erased());
+
+        deferred_error_checker deferredChecker{num_messages{10}, expected_calls{}};
+        check("deferred_call_recorder is not type erased", !decoration_policy{deferredChecker.recorder(), debugging_mode::deferred}.is_type_erased());
+
+        null_driver driver{};
+        const fixed_decoration_context<no_decoration, no_decoration> undecorated{debugging_mode::off, driver.loader(), no_decoration{}, no_decoration{}};
+        static_gl_function<&GladGLContext::Uniform1i>{}(undecorated, 0, 1);
+        check(equality, "Call through an undecorated context", driver.num_calls<&GladGLContext::Uniform1i>(), 1uz);
+
+        std::size_t numDecorated{};
+        auto counter{[&numDecorated](const context&, const decorator_data&) { ++numDecorated; }};
+        const fixed_decoration_context<no_decoration, decltype(counter)> counted{debugging_mode::off, driver.loader(), no_decoration{}, counter};
+
+        const auto numBefore{numDecorated};
+        static_gl_function<&GladGLContext::Uniform1i>{}(counted, 0, 1);
+        check(equality, "Statically typed epilogue", numDecorated - numBefore, 1uz);
+    }
+}
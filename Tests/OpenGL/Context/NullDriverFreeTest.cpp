@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "NullDriverFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path null_driver_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void null_driver_free_test::run_tests()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const standard_error_checker checker{num_messages{10}, default_debug_info_processor{}};
+        const capable_context ctx{debugging_mode::basic, driver.loader(), no_decoration{}, checker, attempt_to_compensate_for_driver_bugs::no};
+
+        check("Version", ctx.fundamental_characteristics().version() == opengl_version{4, 6});
+        check(equality, "Renderer", ctx.characteristics().renderer(), std::string{"Null Driver"});
+        check("Debug output enabled", driver.is_enabled(GL_DEBUG_OUTPUT));
+
+        driver.reset_call_counts();
+
+        {
+            const quad<GLfloat, dimensionality{2}> q{ctx, [](auto vertices) { return vertices; }, std::nullopt};
+            check(equality, "Buffers created", driver.num_calls<&GladGLContext::CreateBuffers>(), 2uz);
+            check(equality, "Vertex arrays created", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+
+            q.draw();
+            q.draw();
+            check(equality, "Draws", driver.num_calls<&GladGLContext::DrawElements>(), 2uz);
+            check("Debug log polled", driver.num_calls<&GladGLContext::GetDebugMessageLog>() > 0);
+        }
+
+        check(equality, "Buffers deleted", driver.num_calls<&GladGLContext::DeleteBuffers>(), 2uz);
+
+        {
+            capable_context::payload_type payload{};
+            std::get<std::optional<capabilities::gl_blend>>(payload) = capabilities::gl_blend{};
+            ctx.new_payload(payload);
+            check("Blending shadowed", driver.is_enabled(GL_BLEND));
+
+            ctx.new_payload({});
+            check("Blending disabled", !driver.is_enabled(GL_BLEND));
+        }
+
+        {
+            driver.set_integer(GL_MAX_TEXTURE_SIZE, 2048);
+            GLint maxSize{};
+            gl_function{&GladGLContext::GetIntegerv}(ctx, GL_MAX_TEXTURE_SIZE, &maxSize);
+            check(equality, "Overridden limit", maxSize, 2048);
+        }
+    }
+}
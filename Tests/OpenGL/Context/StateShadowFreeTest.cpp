@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "StateShadowFreeTest.hpp"
+#include "avocet/OpenGL/Context/GLGetters.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path state_shadow_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void state_shadow_free_test::run_tests()
+    {
+        test_queries();
+        test_redundant_calls();
+        test_validation();
+    }
+
+    void state_shadow_free_test::test_queries()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+        check("Shadow not validated", !ctx.validating_state_shadow());
+
+        driver.reset_call_counts();
+        check(equality, "Max texture size", get(ctx, int_names::max_texture_size), 16384);
+        check(equality, "Max texture size, again", get(ctx, int_names::max_texture_size), 16384);
+        check(equality, "Constant queried once", driver.num_calls<&GladGLContext::GetIntegerv>(), 1uz);
+
+        gl_function{&GladGLContext::BindBuffer}(ctx, GL_ARRAY_BUFFER, 3u);
+        check(equality, "Array buffer binding", get(ctx, int_names::array_buffer_binding), 3);
+
+        gl_function{&GladGLContext::Viewport}(ctx, 1, 2, 30, 40);
+        check(equality, "Viewport", get(ctx, quadruple_int_names::viewport), std::array{1, 2, 30, 40});
+
+        static_gl_function<&GladGLContext::Enable>{}(ctx, GL_DEPTH_TEST);
+        check("Depth test", get(ctx, bool_names::depth_test) == GL_TRUE);
+
+        gl_function{&GladGLContext::DepthRange}(ctx, -1.0, 0.5);
+        check(equality, "Depth range clamped", get(ctx, paired_float_names::depth_range), std::array{0.0f, 0.5f});
+
+        check(equality, "Bound state answered from the shadow", driver.num_calls<&GladGLContext::GetIntegerv>(), 1uz);
+        check(equality, "Capabilities answered from the shadow", driver.num_calls<&GladGLContext::GetBooleanv>(), 0uz);
+
+        gl_function{&GladGLContext::ActiveTexture}(ctx, GL_TEXTURE0 + 1);
+        gl_function{&GladGLContext::BindTexture}(ctx, GL_TEXTURE_2D, 5u);
+        gl_function{&GladGLContext::ActiveTexture}(ctx, GL_TEXTURE0);
+        check("Texture binding invalidated by a change of unit", !ctx.state_shadow().find<GLint>(GL_TEXTURE_BINDING_2D));
+
+        gl_function{&GladGLContext::BindBuffer}(ctx, GL_DISPATCH_INDIRECT_BUFFER, 4u);
+        check("Dispatch indirect binding", ctx.state_shadow().holds(GL_DISPATCH_INDIRECT_BUFFER_BINDING, GLint{4}));
+
+        gl_function{&GladGLContext::PatchParameteri}(ctx, GL_PATCH_VERTICES, 3);
+        check("Patch vertices", ctx.state_shadow().holds(GL_PATCH_VERTICES, GLint{3}));
+
+        STATIC_CHECK(!is_shadowed(GL_DRAW_BUFFER));
+        STATIC_CHECK(!is_shadowed(GL_TIMESTAMP));
+
+        check(equality, "Unshadowed state", get(ctx, int_names::samples), 0);
+        check(equality, "Unshadowed state queried", driver.num_calls<&GladGLContext::GetIntegerv>(), 2uz);
+    }
+
+    void state_shadow_free_test::test_redundant_calls()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        gl_function{&GladGLContext::Enable}(ctx, GL_BLEND);
+        gl_function{&GladGLContext::Enable}(ctx, GL_BLEND);
+        static_gl_function<&GladGLContext::Enable>{}(ctx, GL_BLEND);
+        check(equality, "Redundant enables elided", driver.num_calls<&GladGLContext::Enable>(), 1uz);
+
+        gl_function{&GladGLContext::Disable}(ctx, GL_BLEND);
+        check("Blending disabled", !driver.is_enabled(GL_BLEND));
+
+        gl_function{&GladGLContext::BlendFunc}(ctx, GL_ONE, GL_ZERO);
+        gl_function{&GladGLContext::BlendFuncSeparate}(ctx, GL_ONE, GL_ZERO, GL_ONE, GL_ZERO);
+        check(equality, "Redundant separate blend func elided", driver.num_calls<&GladGLContext::BlendFuncSeparate>(), 0uz);
+
+        gl_function{&GladGLContext::StencilMask}(ctx, 0xFF);
+        gl_function{&GladGLContext::StencilMask}(ctx, 0xFF);
+        check(equality, "Stencil masks are never elided", driver.num_calls<&GladGLContext::StencilMask>(), 2uz);
+
+        GLuint buffer{};
+        gl_function{&GladGLContext::GenBuffers}(ctx, 1, &buffer);
+        gl_function{&GladGLContext::BindBuffer}(ctx, GL_ARRAY_BUFFER, buffer);
+        gl_function{&GladGLContext::DeleteBuffers}(ctx, 1, &buffer);
+        gl_function{&GladGLContext::BindBuffer}(ctx, GL_ARRAY_BUFFER, buffer);
+        check(equality, "Binding after deletion not elided", driver.num_calls<&GladGLContext::BindBuffer>(), 2uz);
+    }
+
+    void state_shadow_free_test::test_validation()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const standard_error_checker checker{num_messages{10}, default_debug_info_processor{}};
+        const capable_context ctx{debugging_mode::basic, driver.loader(), no_decoration{}, checker, attempt_to_compensate_for_driver_bugs::no};
+        check("Shadow validated", ctx.validating_state_shadow());
+
+        check("Blend initially disabled", get(ctx, bool_names::blend) == GL_FALSE);
+        check("Consistent shadow", get(ctx, bool_names::blend) == GL_FALSE);
+
+        ctx.glad_context().Enable(GL_BLEND);
+        check_exception_thrown<std::runtime_error>("State changed behind the shadow's back", [&ctx]() { return get(ctx, bool_names::blend); });
+    }
+}
@@ -11,6 +11,8 @@
 
 #include "curlew/Window/GLFWWrappers.hpp"
 #include "avocet/OpenGL/Context/GLFunction.hpp"
+#include "avocet/OpenGL/Debugging/DeferredErrorChecker.hpp"
+#include "avocet/OpenGL/Debugging/Errors.hpp"
 
 #include "glad/gl.h"
 
@@ -28,6 +30,8 @@ namespace avocet::testing
     {
         test_with_best_available_debugging();
         test_with_basic_debugging();
+        test_with_asynchronous_debugging();
+        test_with_deferred_debugging();
     }
 
     void illegal_gpu_call_free_test::test_with_best_available_debugging()
@@ -56,4 +60,75 @@ namespace avocet::testing
             [&ctx](){ agl::gl_function{&GladGLContext::BindVertexArray}(ctx, 1729); }
         );
     }
-}
+
+    void illegal_gpu_call_free_test::test_with_asynchronous_debugging()
+    {
+        auto w{create_window({.hiding{window_hiding_mode::on}, .debug_mode{agl::debugging_mode::asynchronous}})};
+        const auto& ctx{w.context()};
+
+        // If debug output is unavailable, errors are instead detected at the call site
+        check_exception_thrown<std::runtime_error>(
+            "Illegal call to glBindBuffer, reported no later than the drain point",
+            [&ctx](){
+                agl::gl_function{&GladGLContext::BindBuffer}(ctx, 42, 42);
+                agl::gl_function{&GladGLContext::Finish}(ctx);
+                agl::check_for_asynchronous_errors(ctx, agl::default_debug_info_processor{});
+            }
+        );
+
+        check("Queue is empty after draining", agl::drain_asynchronous_messages(ctx).messages.empty());
+    }
+
+    void illegal_gpu_call_free_test::test_with_deferred_debugging()
+    {
+        agl::deferred_error_checker checker{agl::num_messages{10}, agl::expected_calls{16}};
+        auto w{create_window({.hiding{window_hiding_mode::on}, .debug_mode{agl::debugging_mode::deferred}, .epilogue{checker.recorder()}})};
+        const auto& ctx{w.context()};
+
+        const auto scope{
+            [&ctx](){
+                agl::gl_function{&GladGLContext::BindBuffer}(ctx, GL_ARRAY_BUFFER, 0);
+                agl::gl_function{&GladGLContext::BindVertexArray}(ctx, 1729);
+                agl::gl_function{&GladGLContext::BindBuffer}(ctx, GL_COPY_READ_BUFFER, 0);
+            }
+        };
+
+        check_exception_thrown<std::runtime_error>(
+            "Illegal call to glBindVertexArray, located by replaying the scope",
+            [&ctx, &checker, &scope](){ checker.check_scope(ctx, scope); }
+        );
+
+        check(equality, "Calls recorded in the scope", checker.recorded_calls().size(), 3uz);
+
+        std::string errorMessage{};
+        try {
+            checker.check_scope(ctx, scope);
+        }
+        catch(const std::runtime_error& e) {
+            errorMessage = e.what();
+        }
+
+        check("Culprit named in the error", errorMessage.contains("BindVertexArray"));
+
+        checker.check_scope(ctx, [&ctx](){ agl::gl_function{&GladGLContext::BindBuffer}(ctx, GL_COPY_WRITE_BUFFER, 0); });
+        check(equality, "Calls recorded in an error-free scope", checker.recorded_calls().size(), 1uz);
+
+        agl::gl_function{&GladGLContext::BindBuffer}(ctx, GL_ARRAY_BUFFER, 0);
+        check(equality, "Calls outside of a scope are not recorded", checker.recorded_calls().size(), 1uz);
+
+        agl::gl_function{&GladGLContext::BindVertexArray}(ctx, 1729);
+        std::string pendingMessage{};
+        try {
+            checker.check_scope(ctx, [&ctx](){ agl::gl_function{&GladGLContext::BindBuffer}(ctx, GL_COPY_WRITE_BUFFER, 0); });
+        }
+        catch(const std::runtime_error& e) {
+            pendingMessage = e.what();
+        }
+
+        check("Error from outside of a scope reported on entry", pendingMessage.contains("outside of any checked scope"));
+        check(equality, "Scope not run with errors pending", checker.recorded_calls().size(), 0uz);
+
+        checker.check_scope(ctx, [&ctx](){ agl::gl_function{&GladGLContext::BindBuffer}(ctx, GL_COPY_WRITE_BUFFER, 0); });
+        check(equality, "Pending errors drained", checker.recorded_calls().size(), 1uz);
+    }
+}
\ No newline at end of file
@@ -28,5 +28,9 @@ namespace avocet::testing
         void test_with_best_available_debugging();
 
         void test_with_basic_debugging();
+
+        void test_with_asynchronous_debugging();
+
+        void test_with_deferred_debugging();
     };
 }
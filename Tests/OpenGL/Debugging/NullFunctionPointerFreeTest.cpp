@@ -10,6 +10,7 @@
 #include "NullFunctionPointerFreeTest.hpp"
 
 #include "curlew/Window/GLFWWrappers.hpp"
+#include "avocet/Core/Preprocessor/PreprocessorDefs.hpp"
 #include "avocet/OpenGL/Context/GLFunction.hpp"
 
 #include "glad/gl.h"
@@ -34,5 +35,27 @@ namespace avocet::testing
                 agl::capable_context nothingLoaded{agl::debugging_mode::off, [](GladGLContext ctx) { return ctx; }, decorator_type{}, decorator_type{}, agl::attempt_to_compensate_for_driver_bugs::no};
             }
         );
+
+        check(equality, "Compile-time name of static_gl_function", agl::static_gl_function<&GladGLContext::Disable>::name, std::string_view{"Disable"});
+
+        if constexpr(!has_ndebug()) {
+            check_exception_thrown<std::runtime_error>(
+                "Invoking static_gl_function such that it delegates to a null function pointer",
+                []() {
+                    auto onlyGetString{
+                        [](GladGLContext ctx) {
+                            ctx.VERSION_4_1 = 1;
+                            ctx.GetString   = [](GLenum) -> const GLubyte* {
+                                static constexpr GLubyte name[]{'S', 't', 'u', 'b', '\0'};
+                                return name;
+                            };
+                            return ctx;
+                        }
+                    };
+
+                    agl::capable_context disableNotLoaded{agl::debugging_mode::off, onlyGetString, decorator_type{}, decorator_type{}, agl::attempt_to_compensate_for_driver_bugs::no};
+                }
+            );
+        }
     }
 }
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "InstancedPolygonFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/InstancedPolygon.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <vector>
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        /// A transform, a colour and a texture layer, occupying 4 + 1 + 1 locations
+        using instance_type = sequoia::mem_ordered_tuple<std::array<GLfloat, 16>, std::array<GLfloat, 4>, GLfloat>;
+        using quad_type     = agl::instanced_quad<GLfloat, agl::dimensionality{2}, instance_type>;
+        using triangle_type = agl::instanced_triangle<GLfloat, agl::dimensionality{2}, instance_type>;
+
+        constexpr auto identity{[](auto vertices) { return vertices; }};
+    }
+
+    [[nodiscard]]
+    std::filesystem::path instanced_polygon_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void instanced_polygon_free_test::run_tests()
+    {
+        test_direct_state_access();
+        test_instance_updates();
+        test_bind_to_edit();
+    }
+
+    void instanced_polygon_free_test::test_direct_state_access()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const std::vector<instance_type> instances(1000);
+
+        driver.reset_call_counts();
+        const quad_type q{ctx, identity, instances, std::nullopt};
+        check(equality, "Instances", q.num_instances(), 1000uz);
+        check(equality, "Two vertex buffer bindings", driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 2uz);
+        check(equality, "One instanced binding", driver.num_calls<&GladGLContext::VertexArrayBindingDivisor>(), 1uz);
+        check(equality, "Locations for both streams", driver.num_calls<&GladGLContext::VertexArrayAttribFormat>(), 7uz);
+        check(equality, "Locations bound", driver.num_calls<&GladGLContext::VertexArrayAttribBinding>(), 7uz);
+
+        driver.reset_call_counts();
+        q.draw();
+        check(equality, "One draw for every instance", driver.num_calls<&GladGLContext::DrawElementsInstanced>(), 1uz);
+        check(equality, "No per-instance draws", driver.num_calls<&GladGLContext::DrawElements>(), 0uz);
+
+        const triangle_type t{ctx, identity, instances, std::nullopt};
+        t.draw();
+        check(equality, "Triangles drawn from vertices", driver.num_calls<&GladGLContext::DrawArraysInstanced>(), 1uz);
+    }
+
+    void instanced_polygon_free_test::test_instance_updates()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        quad_type q{ctx, identity, std::span<const instance_type>{}, std::nullopt};
+
+        driver.reset_call_counts();
+        q.draw();
+        check(equality, "Nothing to draw", driver.num_calls<&GladGLContext::DrawElementsInstanced>(), 0uz);
+        check(equality, "Nothing bound", driver.num_calls<&GladGLContext::BindVertexArray>(), 0uz);
+
+        q.replace_instances(std::vector<instance_type>(10));
+        check(equality, "Grown", q.num_instances(), 10uz);
+
+        q.update_instances(8, std::vector<instance_type>(2));
+        check_exception_thrown<std::runtime_error>("Update beyond the instances", [&q]() { q.update_instances(9, std::vector<instance_type>(2)); });
+
+        q.draw();
+        check(equality, "Drawn", driver.num_calls<&GladGLContext::DrawElementsInstanced>(), 1uz);
+        check(equality, "No new buffers", driver.num_calls<&GladGLContext::CreateBuffers>(), 0uz);
+        check(equality, "No new vertex arrays", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 0uz);
+    }
+
+    void instanced_polygon_free_test::test_bind_to_edit()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 4}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        const quad_type q{ctx, identity, std::vector<instance_type>(3), std::nullopt};
+        check(equality, "Locations for both streams", driver.num_calls<&GladGLContext::VertexAttribPointer>(), 7uz);
+        check(equality, "Per-instance locations", driver.num_calls<&GladGLContext::VertexAttribDivisor>(), 6uz);
+        check(equality, "Direct state access calls", driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 0uz);
+
+        q.draw();
+        check(equality, "Drawn", driver.num_calls<&GladGLContext::DrawElementsInstanced>(), 1uz);
+    }
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "MeshFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Mesh.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using vertex_type = sequoia::mem_ordered_tuple<GLfloat, GLfloat>;
+        using mesh_type   = agl::mesh<vertex_type>;
+        using circle_type = agl::polygon_mesh<GLfloat, agl::dimensionality{2}>;
+
+        const std::vector<vertex_type> strip_vertices(7, vertex_type{0.0f, 0.0f});
+
+        /// Two strips, of four and three vertices
+        constexpr std::array<GLuint, 8> strip_indices{0, 1, 2, 3, agl::primitive_restart_marker, 4, 5, 6};
+
+        constexpr auto identity{[](auto vertices) { return vertices; }};
+    }
+
+    [[nodiscard]]
+    std::filesystem::path mesh_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void mesh_free_test::run_tests()
+    {
+        test_index_generation();
+        test_index_type_selection();
+        test_misuse();
+        test_bind_to_edit();
+    }
+
+    void mesh_free_test::test_index_generation()
+    {
+        using namespace opengl;
+
+        check(equality, "Pentagon triangles", polygon_triangle_indices(5), std::vector<GLuint>{0, 1, 2, 0, 2, 3, 0, 3, 4});
+        check(equality, "Pentagon strip", polygon_strip_indices(5), std::vector<GLuint>{0, 1, 4, 2, 3});
+        check(equality, "Quad strip", polygon_strip_indices(4), std::vector<GLuint>{0, 1, 3, 2});
+        check(equality, "Triangle strip", polygon_strip_indices(3), std::vector<GLuint>{0, 1, 2});
+        check(equality, "Strip of 512 vertices", polygon_strip_indices(512).size(), 512uz);
+        check(equality, "Triangles of 512 vertices", polygon_triangle_indices(512).size(), 1530uz);
+    }
+
+    void mesh_free_test::test_index_type_selection()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        {
+            const circle_type circle{ctx, 512, mesh_topology::triangle_strip, identity, std::nullopt};
+            check(equality, "Vertices", circle.num_vertices(), 512uz);
+            check(equality, "One index per vertex", circle.num_elements(), 512uz);
+            check("Short indices", circle.index_type() == gl_type_specifier::gl_ushort);
+            check("No restarts in a single strip", !circle.primitive_restart());
+
+            driver.reset_call_counts();
+            circle.draw();
+            check(equality, "One draw", driver.num_calls<&GladGLContext::DrawElements>(), 1uz);
+        }
+
+        {
+            const circle_type circle{ctx, 65535, mesh_topology::triangles, identity, std::nullopt};
+            check("Short indices at the limit", circle.index_type() == gl_type_specifier::gl_ushort);
+            check(equality, "Elements", circle.num_elements(), 3 * 65533uz);
+        }
+
+        {
+            const circle_type circle{ctx, 65536, mesh_topology::triangle_strip, identity, std::nullopt};
+            check("Int indices beyond the limit", circle.index_type() == gl_type_specifier::gl_uint);
+        }
+
+        {
+            const mesh_type strips{ctx, strip_vertices, strip_indices, mesh_topology::triangle_strip, std::nullopt};
+            check("Restart at the maximum short", strips.primitive_restart() == capabilities::gl_primitive_restart{65535});
+        }
+
+        {
+            const std::vector<vertex_type> vertices(70000, vertex_type{0.0f, 0.0f});
+            const mesh_type strips{ctx, vertices, strip_indices, mesh_topology::triangle_strip, std::nullopt};
+            check("Restart at the maximum int", strips.primitive_restart() == capabilities::gl_primitive_restart{primitive_restart_marker});
+        }
+    }
+
+    void mesh_free_test::test_misuse()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        check_exception_thrown<std::runtime_error>("No indices", [&ctx]() { return mesh_type{ctx, strip_vertices, {}, mesh_topology::triangles, std::nullopt}; });
+        check_exception_thrown<std::runtime_error>("Partial triangle", [&ctx]() { return mesh_type{ctx, strip_vertices, std::vector<GLuint>{0, 1, 2, 3}, mesh_topology::triangles, std::nullopt}; });
+        check_exception_thrown<std::runtime_error>("Index out of range", [&ctx]() { return mesh_type{ctx, strip_vertices, std::vector<GLuint>{0, 1, 7}, mesh_topology::triangles, std::nullopt}; });
+        check_exception_thrown<std::runtime_error>("Restart in a triangle list", [&ctx]() { return mesh_type{ctx, strip_vertices, std::vector<GLuint>{0, 1, primitive_restart_marker}, mesh_topology::triangles, std::nullopt}; });
+        check_exception_thrown<std::runtime_error>("Too few vertices", [&ctx]() { return circle_type{ctx, 2, mesh_topology::triangles, identity, std::nullopt}; });
+    }
+
+    void mesh_free_test::test_bind_to_edit()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 3}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const mesh_type strips{ctx, strip_vertices, strip_indices, mesh_topology::triangle_strip, std::nullopt};
+        strips.draw();
+        check(equality, "Drawn", driver.num_calls<&GladGLContext::DrawElements>(), 1uz);
+
+        const auto ebo{static_cast<GLuint>(driver.integer(GL_ELEMENT_ARRAY_BUFFER_BINDING))};
+        const auto storage{driver.buffer_storage(ebo)};
+        std::vector<GLushort> indices(storage.size() / sizeof(GLushort));
+        std::memcpy(indices.data(), storage.data(), storage.size());
+        check(equality, "Narrowed indices", indices, std::vector<GLushort>{0, 1, 2, 3, 65535, 4, 5, 6});
+    }
+}
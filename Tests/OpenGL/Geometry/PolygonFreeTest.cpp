@@ -62,14 +62,14 @@ namespace avocet::testing
         }
 
         [[nodiscard]]
-        texture_2d_configurator make_texture2d_configurator(const resourceful_context& ctx, image_view picture) {
+        texture_2d_configurator make_texture2d_configurator(image_view picture) {
             return {
                 .common_config{
                     .decoding{sampling_decoding::none},
                     .parameter_setter{
-                        [&ctx]() {
-                            gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-                            gl_function{&GladGLContext::TexParameteri}(ctx, GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                        [](decorated_contextual_resource_view crv) {
+                            set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                            set_texture_parameter(crv, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
                         }
                     },
                     .label{}
@@ -92,7 +92,7 @@ namespace avocet::testing
 
                     return verts;
                 },
-                to_array(images, [&ctx](image_view iv) { return make_texture2d_configurator(ctx, iv); }),
+                to_array(images, [](image_view iv) { return make_texture2d_configurator(iv); }),
                 make_label(describe_poly<CoordsValueType, TextureCoordsValueTypes...>(NumVertices, Dim))
             };
         }
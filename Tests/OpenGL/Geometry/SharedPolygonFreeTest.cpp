@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "SharedPolygonFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/SharedPolygon.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <optional>
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using quad_geometry     = agl::polygon_geometry<GLfloat, 4, agl::dimensionality{2}>;
+        using triangle_geometry = agl::polygon_geometry<GLfloat, 3, agl::dimensionality{2}>;
+
+        [[nodiscard]]
+        auto shift(GLfloat dx) {
+            return [dx](auto vertices) {
+                for(auto& vertex : vertices) {
+                    auto& coords{sequoia::get<0>(vertex)};
+                    coords = {coords[0] + dx, coords[1]};
+                }
+
+                return vertices;
+            };
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path shared_polygon_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void shared_polygon_free_test::run_tests()
+    {
+        test_shared_storage();
+        test_slots();
+    }
+
+    void shared_polygon_free_test::test_shared_storage()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        quad_geometry geometry{ctx, std::nullopt, 2};
+        check(equality, "Buffers", driver.num_calls<&GladGLContext::CreateBuffers>(), 2uz);
+        check(equality, "Vertex arrays", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+        check(equality, "Capacity", geometry.capacity(), 2uz);
+
+        const quad_geometry::polygon_type a{geometry, shift(1.0f)}, b{geometry, shift(-1.0f)};
+        check(equality, "First base vertex", a.base_vertex(), 4uz);
+        check(equality, "Second base vertex", b.base_vertex(), 8uz);
+        check(equality, "No buffers per polygon", driver.num_calls<&GladGLContext::CreateBuffers>(), 2uz);
+        check(equality, "No vertex arrays per polygon", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+        check(equality, "Uploads", driver.num_calls<&GladGLContext::NamedBufferSubData>(), 3uz);
+
+        driver.reset_call_counts();
+        a.draw();
+        b.draw();
+        geometry.draw_instanced(1000);
+        check(equality, "Base-vertex draws", driver.num_calls<&GladGLContext::DrawElementsBaseVertex>(), 2uz);
+        check(equality, "Instanced draws", driver.num_calls<&GladGLContext::DrawElementsInstanced>(), 1uz);
+        check(equality, "Vertex array bound once", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+
+        triangle_geometry triangles{ctx, std::nullopt};
+        const triangle_geometry::polygon_type t{triangles, shift(0.5f)};
+        check(equality, "Triangle base vertex", t.base_vertex(), 3uz);
+        t.draw();
+        check(equality, "Triangles drawn by element", driver.num_calls<&GladGLContext::DrawElementsBaseVertex>(), 3uz);
+    }
+
+    void shared_polygon_free_test::test_slots()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        quad_geometry geometry{ctx, std::nullopt};
+        check(equality, "No reserved capacity", geometry.capacity(), 0uz);
+
+        driver.reset_call_counts();
+        const quad_geometry::polygon_type a{geometry, shift(1.0f)};
+        std::optional<quad_geometry::polygon_type> b{std::in_place, geometry, shift(2.0f)};
+        const quad_geometry::polygon_type c{geometry, shift(3.0f)};
+        check(equality, "Grown geometrically", geometry.capacity(), 4uz);
+        check(equality, "Growth copies on the GPU", driver.num_calls<&GladGLContext::CopyNamedBufferSubData>(), 3uz);
+        check(equality, "Vertex array rebuilt with each buffer", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 3uz);
+        check(equality, "Polygons", geometry.num_polygons(), 3uz);
+
+        b.reset();
+        check(equality, "Slot released", geometry.num_polygons(), 2uz);
+
+        driver.reset_call_counts();
+        quad_geometry::polygon_type d{geometry, shift(4.0f)};
+        check(equality, "Slot reused", d.base_vertex(), 8uz);
+        check(equality, "No growth", driver.num_calls<&GladGLContext::CreateBuffers>(), 0uz);
+
+        const quad_geometry::polygon_type e{std::move(d)};
+        check("Moved from", d.is_null());
+        check(equality, "Slot moved", e.base_vertex(), 8uz);
+        check(equality, "Polygons after move", geometry.num_polygons(), 3uz);
+    }
+}
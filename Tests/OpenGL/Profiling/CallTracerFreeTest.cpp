@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "CallTracerFreeTest.hpp"
+#include "avocet/OpenGL/Profiling/CallTracer.hpp"
+
+#include <sstream>
+#include <thread>
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path call_tracer_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void call_tracer_free_test::run_tests()
+    {
+        using namespace opengl;
+
+        call_tracer tracer{events_per_thread{2}};
+
+        {
+            trace_zone outer{&tracer, "Outer"};
+            {
+                trace_zone inner{&tracer, "Inner \"quoted\""};
+            }
+        }
+
+        {
+            trace_zone nullZone{nullptr, "Ignored"};
+        }
+
+        check(equality, "No events dropped", tracer.num_dropped(), 0uz);
+
+        {
+            std::ostringstream stream{};
+            tracer.write_chrome_trace(stream);
+            const auto trace{stream.str()};
+
+            check("Trace events array", trace.starts_with(R"({"traceEvents":[)"));
+            check("Inner zone, escaped", trace.find(R"("name":"Inner \"quoted\"","cat":"zone","ph":"X")") != std::string::npos);
+            check("Outer zone", trace.find(R"("name":"Outer","cat":"zone","ph":"X")") != std::string::npos);
+            check("Zone on null tracer", trace.find("Ignored") == std::string::npos);
+        }
+
+        {
+            trace_zone overflow{&tracer, "Overflow"};
+        }
+
+        check(equality, "Event beyond capacity dropped", tracer.num_dropped(), 1uz);
+
+        std::jthread{[&tracer]() { trace_zone zone{&tracer, "Worker"}; }}.join();
+
+        {
+            std::ostringstream stream{};
+            tracer.write_chrome_trace(stream);
+            check("Second thread given its own buffer", stream.str().find(R"("name":"Worker","cat":"zone","ph":"X")") != std::string::npos);
+            check("Second thread given its own tid", stream.str().find(R"("tid":1,)") != std::string::npos);
+        }
+
+        tracer.clear();
+        check(equality, "Dropped count reset", tracer.num_dropped(), 0uz);
+
+        {
+            call_tracer other{events_per_thread{2}};
+            for(int i{}; i < 2; ++i) {
+                trace_zone first{&tracer, "Alternating"};
+                trace_zone second{&other, "Alternating"};
+            }
+
+            std::ostringstream stream{};
+            other.write_chrome_trace(stream);
+            const auto trace{stream.str()};
+            const auto firstEvent{trace.find(R"("name":"Alternating")")};
+            check("Alternating tracers each record", firstEvent != std::string::npos && trace.find(R"("name":"Alternating")", firstEvent + 1) != std::string::npos);
+            check("Alternating tracers share no buffer", trace.find(R"("tid":1,)") == std::string::npos);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "GPUProfilerFreeTest.hpp"
+#include "avocet/OpenGL/Profiling/GPUProfiler.hpp"
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path gpu_profiler_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void gpu_profiler_free_test::run_tests()
+    {
+        using namespace opengl;
+
+        auto win{create_default_window({1, 1})};
+        const auto& ctx{win.context()};
+
+        {
+            time_elapsed_query query{ctx, "Elapsed"};
+            query.begin();
+            gl_function{&GladGLContext::Clear}(ctx, GL_COLOR_BUFFER_BIT);
+            query.end();
+            gl_function{&GladGLContext::Finish}(ctx);
+
+            check("Time elapsed query available after glFinish", query.try_result().has_value());
+        }
+
+        gpu_profiler profiler{ctx, frames_in_flight{2}, zones_per_frame{2}};
+
+        check_exception_thrown<std::runtime_error>("Zone opened before the first frame", [&profiler]() { gpu_zone zone{&profiler, "Early"}; });
+
+        profiler.begin_frame();
+        {
+            gpu_zone outer{&profiler, "Outer"};
+            gl_function{&GladGLContext::Clear}(ctx, GL_COLOR_BUFFER_BIT);
+            {
+                gpu_zone inner{&profiler, "Inner"};
+                gl_function{&GladGLContext::Clear}(ctx, GL_COLOR_BUFFER_BIT);
+            }
+
+            gpu_zone overflow{&profiler, "Overflow"};
+        }
+
+        check(equality, "Zone beyond capacity dropped", profiler.num_dropped_zones(), 1uz);
+        check("No timings before the frame is read back", !profiler.latest_frame().has_value());
+
+        profiler.open_zone("Unclosed");
+        check_exception_thrown<std::runtime_error>("Frame begun with an open zone", [&profiler]() { profiler.begin_frame(); });
+        profiler.close_zone();
+
+        gl_function{&GladGLContext::Finish}(ctx);
+        profiler.begin_frame();
+
+        check(equality, "Frame read back", profiler.latest_frame(), std::optional{0uz});
+        check(equality, "Dropped frames", profiler.num_dropped_frames(), 0uz);
+
+        const auto timings{profiler.latest_timings()};
+        check(equality, "Number of timings", timings.size(), 2uz);
+        if(timings.size() == 2) {
+            check(equality, "Outer zone name",   timings[0].name,  std::string_view{"Outer"});
+            check(equality, "Outer zone depth",  timings[0].depth, 0uz);
+            check(equality, "Outer zone start",  timings[0].start, std::chrono::nanoseconds{});
+            check(equality, "Inner zone name",   timings[1].name,  std::string_view{"Inner"});
+            check(equality, "Inner zone depth",  timings[1].depth, 1uz);
+            check("Inner zone nested within outer", timings[1].start + timings[1].duration <= timings[0].start + timings[0].duration);
+        }
+    }
+}
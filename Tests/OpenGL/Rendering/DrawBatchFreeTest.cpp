@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "DrawBatchFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Rendering/DrawBatch.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace avocet::testing
+{
+    namespace
+    {
+        using vertex_type = sequoia::mem_ordered_tuple<GLfloat, GLfloat>;
+        using batch_type  = opengl::draw_batch<vertex_type>;
+
+        const std::array<vertex_type, 4> quad_vertices{vertex_type{-0.5f, -0.5f}, vertex_type{0.5f, -0.5f}, vertex_type{0.5f, 0.5f}, vertex_type{-0.5f, 0.5f}};
+        constexpr std::array<GLuint, 6> quad_indices{0, 1, 2, 0, 2, 3};
+
+        [[nodiscard]]
+        std::vector<opengl::draw_elements_indirect_command> to_commands(std::span<const std::byte> bytes, std::size_t count)
+        {
+            std::vector<opengl::draw_elements_indirect_command> commands(count);
+            std::memcpy(commands.data(), bytes.data(), count * sizeof(opengl::draw_elements_indirect_command));
+            return commands;
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path draw_batch_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void draw_batch_free_test::run_tests()
+    {
+        test_multi_draw();
+        test_incremental_upload();
+        test_misuse();
+        test_bind_to_edit();
+    }
+
+    void draw_batch_free_test::test_multi_draw()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        batch_type batch{ctx, {.page_size{1024}, .min_block_size{64}, .label{}}};
+        const auto a{batch.add(quad_vertices, quad_indices)};
+        const auto b{batch.add(quad_vertices, quad_indices, 3)};
+        const auto c{batch.add(quad_vertices, std::span{quad_indices}.first(3))};
+        check(equality, "Draws", batch.num_draws(), 3uz);
+        check(equality, "Draw id follows the vertex attributes", batch_type::draw_id_location, 2u);
+
+        check("First command", batch.command(a) == draw_elements_indirect_command{.count{6}, .instance_count{1}, .first_index{0},  .base_vertex{0},  .base_instance{0}});
+        check("Second command", batch.command(b) == draw_elements_indirect_command{.count{6}, .instance_count{3}, .first_index{16}, .base_vertex{8},  .base_instance{1}});
+        check("Third command", batch.command(c) == draw_elements_indirect_command{.count{3}, .instance_count{1}, .first_index{32}, .base_vertex{16}, .base_instance{2}});
+
+        driver.reset_call_counts();
+        batch.draw();
+        check(equality, "One multi-draw", driver.num_calls<&GladGLContext::MultiDrawElementsIndirect>(), 1uz);
+        check(equality, "One vertex array bound", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+        check("Statistics", batch.statistics() == draw_batch_statistics{.draws{3}, .multi_draws{1}, .commands_uploaded{3}});
+
+        const auto indirectBuffer{static_cast<GLuint>(driver.integer(GL_DRAW_INDIRECT_BUFFER_BINDING))};
+        check("Indirect buffer bound", indirectBuffer != 0);
+        check("Commands uploaded", to_commands(driver.buffer_storage(indirectBuffer), 3) == std::vector{batch.command(a), batch.command(b), batch.command(c)});
+
+        // 1024 bytes of vertices fill a page of their own, and so require a second multi-draw
+        const std::vector<vertex_type> large(128, vertex_type{0.0f, 0.0f});
+        const auto d{batch.add(large, quad_indices)};
+        check("Base vertex in fresh page", batch.command(d).base_vertex == 0);
+
+        driver.reset_call_counts();
+        batch.draw();
+        check(equality, "Two multi-draws", driver.num_calls<&GladGLContext::MultiDrawElementsIndirect>(), 2uz);
+        check("Statistics with two pages", batch.statistics() == draw_batch_statistics{.draws{4}, .multi_draws{2}, .commands_uploaded{1}});
+    }
+
+    void draw_batch_free_test::test_incremental_upload()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        batch_type batch{ctx, {.page_size{4096}, .min_block_size{64}, .label{}}};
+        std::vector<std::size_t> ids{};
+        for(std::size_t i{}; i < 20; ++i)
+            ids.push_back(batch.add(quad_vertices, quad_indices));
+
+        driver.reset_call_counts();
+        batch.draw();
+        check(equality, "All uploaded, beyond the initial capacity", batch.statistics().commands_uploaded, 20uz);
+        check(equality, "Vertex array remade for more draw ids", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+        check(equality, "Draw id held across instances", driver.num_calls<&GladGLContext::VertexArrayBindingDivisor>(), 1uz);
+
+        driver.reset_call_counts();
+        batch.draw();
+        check(equality, "Nothing uploaded", batch.statistics().commands_uploaded, 0uz);
+        check(equality, "No buffer updates", driver.num_calls<&GladGLContext::NamedBufferSubData>(), 0uz);
+
+        batch.set_instance_count(ids[5], 4);
+        batch.draw();
+        check(equality, "Instance count uploaded", batch.statistics().commands_uploaded, 1uz);
+        check(equality, "Updated instance count", batch.command(ids[5]).instance_count, 4u);
+
+        batch.update_vertices(ids[6], std::span{quad_vertices}.first(2), 2);
+        batch.draw();
+        check(equality, "Vertices updated without commands", batch.statistics().commands_uploaded, 0uz);
+
+        const auto moved{batch.command(ids[19])};
+        batch.remove(ids[2]);
+        batch.draw();
+        check(equality, "Last command moved into place", batch.statistics().commands_uploaded, 1uz);
+        check(equality, "One fewer draw", batch.statistics().draws, 19uz);
+        check("Moved command unchanged", batch.command(ids[19]) == moved);
+
+        batch.remove(ids[18]);
+        batch.draw();
+        check(equality, "Removing the last command uploads nothing", batch.statistics().commands_uploaded, 0uz);
+
+        const auto reused{batch.add(quad_vertices, quad_indices)};
+        check(equality, "Identifier reused", reused, ids[18]);
+        check(equality, "Base instance is the identifier", batch.command(reused).base_instance, static_cast<GLuint>(reused));
+        check(equality, "Draws after reuse", batch.num_draws(), 19uz);
+    }
+
+    void draw_batch_free_test::test_misuse()
+    {
+        using namespace opengl;
+
+        {
+            null_driver driver{};
+            const auto ctx{curlew::make_null_driver_context(driver)};
+
+            batch_type batch{ctx, {.page_size{1024}, .min_block_size{64}, .label{}}};
+            check_exception_thrown<std::runtime_error>("No vertices", [&batch]() { return batch.add({}, quad_indices); });
+            check_exception_thrown<std::runtime_error>("No indices", [&batch]() { return batch.add(quad_vertices, {}); });
+            check_exception_thrown<std::runtime_error>("Unknown draw", [&batch]() { batch.remove(0); });
+
+            const auto id{batch.add(quad_vertices, quad_indices)};
+            check_exception_thrown<std::runtime_error>("Too many vertices", [&batch, id]() { batch.update_vertices(id, quad_vertices, 1); });
+
+            batch.remove(id);
+            check_exception_thrown<std::runtime_error>("Removed twice", [&batch, id]() { batch.remove(id); });
+            check_exception_thrown<std::runtime_error>("Removed draw", [&batch, id]() { return batch.command(id); });
+        }
+
+        {
+            null_driver driver{opengl_version{4, 2}};
+            const auto ctx{curlew::make_null_driver_context(driver)};
+
+            check_exception_thrown<std::runtime_error>("Multi-draw indirect unsupported", [&ctx]() { batch_type{ctx, {.page_size{1024}, .min_block_size{64}, .label{}}}; });
+        }
+    }
+
+    void draw_batch_free_test::test_bind_to_edit()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 3}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        batch_type batch{ctx, {.page_size{1024}, .min_block_size{64}, .label{}}};
+        const auto a{batch.add(quad_vertices, quad_indices)};
+        const auto b{batch.add(quad_vertices, quad_indices)};
+
+        driver.reset_call_counts();
+        batch.draw();
+        check(equality, "Multi-draw", driver.num_calls<&GladGLContext::MultiDrawElementsIndirect>(), 1uz);
+        check(equality, "Commands edited through the copy target", driver.num_calls<&GladGLContext::BufferSubData>(), 1uz);
+        check("Indirect buffer bound for drawing", driver.integer(GL_DRAW_INDIRECT_BUFFER_BINDING) != 0);
+
+        const auto indirectBuffer{static_cast<GLuint>(driver.integer(GL_DRAW_INDIRECT_BUFFER_BINDING))};
+        check("Commands uploaded", to_commands(driver.buffer_storage(indirectBuffer), 2) == std::vector{batch.command(a), batch.command(b)});
+    }
+}
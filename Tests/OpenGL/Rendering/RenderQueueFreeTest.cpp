@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "RenderQueueFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/Rendering/RenderQueue.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using quad_type = agl::quad<GLfloat, agl::dimensionality{2}>;
+
+        [[nodiscard]]
+        quad_type make_quad(const agl::capable_context& ctx) {
+            return quad_type{ctx, [](auto vertices) { return vertices; }, std::nullopt};
+        }
+
+        template<class... Caps>
+        [[nodiscard]]
+        agl::capable_context::state_block make_state_block(const agl::capable_context& ctx, const Caps&... caps) {
+            agl::capable_context::payload_type payload{};
+            ((std::get<std::optional<Caps>>(payload) = caps), ...);
+            return ctx.make_state_block(payload);
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path render_queue_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void render_queue_free_test::run_tests()
+    {
+        test_radix_sort();
+        test_sorting();
+        test_layers();
+    }
+
+    void render_queue_free_test::test_radix_sort()
+    {
+        using namespace opengl;
+
+        std::vector<sort_entry> entries{{0x0100'0000'0000'0000, 0}, {3, 1}, {0x0100'0000'0000'0000, 2}, {0, 3}, {3, 4}, {0xff, 5}}, buffer{};
+        radix_sort(entries, buffer);
+
+        check("Sorted", std::ranges::is_sorted(entries, {}, &sort_entry::key));
+        check(equality, "Order of equal keys preserved", entries | std::views::transform(&sort_entry::index) | std::ranges::to<std::vector>(), std::vector<std::uint32_t>{3, 1, 4, 5, 0, 2});
+
+        std::vector<sort_entry> empty{};
+        radix_sort(empty, buffer);
+        check("Empty", empty.empty());
+    }
+
+    void render_queue_free_test::test_sorting()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const shader_program prog0{ctx, working_materials() / "Identity.vs", working_materials() / "Monochrome.fs"},
+                             prog1{ctx, working_materials() / "Identity.vs", working_materials() / "Monochrome.fs"};
+
+        const auto none{make_state_block(ctx)};
+        const auto depth{make_state_block(ctx, capabilities::gl_depth_test{})};
+        const auto q{make_quad(ctx)};
+
+        render_queue queue{ctx};
+        for(std::size_t i{}; i < 16; ++i) {
+            queue.submit((i % 2) ? prog1 : prog0, (i % 4) < 2 ? none : depth, q);
+        }
+
+        check(equality, "Queued draws", queue.size(), 16uz);
+
+        driver.reset_call_counts();
+        const auto stats{queue.flush()};
+        check(equality, "Draws", stats.draws, 16uz);
+        check(equality, "Program changes", stats.program_changes, 2uz);
+        check(equality, "State changes", stats.state_changes, 4uz);
+        check(equality, "Texture changes", stats.texture_changes, 0uz);
+        check(equality, "Programs used", driver.num_calls<&GladGLContext::UseProgram>(), 2uz);
+        check(equality, "Depth test toggled", driver.num_calls<&GladGLContext::Enable>() + driver.num_calls<&GladGLContext::Disable>(), 3uz);
+        check(equality, "Every draw issued", driver.num_calls<&GladGLContext::DrawElements>(), 16uz);
+        check(equality, "Queue emptied", queue.size(), 0uz);
+
+        queue.submit(prog0, make_state_block(ctx), q);
+        queue.submit(prog0, make_state_block(ctx), q);
+        check(equality, "Blocks sharing a key", queue.flush().state_changes, 1uz);
+
+        check_exception_thrown<std::runtime_error>("Layer index too large", [&]() { queue.submit(prog0, none, q, draw_options{.layer{.index{16}}}); });
+    }
+
+    void render_queue_free_test::test_layers()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const shader_program prog0{ctx, working_materials() / "Identity.vs", working_materials() / "Monochrome.fs"},
+                             prog1{ctx, working_materials() / "Identity.vs", working_materials() / "Monochrome.fs"};
+
+        const auto none{make_state_block(ctx)};
+        const auto q{make_quad(ctx)};
+
+        std::vector<int> order{};
+        auto recorder{[&order](int i) { return [&order, i]() { order.push_back(i); }; }};
+
+        constexpr render_layer opaque{.index{0}, .ordering{layer_ordering::by_state}},
+                               stencilled{.index{1}, .ordering{layer_ordering::as_submitted}},
+                               transparent{.index{2}, .ordering{layer_ordering::back_to_front}};
+
+        render_queue queue{ctx};
+        queue.submit(prog0, none, q, {.layer{transparent}, .depth{0.2f}, .prepare{recorder(0)}});
+        queue.submit(prog1, none, q, {.layer{stencilled},  .depth{},     .prepare{recorder(1)}});
+        queue.submit(prog0, none, q, {.layer{stencilled},  .depth{},     .prepare{recorder(2)}});
+        queue.submit(prog1, none, q, {.layer{transparent}, .depth{0.8f}, .prepare{recorder(3)}});
+        queue.submit(prog1, none, q, {.layer{opaque},      .depth{0.9f}, .prepare{recorder(4)}});
+        queue.submit(prog0, none, q, {.layer{opaque},      .depth{0.5f}, .prepare{recorder(5)}});
+        queue.submit(prog1, none, q, {.layer{opaque},      .depth{0.1f}, .prepare{recorder(6)}});
+        queue.submit(prog0, none, q, {.layer{transparent}, .depth{0.5f}, .prepare{recorder(7)}});
+
+        queue.flush();
+
+        // Program 0 is interned first, and so precedes program 1 within the opaque layer
+        check(equality, "Draw order", order, std::vector{5, 6, 4, 1, 2, 3, 7, 0});
+    }
+}
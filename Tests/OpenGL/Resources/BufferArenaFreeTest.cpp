@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "BufferArenaFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Resources/BufferArena.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <optional>
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path buffer_arena_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void buffer_arena_free_test::run_tests()
+    {
+        test_suballocation();
+        test_defragmentation();
+        test_bind_to_edit({4, 1});
+        test_bind_to_edit({4, 4});
+        test_misuse();
+    }
+
+    void buffer_arena_free_test::test_suballocation()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        vertex_arena arena{ctx, {.page_size{1024}, .min_block_size{64}, .label{}}};
+        check(equality, "Pages created lazily", driver.num_calls<&GladGLContext::CreateBuffers>(), 0uz);
+
+        const auto a{arena.allocate<GLfloat>(6)};
+        const auto b{arena.allocate<GLfloat>(3)};
+        const auto c{arena.allocate(10, 12)};
+        check(equality, "One buffer for many allocations", driver.num_calls<&GladGLContext::CreateBuffers>(), 1uz);
+        check("First location", arena.locate(a) == arena_location{.page{0}, .offset{0}, .size{24}});
+        check("Second location", arena.locate(b) == arena_location{.page{0}, .offset{64}, .size{12}});
+        check("Padded for alignment", arena.locate(c) == arena_location{.page{0}, .offset{132}, .size{10}});
+
+        arena.write<GLfloat>(b, std::array<GLfloat, 3>{1.0f, 2.0f, 3.0f});
+        arena.write<GLfloat>(b, std::array<GLfloat, 1>{-2.0f}, 1);
+        std::vector<GLfloat> data(3);
+        arena.read<GLfloat>(b, data);
+        check(equality, "Round trip", data, std::vector<GLfloat>{1.0f, -2.0f, 3.0f});
+
+        const auto stats{arena.statistics()};
+        check(equality, "Pages", stats.pages, 1uz);
+        check(equality, "Allocations", stats.allocations, 3uz);
+        check(equality, "Capacity", stats.capacity, 1024uz);
+        check(equality, "Reserved", stats.reserved, 192uz);
+        check(equality, "Requested", stats.requested, 46uz);
+        check(equality, "Largest free block", stats.largest_free_block, 512uz);
+
+        {
+            const auto d{arena.allocate(1024)};
+            check("New page when full", arena.locate(d) == arena_location{.page{1}, .offset{0}, .size{1024}});
+            check(equality, "Second buffer", driver.num_calls<&GladGLContext::CreateBuffers>(), 2uz);
+        }
+
+        check(equality, "Freed on destruction", arena.statistics().allocations, 3uz);
+        check(equality, "Pages retained until defragmentation", arena.num_pages(), 2uz);
+
+        check_exception_thrown<std::runtime_error>("Write overrunning the allocation", [&]() { arena.write<GLfloat>(b, std::array<GLfloat, 4>{}); });
+        check_exception_thrown<std::runtime_error>("Read beyond the allocation", [&]() { arena.read<GLfloat>(b, std::span<GLfloat>{}, 4); });
+    }
+
+    void buffer_arena_free_test::test_defragmentation()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        element_arena arena{ctx, {.page_size{256}, .min_block_size{16}, .label{}}};
+        std::optional a{arena.allocate<GLuint>(4)}, b{arena.allocate<GLuint>(4)};
+        const auto c{arena.allocate<GLuint>(8)};
+        std::optional d{arena.allocate(256)};
+
+        const std::vector<GLuint> indices{0, 1, 2, 2, 3, 0, 4, 5};
+        arena.write<GLuint>(c, indices);
+        a.reset();
+        b.reset();
+        d.reset();
+
+        driver.reset_call_counts();
+        check(equality, "Allocations moved", arena.defragment(), 1uz);
+        check(equality, "Generation", arena.generation(), 1uz);
+        check("Packed", arena.locate(c) == arena_location{.page{0}, .offset{0}, .size{32}});
+        check(equality, "Empty trailing page released", arena.num_pages(), 1uz);
+        check(equality, "Copied on the GPU", driver.num_calls<&GladGLContext::CopyNamedBufferSubData>(), 1uz);
+        check(equality, "Fresh storage", driver.num_calls<&GladGLContext::CreateBuffers>(), 1uz);
+
+        std::vector<GLuint> data(8);
+        arena.read<GLuint>(c, data);
+        check(equality, "Data preserved", data, indices);
+
+        check(equality, "Nothing to move", arena.defragment(), 0uz);
+        check(equality, "Generation unchanged", arena.generation(), 1uz);
+    }
+
+    void buffer_arena_free_test::test_bind_to_edit(opengl::opengl_version version)
+    {
+        using namespace opengl;
+
+        null_driver driver{version};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        vertex_arena arena{ctx, {.page_size{64}, .min_block_size{16}, .label{}}};
+        std::optional a{arena.allocate<GLfloat>(4)};
+        const auto b{arena.allocate<GLfloat>(4)};
+        arena.write<GLfloat>(b, std::array<GLfloat, 4>{1.0f, 2.0f, 3.0f, 4.0f});
+        a.reset();
+
+        driver.reset_call_counts();
+        check(equality, "Allocations moved", arena.defragment(), 1uz);
+        check(equality, "Copied through the copy targets", driver.num_calls<&GladGLContext::CopyBufferSubData>(), 1uz);
+        check(equality, "Direct state access calls", driver.num_calls<&GladGLContext::CopyNamedBufferSubData>(), 0uz);
+
+        std::vector<GLfloat> data(4);
+        arena.read<GLfloat>(b, data);
+        check(equality, "Data preserved", data, std::vector<GLfloat>{1.0f, 2.0f, 3.0f, 4.0f});
+    }
+
+    void buffer_arena_free_test::test_misuse()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        check_exception_thrown<std::runtime_error>("Page size not a power of two", [&ctx]() { vertex_arena{ctx, {.page_size{1000}, .min_block_size{16}, .label{}}}; });
+
+        vertex_arena arena{ctx, {.page_size{64}, .min_block_size{16}, .label{}}}, other{ctx, {.page_size{64}, .min_block_size{16}, .label{}}};
+        check_exception_thrown<std::runtime_error>("Empty", [&arena]() { return arena.allocate(0); });
+        check_exception_thrown<std::runtime_error>("Larger than a page", [&arena]() { return arena.allocate(65); });
+        check_exception_thrown<std::runtime_error>("Padded beyond a page", [&arena]() { return arena.allocate(64, 48); });
+        check_exception_thrown<std::runtime_error>("Zero alignment", [&arena]() { return arena.allocate(1, 0); });
+
+        const auto a{arena.allocate(8)};
+        check_exception_thrown<std::runtime_error>("Allocation from another arena", [&]() { return other.locate(a); });
+        check_exception_thrown<std::runtime_error>("Page out of range", [&arena]() { return &arena.page(1); });
+    }
+}
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "DirectStateAccessFreeTest.hpp"
+#include "avocet/Core/AssetManagement/Image.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/Resources/Framebuffer.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using textured_quad_type = agl::quad<GLfloat, agl::dimensionality{2}, agl::texture_coordinates<GLfloat>>;
+
+        [[nodiscard]]
+        textured_quad_type make_textured_quad(const agl::capable_context& ctx, const unique_image& image) {
+            return {
+                ctx,
+                [](auto vertices) { return vertices; },
+                agl::texture_2d_configurator{
+                    .common_config{
+                        .decoding{agl::sampling_decoding::none},
+                        .parameter_setter{[](agl::decorated_contextual_resource_view crv) { agl::set_texture_parameter(crv, GL_TEXTURE_MIN_FILTER, GL_NEAREST); }},
+                        .label{}
+                    },
+                    .data_view{image}
+                },
+                std::nullopt
+            };
+        }
+
+        [[nodiscard]]
+        agl::framebuffer_object make_framebuffer(const agl::capable_context& ctx) {
+            return {ctx, agl::fbo_configurator{.label{}}, agl::framebuffer_texture_2d_configurator{.common_config{}, .format{agl::texture_format::red}, .extent{2, 2}}};
+        }
+
+        [[nodiscard]]
+        std::size_t num_binds(const agl::null_driver& driver) {
+            return driver.num_calls<&GladGLContext::BindBuffer>()
+                 + driver.num_calls<&GladGLContext::BindVertexArray>()
+                 + driver.num_calls<&GladGLContext::BindTexture>()
+                 + driver.num_calls<&GladGLContext::ActiveTexture>();
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path direct_state_access_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void direct_state_access_free_test::run_tests()
+    {
+        test_direct_state_access();
+        test_bind_to_edit({4, 1});
+        test_bind_to_edit({4, 4});
+    }
+
+    void direct_state_access_free_test::test_direct_state_access()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 5}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+        check("Direct state access available", ctx.fundamental_characteristics().direct_state_access_available());
+
+        const unique_image image{std::vector<unsigned char>{42}, discrete_extent{1, 1}, colour_channels{1}, alignment{1}};
+
+        driver.reset_call_counts();
+        const auto q{make_textured_quad(ctx, image)};
+        const auto fbo{make_framebuffer(ctx)};
+
+        check(equality, "Binds during construction", num_binds(driver), 0uz);
+        check(equality, "Framebuffer left bound", driver.num_calls<&GladGLContext::BindFramebuffer>(), 1uz);
+        check(equality, "Buffers created", driver.num_calls<&GladGLContext::CreateBuffers>(), 2uz);
+        check(equality, "Vertex arrays created", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+        check(equality, "Textures created", driver.num_calls<&GladGLContext::CreateTextures>(), 2uz);
+        check(equality, "Texture storage allocated", driver.num_calls<&GladGLContext::TextureStorage2D>(), 2uz);
+        check(equality, "Texture data uploaded", driver.num_calls<&GladGLContext::TextureSubImage2D>(), 1uz);
+        check(equality, "Texture parameters set", driver.num_calls<&GladGLContext::TextureParameteri>(), 1uz);
+        check(equality, "Element buffer attached", driver.num_calls<&GladGLContext::VertexArrayElementBuffer>(), 1uz);
+        check(equality, "Attributes enabled on the vertex array", driver.num_calls<&GladGLContext::EnableVertexArrayAttrib>(), 2uz);
+        check(equality, "Attributes not enabled on the bound vertex array", driver.num_calls<&GladGLContext::EnableVertexAttribArray>(), 0uz);
+        check(equality, "Generated names", driver.num_calls<&GladGLContext::GenBuffers>() + driver.num_calls<&GladGLContext::GenTextures>(), 0uz);
+
+        const element_buffer_object<GLubyte> ebo{ctx, std::array<GLubyte, 3>{1, 2, 3}, std::nullopt};
+        driver.reset_call_counts();
+        check(equality, "Buffer read back", ebo.extract_data(), std::vector<GLubyte>{1, 2, 3});
+        check(equality, "Binds during read back", num_binds(driver), 0uz);
+
+        q.draw(texture_unit{1});
+        check(equality, "Binds on drawing", num_binds(driver), 3uz);
+
+        using vertex_type = sequoia::mem_ordered_tuple<GLfloat, GLfloat>;
+        const vertex_buffer_object<vertex_type> vbo{ctx, std::array<vertex_type, 3>{}, std::nullopt};
+        const vertex_attribute_object vao{ctx, std::nullopt, vbo};
+
+        driver.reset_call_counts();
+        vao.attach(ebo);
+        vao.attach(ebo);
+        check(equality, "Repeated attachment elided", driver.num_calls<&GladGLContext::VertexArrayElementBuffer>(), 1uz);
+
+        vao.bind_element_buffer(ebo);
+        check(equality, "Attachment recorded by the bind cache", driver.num_calls<&GladGLContext::BindBuffer>(), 0uz);
+    }
+
+    void direct_state_access_free_test::test_bind_to_edit(opengl::opengl_version version)
+    {
+        using namespace opengl;
+
+        null_driver driver{version};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+        check("Direct state access unavailable", !ctx.fundamental_characteristics().direct_state_access_available());
+
+        const unique_image image{std::vector<unsigned char>{42}, discrete_extent{1, 1}, colour_channels{1}, alignment{1}};
+
+        driver.reset_call_counts();
+        const auto q{make_textured_quad(ctx, image)};
+        const auto fbo{make_framebuffer(ctx)};
+
+        check(equality, "Buffers generated", driver.num_calls<&GladGLContext::GenBuffers>(), 2uz);
+        check(equality, "Vertex arrays generated", driver.num_calls<&GladGLContext::GenVertexArrays>(), 1uz);
+        check(equality, "Textures generated", driver.num_calls<&GladGLContext::GenTextures>(), 2uz);
+        check(equality, "Textures specified", driver.num_calls<&GladGLContext::TexImage2D>(), 2uz);
+        check(equality, "Texture parameters set", driver.num_calls<&GladGLContext::TexParameteri>(), 1uz);
+        check(equality, "Framebuffer bound", driver.num_calls<&GladGLContext::BindFramebuffer>(), 1uz);
+        check(equality, "Direct state access calls", driver.num_calls<&GladGLContext::CreateBuffers>() + driver.num_calls<&GladGLContext::VertexArrayElementBuffer>(), 0uz);
+
+        const element_buffer_object<GLubyte> ebo{ctx, std::array<GLubyte, 3>{1, 2, 3}, std::nullopt};
+        check(equality, "Buffer read back", ebo.extract_data(), std::vector<GLubyte>{1, 2, 3});
+    }
+}
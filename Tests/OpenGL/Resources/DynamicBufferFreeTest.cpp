@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "DynamicBufferFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using vertex_type = sequoia::mem_ordered_tuple<GLfloat, GLfloat>;
+        using quad_type   = agl::quad<GLfloat, agl::dimensionality{2}>;
+
+        template<class Buffer>
+        concept orphanable = requires(const Buffer& b) { b.orphan(); };
+
+        static_assert(!orphanable<agl::vertex_buffer_object<GLfloat>>);
+        static_assert(orphanable<agl::dynamic_vertex_buffer_object<GLfloat>>);
+        static_assert(orphanable<agl::stream_element_buffer_object<GLuint>>);
+    }
+
+    [[nodiscard]]
+    std::filesystem::path dynamic_buffer_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void dynamic_buffer_free_test::run_tests()
+    {
+        test_partial_updates();
+        test_replacement();
+        test_bind_to_edit();
+    }
+
+    void dynamic_buffer_free_test::test_partial_updates()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const std::array<vertex_type, 3> vertices{vertex_type{0.0f, 1.0f}, vertex_type{2.0f, 3.0f}, vertex_type{4.0f, 5.0f}};
+        const dynamic_vertex_buffer_object<vertex_type> vbo{ctx, vertices, std::nullopt};
+        check(equality, "Size", vbo.size(), 3uz);
+        check(equality, "Capacity", vbo.capacity(), 3uz);
+
+        driver.reset_call_counts();
+        const std::array<vertex_type, 1> vertex{vertex_type{-2.0f, -3.0f}};
+        vbo.update(1, vertex);
+        check(equality, "Partial uploads", driver.num_calls<&GladGLContext::NamedBufferSubData>(), 1uz);
+        check(equality, "Storage respecified", driver.num_calls<&GladGLContext::NamedBufferData>(), 0uz);
+
+        const auto data{vbo.extract_data()};
+        if(check(equality, "Size after update", data.size(), 3uz)) {
+            check(equality, "Updated vertex", sequoia::get<0>(data[1]), -2.0f);
+            check(equality, "Updated vertex", sequoia::get<1>(data[1]), -3.0f);
+            check(equality, "Neighbouring vertex", sequoia::get<1>(data[2]), 5.0f);
+        }
+
+        check_exception_thrown<std::runtime_error>("Update overrunning the end", [&vbo]() { vbo.update(2, std::array<vertex_type, 2>{}); });
+        check_exception_thrown<std::runtime_error>("Update beyond the end", [&vbo]() { vbo.update(4, std::span<const vertex_type>{}); });
+    }
+
+    void dynamic_buffer_free_test::test_replacement()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        dynamic_element_buffer_object<GLubyte> ebo{ctx, std::array<GLubyte, 3>{1, 2, 3}, std::nullopt};
+
+        driver.reset_call_counts();
+        ebo.replace(std::array<GLubyte, 2>{4, 5});
+        check(equality, "Shrunk", ebo.extract_data(), std::vector<GLubyte>{4, 5});
+        check(equality, "Capacity retained", ebo.capacity(), 3uz);
+
+        ebo.replace(std::array<GLubyte, 4>{1, 2, 3, 4});
+        check(equality, "Grown", ebo.extract_data(), std::vector<GLubyte>{1, 2, 3, 4});
+        check(equality, "Capacity doubled", ebo.capacity(), 6uz);
+
+        ebo.replace(std::array<GLubyte, 13>{});
+        check(equality, "Capacity grown to fit", ebo.capacity(), 13uz);
+        check(equality, "Storage respecified", driver.num_calls<&GladGLContext::NamedBufferData>(), 3uz);
+
+        ebo.orphan();
+        check(equality, "Orphaned", driver.num_calls<&GladGLContext::NamedBufferData>(), 4uz);
+        check(equality, "Size unchanged by orphaning", ebo.size(), 13uz);
+        check(equality, "No new buffers", driver.num_calls<&GladGLContext::CreateBuffers>() + driver.num_calls<&GladGLContext::GenBuffers>(), 0uz);
+    }
+
+    void dynamic_buffer_free_test::test_bind_to_edit()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 4}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        stream_element_buffer_object<GLuint> ebo{ctx, std::array<GLuint, 3>{0, 1, 2}, std::nullopt};
+        const quad_type q{ctx, [](auto vertices) { return vertices; }, std::nullopt};
+        const auto elementBinding{driver.integer(GL_ELEMENT_ARRAY_BUFFER_BINDING)};
+
+        driver.reset_call_counts();
+        ebo.update(0, std::array<GLuint, 2>{2, 1});
+        ebo.replace(std::array<GLuint, 4>{3, 2, 1, 0});
+        check(equality, "Element array binding untouched", driver.integer(GL_ELEMENT_ARRAY_BUFFER_BINDING), elementBinding);
+        check(equality, "Bound once for editing", driver.num_calls<&GladGLContext::BindBuffer>(), 1uz);
+        check(equality, "Partial uploads", driver.num_calls<&GladGLContext::BufferSubData>(), 2uz);
+        check(equality, "Storage respecified", driver.num_calls<&GladGLContext::BufferData>(), 1uz);
+        check(equality, "Direct state access calls", driver.num_calls<&GladGLContext::NamedBufferSubData>() + driver.num_calls<&GladGLContext::NamedBufferData>(), 0uz);
+
+        check(equality, "Contents", ebo.extract_data(), std::vector<GLuint>{3, 2, 1, 0});
+    }
+}
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "MappedReadbackFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Resources/Buffers.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <algorithm>
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path mapped_readback_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void mapped_readback_free_test::run_tests()
+    {
+        test_mapped_views();
+        test_copy_into_span();
+        test_bind_to_read({4, 1});
+        test_bind_to_read({4, 4});
+    }
+
+    void mapped_readback_free_test::test_mapped_views()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const vertex_buffer_object<GLfloat> vbo{ctx, std::array<GLfloat, 8>{0, 1, 2, 3, 4, 5, 6, 7}, std::nullopt};
+
+        driver.reset_call_counts();
+        {
+            const auto view{vbo.map_read({.offset{2}, .count{3}})};
+            check(equality, "Mapped range", std::vector<GLfloat>(view.begin(), view.end()), std::vector<GLfloat>{2, 3, 4});
+            check(equality, "Mapped", driver.num_calls<&GladGLContext::MapNamedBufferRange>(), 1uz);
+            check(equality, "Not yet unmapped", driver.num_calls<&GladGLContext::UnmapNamedBuffer>(), 0uz);
+        }
+
+        check(equality, "Unmapped", driver.num_calls<&GladGLContext::UnmapNamedBuffer>(), 1uz);
+        check(equality, "Nothing copied", driver.num_calls<&GladGLContext::GetNamedBufferSubData>(), 0uz);
+
+        {
+            auto whole{vbo.map_read()};
+            check(equality, "Whole buffer", whole.size(), 8uz);
+            check(equality, "Last element", whole[7], 7.0f);
+            check("Explicitly unmapped", whole.unmap());
+            check("Empty once unmapped", whole.empty());
+        }
+
+        check(equality, "Unmapped once", driver.num_calls<&GladGLContext::UnmapNamedBuffer>(), 2uz);
+
+        {
+            const auto empty{vbo.map_read({.offset{8}, .count{0}})};
+            check("Empty range", empty.empty());
+        }
+
+        check(equality, "Empty ranges not mapped", driver.num_calls<&GladGLContext::MapNamedBufferRange>(), 2uz);
+        check_exception_thrown<std::runtime_error>("Range overrunning the end", [&vbo]() { return vbo.map_read({.offset{6}, .count{3}}); });
+    }
+
+    void mapped_readback_free_test::test_copy_into_span()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const element_buffer_object<GLuint> ebo{ctx, std::array<GLuint, 6>{5, 4, 3, 2, 1, 0}, std::nullopt};
+
+        std::array<GLuint, 4> destination{};
+        ebo.extract_data(destination, 2);
+        check(equality, "Copied", destination, std::array<GLuint, 4>{3, 2, 1, 0});
+
+        check_exception_thrown<std::runtime_error>("Copy overrunning the end", [&ebo, &destination]() { ebo.extract_data(destination, 3); });
+    }
+
+    void mapped_readback_free_test::test_bind_to_read(opengl::opengl_version version)
+    {
+        using namespace opengl;
+
+        null_driver driver{version};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const element_buffer_object<GLubyte> ebo{ctx, std::array<GLubyte, 4>{1, 2, 3, 4}, std::nullopt};
+        const vertex_buffer_object<GLubyte>  vbo{ctx, std::array<GLubyte, 2>{9, 8}, std::nullopt};
+        const auto elementBinding{driver.integer(GL_ELEMENT_ARRAY_BUFFER_BINDING)};
+
+        driver.reset_call_counts();
+        {
+            auto view{ebo.map_read({.offset{1}, .count{2}})};
+            check(equality, "Mapped range", std::vector<GLubyte>(view.begin(), view.end()), std::vector<GLubyte>{2, 3});
+
+            const auto moved{std::move(view)};
+            check("Moved from", view.empty());
+
+            std::array<GLubyte, 2> destination{};
+            vbo.extract_data(destination);
+            check(equality, "Copied", destination, std::array<GLubyte, 2>{9, 8});
+        }
+
+        check(equality, "Mapped", driver.num_calls<&GladGLContext::MapBufferRange>(), 1uz);
+        check(equality, "Unmapped once", driver.num_calls<&GladGLContext::UnmapBuffer>(), 1uz);
+        check(equality, "Element array binding untouched", driver.integer(GL_ELEMENT_ARRAY_BUFFER_BINDING), elementBinding);
+        check(equality, "Direct state access calls", driver.num_calls<&GladGLContext::MapNamedBufferRange>() + driver.num_calls<&GladGLContext::GetNamedBufferSubData>(), 0uz);
+    }
+}
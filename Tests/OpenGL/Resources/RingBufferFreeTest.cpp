@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "RingBufferFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Resources/RingBuffer.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <algorithm>
+#include <format>
+
+namespace avocet::testing
+{
+    [[nodiscard]]
+    std::filesystem::path ring_buffer_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void ring_buffer_free_test::run_tests()
+    {
+        test_fence_sync();
+        test_streaming();
+        test_alignment_within_unaligned_capacity();
+        test_misuse();
+        test_bind_to_edit();
+    }
+
+    void ring_buffer_free_test::test_fence_sync()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        {
+            fence_sync fence{ctx};
+            check("Signaled", fence.signaled());
+
+            const fence_sync moved{std::move(fence)};
+            check("Moved from", fence.is_null());
+            check("Moved to", !moved.is_null());
+            check("Waited", moved.wait(std::chrono::nanoseconds{0}));
+        }
+
+        check(equality, "Fences inserted", driver.num_calls<&GladGLContext::FenceSync>(), 1uz);
+        check(equality, "Fences deleted", driver.num_calls<&GladGLContext::DeleteSync>(), 1uz);
+    }
+
+    void ring_buffer_free_test::test_streaming()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        ring_buffer<GLfloat> ring{ctx, {.capacity{8}, .label{}}};
+        check(equality, "Capacity", ring.capacity(), 8uz);
+        check(equality, "Immutable storage", driver.num_calls<&GladGLContext::NamedBufferStorage>(), 1uz);
+        check(equality, "Mapped once", driver.num_calls<&GladGLContext::MapNamedBufferRange>(), 1uz);
+
+        GLfloat* front{};
+        {
+            const auto a{ring.allocate(3)};
+            check(equality, "First offset", a.offset(), 0uz);
+            std::ranges::fill(a.data(), 1.0f);
+            front = a.data().data();
+        }
+        ring.fence();
+
+        {
+            const auto b{ring.allocate(3)};
+            check(equality, "Second offset", b.offset(), 3uz);
+        }
+        ring.fence();
+        ring.fence();
+        check(equality, "Fences inserted", driver.num_calls<&GladGLContext::FenceSync>(), 2uz);
+        check(equality, "No waits before wrapping", driver.num_calls<&GladGLContext::ClientWaitSync>(), 0uz);
+
+        {
+            const auto c{ring.allocate(3)};
+            check(equality, "Wrapped", c.offset(), 0uz);
+            check("Same storage", c.data().data() == front);
+            check(equality, "Waited for first fence", driver.num_calls<&GladGLContext::ClientWaitSync>(), 1uz);
+
+            const auto d{ring.allocate(2, 4)};
+            check(equality, "Aligned", d.offset(), 4uz);
+            check(equality, "Waited for second fence", driver.num_calls<&GladGLContext::ClientWaitSync>(), 2uz);
+
+            ring.bind_range(indexed_buffer_target::uniform, 1, d);
+            check(equality, "Range bound", driver.num_calls<&GladGLContext::BindBufferRange>(), 1uz);
+        }
+
+        check(equality, "No remapping", driver.num_calls<&GladGLContext::MapNamedBufferRange>() + driver.num_calls<&GladGLContext::UnmapNamedBuffer>(), 1uz);
+        check(equality, "No respecification", driver.num_calls<&GladGLContext::NamedBufferData>() + driver.num_calls<&GladGLContext::NamedBufferStorage>(), 1uz);
+    }
+
+    void ring_buffer_free_test::test_alignment_within_unaligned_capacity()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        ring_buffer<GLfloat> ring{ctx, {.capacity{10}, .label{}}};
+        {
+            const auto a{ring.allocate(10)};
+        }
+        ring.fence();
+
+        {
+            const auto b{ring.allocate(2, 4)};
+            check(equality, "Aligned at the start of the second lap", b.offset(), 0uz);
+
+            const auto c{ring.allocate(3, 4)};
+            check(equality, "Aligned within the storage", c.offset(), 4uz);
+        }
+        ring.fence();
+
+        const auto d{ring.allocate(3, 4)};
+        check(equality, "Wrapped rather than overrunning the storage", d.offset(), 0uz);
+    }
+
+    void ring_buffer_free_test::test_misuse()
+    {
+        using namespace opengl;
+
+        {
+            null_driver driver{};
+            const auto ctx{curlew::make_null_driver_context(driver)};
+
+            ring_buffer<GLuint> ring{ctx, {.capacity{4}, .label{}}};
+            check_exception_thrown<std::runtime_error>("Too large", [&ring]() { return ring.allocate(5); });
+            check_exception_thrown<std::runtime_error>("Empty", [&ring]() { return ring.allocate(0); });
+
+            {
+                const auto a{ring.allocate(3)};
+                check_exception_thrown<std::runtime_error>("Fenced while writing", [&ring]() { ring.fence(); });
+            }
+
+            check_exception_thrown<std::runtime_error>("Overwriting unfenced data", [&ring]() { return ring.allocate(3); });
+            check_exception_thrown<std::runtime_error>("Zero capacity", [&ctx]() { ring_buffer<GLuint>{ctx, {.capacity{}, .label{}}}; });
+        }
+
+        for(const auto version : {opengl_version{4, 1}, opengl_version{4, 3}}) {
+            null_driver driver{version};
+            const auto ctx{curlew::make_null_driver_context(driver)};
+
+            check_exception_thrown<std::runtime_error>(std::format("Buffer storage unsupported by {}", version), [&ctx]() { ring_buffer<GLuint>{ctx, {.capacity{4}, .label{}}}; });
+            check(equality, std::format("Buffer released by {}", version), driver.num_calls<&GladGLContext::DeleteBuffers>(), 1uz);
+            check(equality, std::format("Array buffer binding untouched by {}", version), driver.integer(GL_ARRAY_BUFFER_BINDING), 0);
+        }
+    }
+
+    void ring_buffer_free_test::test_bind_to_edit()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 4}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        driver.reset_call_counts();
+        ring_buffer<GLubyte> ring{ctx, {.capacity{4}, .label{}}};
+        check(equality, "Immutable storage", driver.num_calls<&GladGLContext::BufferStorage>(), 1uz);
+        check(equality, "Mapped", driver.num_calls<&GladGLContext::MapBufferRange>(), 1uz);
+        check(equality, "Bound once", driver.num_calls<&GladGLContext::BindBuffer>(), 1uz);
+        check(equality, "Array buffer binding untouched", driver.integer(GL_ARRAY_BUFFER_BINDING), 0);
+
+        {
+            const auto a{ring.allocate(4)};
+            std::ranges::fill(a.data(), GLubyte{7});
+        }
+
+        check("Written through the mapping", std::ranges::equal(driver.buffer_storage(static_cast<GLuint>(driver.integer(GL_COPY_WRITE_BUFFER_BINDING))), std::vector<std::byte>(4, std::byte{7})));
+    }
+}
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "SeparateVertexBuffersFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Resources/Buffers.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <array>
+#include <vector>
+
+namespace avocet::testing
+{
+    namespace
+    {
+        namespace agl = avocet::opengl;
+
+        using position_type  = std::array<GLfloat, 3>;
+        using tex_coord_type = std::array<GLfloat, 2>;
+        using vertex_type    = sequoia::mem_ordered_tuple<position_type, tex_coord_type>;
+        using buffers_type   = agl::separate_vertex_buffers<agl::buffer_usage::dynamic_draw, position_type, tex_coord_type>;
+
+        const std::vector<vertex_type> vertices{
+            vertex_type{position_type{-0.5f, -0.5f, 0.0f}, tex_coord_type{0.0f, 0.0f}},
+            vertex_type{position_type{ 0.5f, -0.5f, 0.0f}, tex_coord_type{1.0f, 0.0f}},
+            vertex_type{position_type{ 0.0f,  0.5f, 0.0f}, tex_coord_type{0.5f, 1.0f}}
+        };
+
+        const std::vector<position_type> positions{position_type{-0.5f, -0.5f, 0.0f}, position_type{0.5f, -0.5f, 0.0f}, position_type{0.0f, 0.5f, 0.0f}};
+        const std::vector<tex_coord_type> tex_coords{tex_coord_type{0.0f, 0.0f}, tex_coord_type{1.0f, 0.0f}, tex_coord_type{0.5f, 1.0f}};
+    }
+
+    [[nodiscard]]
+    std::filesystem::path separate_vertex_buffers_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void separate_vertex_buffers_free_test::run_tests()
+    {
+        test_construction();
+        test_update();
+        test_direct_state_access();
+        test_bind_to_edit({4, 1});
+        test_bind_to_edit({4, 3});
+    }
+
+    void separate_vertex_buffers_free_test::test_construction()
+    {
+        using namespace opengl;
+
+        STATIC_CHECK(std::is_same_v<vertex_buffers<attribute_layout::interleaved, buffer_usage::dynamic_draw, position_type, tex_coord_type>, vertex_buffer_object<vertex_type, buffer_usage::dynamic_draw>>);
+        STATIC_CHECK(std::is_same_v<vertex_buffers<attribute_layout::separate, buffer_usage::dynamic_draw, position_type, tex_coord_type>, buffers_type>);
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        {
+            const buffers_type buffers{ctx, vertices, std::nullopt};
+            check(equality, "Vertices", buffers.size(), 3uz);
+            check(equality, "Positions split from the vertices", buffers.stream<0>().extract_data(), positions);
+            check(equality, "Texture coordinates split from the vertices", buffers.stream<1>().extract_data(), tex_coords);
+        }
+
+        {
+            const buffers_type buffers{ctx, positions, tex_coords, std::nullopt};
+            check(equality, "Positions", buffers.stream<0>().extract_data(), positions);
+            check(equality, "Texture coordinates", buffers.stream<1>().extract_data(), tex_coords);
+        }
+
+        check_exception_thrown<std::runtime_error>(
+            "Streams of differing sizes",
+            [&ctx]() { return buffers_type{ctx, positions, std::span{tex_coords}.first(2), std::nullopt}; }
+        );
+    }
+
+    void separate_vertex_buffers_free_test::test_update()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const buffers_type buffers{ctx, vertices, std::nullopt};
+        const std::vector<position_type> moved{position_type{1.0f, 1.0f, 1.0f}, position_type{2.0f, 2.0f, 2.0f}};
+
+        driver.reset_call_counts();
+        buffers.update<0>(1, moved);
+        check(equality, "Only the positions are sent", driver.num_calls<&GladGLContext::NamedBufferSubData>(), 1uz);
+        check(equality, "Positions updated", buffers.stream<0>().extract_data(), std::vector{positions[0], moved[0], moved[1]});
+        check(equality, "Texture coordinates untouched", buffers.stream<1>().extract_data(), tex_coords);
+    }
+
+    void separate_vertex_buffers_free_test::test_direct_state_access()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const buffers_type buffers{ctx, vertices, std::nullopt};
+
+        driver.reset_call_counts();
+        const vertex_attribute_object vao{ctx, std::nullopt, buffers};
+        check(equality, "One binding point per attribute", driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 2uz);
+        check(equality, "Formats", driver.num_calls<&GladGLContext::VertexArrayAttribFormat>(), 2uz);
+        check(equality, "Locations bound", driver.num_calls<&GladGLContext::VertexArrayAttribBinding>(), 2uz);
+    }
+
+    void separate_vertex_buffers_free_test::test_bind_to_edit(opengl::opengl_version version)
+    {
+        using namespace opengl;
+
+        null_driver driver{version};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const buffers_type buffers{ctx, vertices, std::nullopt};
+
+        driver.reset_call_counts();
+        const vertex_attribute_object vao{ctx, std::nullopt, buffers};
+        check(equality, "Pointers", driver.num_calls<&GladGLContext::VertexAttribPointer>(), 2uz);
+        check(equality, "Enabled", driver.num_calls<&GladGLContext::EnableVertexAttribArray>(), 2uz);
+
+        driver.reset_call_counts();
+        buffers.update<0>(0, std::span{positions}.first(1));
+        check(equality, "Positions edited through the copy target", driver.num_calls<&GladGLContext::BufferSubData>(), 1uz);
+    }
+}
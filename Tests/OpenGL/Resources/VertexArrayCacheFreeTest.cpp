@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "VertexArrayCacheFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/Resources/VertexArrayCache.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <array>
+#include <vector>
+
+namespace avocet::testing
+{
+    namespace
+    {
+        namespace agl = avocet::opengl;
+
+        using vertex_type       = sequoia::mem_ordered_tuple<GLfloat, GLfloat>;
+        using other_vertex_type = sequoia::mem_ordered_tuple<GLfloat, GLfloat, GLuint>;
+        using vbo_type          = agl::vertex_buffer_object<vertex_type>;
+        using other_vbo_type    = agl::vertex_buffer_object<other_vertex_type>;
+        using quad_type         = agl::quad<GLfloat, agl::dimensionality{2}>;
+        using triangle_type     = agl::triangle<GLfloat, agl::dimensionality{2}>;
+
+        const std::vector<vertex_type> vertices(3, vertex_type{0.0f, 0.0f});
+        const std::vector<other_vertex_type> other_vertices(3, other_vertex_type{0.0f, 0.0f, 0});
+        constexpr std::array<GLubyte, 3> indices{0, 1, 2};
+
+        constexpr auto identity{[](auto v) { return v; }};
+    }
+
+    [[nodiscard]]
+    std::filesystem::path vertex_array_cache_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void vertex_array_cache_free_test::run_tests()
+    {
+        test_one_vertex_array_per_format();
+        test_buffer_binding_cache();
+        test_polygons();
+        test_bind_to_edit();
+        test_without_vertex_attrib_binding();
+    }
+
+    void vertex_array_cache_free_test::test_one_vertex_array_per_format()
+    {
+        using namespace opengl;
+
+        {
+            null_driver driver{};
+            const auto ctx{curlew::make_null_driver_context(driver)};
+
+            const vbo_type a{ctx, vertices, std::nullopt}, b{ctx, vertices, std::nullopt};
+            const other_vbo_type c{ctx, other_vertices, std::nullopt};
+
+            driver.reset_call_counts();
+            vertex_array_cache cache{ctx, std::nullopt};
+            const auto& vao{cache.bind(a)};
+            check(equality, "Vertex array created for the format", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+            check(equality, "Formats specified once", driver.num_calls<&GladGLContext::VertexArrayAttribFormat>(), 2uz);
+            check(equality, "Integral formats", driver.num_calls<&GladGLContext::VertexArrayAttribIFormat>(), 0uz);
+
+            check("Same vertex array for the same format", &cache.bind(b) == &vao);
+            check(equality, "No further vertex arrays", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 1uz);
+
+            check("Distinct vertex array for a distinct format", &cache.bind(c) != &vao);
+            check(equality, "Second vertex array", driver.num_calls<&GladGLContext::CreateVertexArrays>(), 2uz);
+            check(equality, "Integral format of the second", driver.num_calls<&GladGLContext::VertexArrayAttribIFormat>(), 1uz);
+            check(equality, "Formats", cache.size(), 2uz);
+        }
+
+        {
+            null_driver driver{opengl_version{4, 2}};
+            const auto ctx{curlew::make_null_driver_context(driver)};
+
+            check_exception_thrown<std::runtime_error>("Separate attribute formats unsupported", [&ctx]() { return vertex_array_cache{ctx, std::nullopt}; });
+        }
+    }
+
+    void vertex_array_cache_free_test::test_buffer_binding_cache()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        vertex_array_cache cache{ctx, std::nullopt};
+        const vbo_type a{ctx, vertices, std::nullopt}, b{ctx, vertices, std::nullopt};
+        const element_buffer_object<GLubyte> ebo{ctx, indices, std::nullopt};
+
+        driver.reset_call_counts();
+        cache.bind(a, ebo);
+        cache.bind(a, ebo);
+        check(equality, "Vertex array bound once", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+        check(equality, "Vertex buffer bound once", driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 1uz);
+        check(equality, "Element buffer bound once", driver.num_calls<&GladGLContext::BindBuffer>(), 1uz);
+
+        cache.bind(b, ebo);
+        check(equality, "Switching buffers leaves the vertex array bound", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+        check(equality, "Switching buffers rebinds the vertex buffer", driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 2uz);
+    }
+
+    void vertex_array_cache_free_test::test_polygons()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        vertex_array_cache cache{ctx, std::nullopt};
+        const quad_type first{ctx, identity, std::nullopt}, second{ctx, identity, std::nullopt};
+        const triangle_type third{ctx, identity, std::nullopt};
+
+        driver.reset_call_counts();
+        first.draw(cache);
+        second.draw(cache);
+        third.draw(cache);
+        check(equality, "One vertex array for every polygon", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+        check(equality, "Vertex buffers rebound", driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 3uz);
+        check(equality, "Element buffers rebound", driver.num_calls<&GladGLContext::BindBuffer>(), 2uz);
+        check(equality, "Quads drawn", driver.num_calls<&GladGLContext::DrawElements>(), 2uz);
+        check(equality, "Triangle drawn", driver.num_calls<&GladGLContext::DrawArrays>(), 1uz);
+    }
+
+    void vertex_array_cache_free_test::test_bind_to_edit()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 3}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const vbo_type a{ctx, vertices, std::nullopt}, b{ctx, vertices, std::nullopt};
+
+        driver.reset_call_counts();
+        vertex_array_cache cache{ctx, std::nullopt};
+        cache.bind(a);
+        check(equality, "Formats", driver.num_calls<&GladGLContext::VertexAttribFormat>(), 2uz);
+        check(equality, "Bindings", driver.num_calls<&GladGLContext::VertexAttribBinding>(), 2uz);
+        check(equality, "No pointers", driver.num_calls<&GladGLContext::VertexAttribPointer>(), 0uz);
+        check(equality, "Vertex buffer bound", driver.num_calls<&GladGLContext::BindVertexBuffer>(), 1uz);
+
+        cache.bind(a);
+        cache.bind(b);
+        check(equality, "Vertex buffer rebound only on switching", driver.num_calls<&GladGLContext::BindVertexBuffer>(), 2uz);
+        check(equality, "Vertex array bound once", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+    }
+
+    void vertex_array_cache_free_test::test_without_vertex_attrib_binding()
+    {
+        using namespace opengl;
+
+        null_driver driver{opengl_version{4, 1}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        check_exception_thrown<std::runtime_error>("Separate attribute formats unsupported", [&ctx]() { return vertex_array_cache{ctx, std::nullopt}; });
+
+        driver.reset_call_counts();
+        const quad_type q{ctx, identity, std::nullopt};
+        q.draw();
+        check("Attribute pointers in place of formats", driver.num_calls<&GladGLContext::VertexAttribPointer>() > 0);
+        check(equality, "No formats", driver.num_calls<&GladGLContext::VertexAttribFormat>() + driver.num_calls<&GladGLContext::VertexArrayAttribFormat>(), 0uz);
+        check(equality, "No vertex buffer bindings", driver.num_calls<&GladGLContext::BindVertexBuffer>() + driver.num_calls<&GladGLContext::VertexArrayVertexBuffer>(), 0uz);
+        check(equality, "Drawn", driver.num_calls<&GladGLContext::DrawElements>(), 1uz);
+    }
+}
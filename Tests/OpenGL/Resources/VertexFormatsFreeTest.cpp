@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "VertexFormatsFreeTest.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/Resources/Buffers.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace avocet::testing
+{
+    namespace
+    {
+        namespace agl = avocet::opengl;
+
+        /// A position, texture coordinates, a normal and a material index: 16 bytes, rather than 36 in single precision
+        using vertex_type = sequoia::mem_ordered_tuple<agl::half_float<2>, agl::normalized<GLushort, 2>, agl::packed_snorm_10_10_10_2, GLuint>;
+    }
+
+    [[nodiscard]]
+    std::filesystem::path vertex_formats_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void vertex_formats_free_test::run_tests()
+    {
+        test_half_floats();
+        test_normalized();
+        test_packed();
+        test_direct_state_access();
+        test_bind_to_edit({4, 1});
+        test_bind_to_edit({4, 3});
+    }
+
+    void vertex_formats_free_test::test_half_floats()
+    {
+        using namespace opengl;
+
+        STATIC_CHECK(to_half(0.0f) == 0x0000);
+        STATIC_CHECK(to_half(-0.0f) == 0x8000);
+        STATIC_CHECK(to_half(1.0f) == 0x3c00);
+        STATIC_CHECK(to_half(0.5f) == 0x3800);
+        STATIC_CHECK(to_half(-2.0f) == 0xc000);
+        STATIC_CHECK(to_half(65504.0f) == 0x7bff);
+        STATIC_CHECK(to_half(1.0e6f) == 0x7c00);
+        STATIC_CHECK(to_half(std::numeric_limits<GLfloat>::quiet_NaN()) == 0x7e00);
+        STATIC_CHECK(to_half(0x1.0p-24f) == 0x0001);
+        STATIC_CHECK(to_half(1.0f + 0x1.0p-11f) == 0x3c00);
+        STATIC_CHECK(to_half(1.0f + 0x1.8p-10f) == 0x3c02);
+
+        STATIC_CHECK(from_half(0x3c00) == 1.0f);
+        STATIC_CHECK(from_half(0xc000) == -2.0f);
+        STATIC_CHECK(from_half(0x0001) == 0x1.0p-24f);
+        STATIC_CHECK(from_half(0x7c00) == std::numeric_limits<GLfloat>::infinity());
+
+        STATIC_CHECK(make_half_float(std::span<const GLfloat, 2>{std::array{0.5f, -0.5f}}) == half_float<2>{{0x3800, 0xb800}});
+
+        const std::vector<GLfloat> source{0.25f, 1.0f, -1.0f};
+        std::vector<GLhalf> destination(3);
+        convert_to_half(source, destination);
+        check(equality, "Bulk conversion", destination, std::vector<GLhalf>{0x3400, 0x3c00, 0xbc00});
+
+        check_exception_thrown<std::runtime_error>("Mismatched sizes", [&source]() { std::vector<GLhalf> d(2); convert_to_half(source, d); });
+
+        check("Polygon texture coordinates",
+              make_polygon_attribute<half_float<2>>{}(1, 5) == make_half_float(std::span<const GLfloat, 2>{polygon_tex_coordinates<GLfloat>(1, 5).values()}));
+    }
+
+    void vertex_formats_free_test::test_normalized()
+    {
+        using namespace opengl;
+
+        STATIC_CHECK(quantise<GLubyte>(1.0f) == 255);
+        STATIC_CHECK(quantise<GLubyte>(0.5f) == 128);
+        STATIC_CHECK(quantise<GLubyte>(-1.0f) == 0);
+        STATIC_CHECK(quantise<GLshort>(-1.0f) == -32767);
+        STATIC_CHECK(quantise<GLshort>(2.0f) == 32767);
+        STATIC_CHECK(quantise<GLbyte>(-0.5f) == -64);
+
+        STATIC_CHECK(quantise<GLshort>(-1.0f, snorm_convention::asymmetric) == -32768);
+        STATIC_CHECK(quantise<GLshort>(1.0f, snorm_convention::asymmetric) == 32767);
+        STATIC_CHECK(quantise<GLbyte>(0.5f, snorm_convention::asymmetric) == 63);
+        STATIC_CHECK(quantise<GLubyte>(0.5f, snorm_convention::asymmetric) == 128);
+        STATIC_CHECK(snorm_convention_for(opengl_version{4, 1}) == snorm_convention::asymmetric);
+        STATIC_CHECK(snorm_convention_for(opengl_version{4, 2}) == snorm_convention::symmetric);
+
+        STATIC_CHECK(make_normalized<GLushort>(std::span<const GLfloat, 2>{std::array{0.0f, 1.0f}}) == normalized<GLushort, 2>{{0, 65535}});
+
+        const std::vector<GLfloat> source{0.0f, 0.5f, 1.0f};
+        std::vector<GLubyte> destination(3);
+        convert_to_normalized<GLubyte>(source, destination);
+        check(equality, "Bulk conversion", destination, std::vector<GLubyte>{0, 128, 255});
+
+        check("Polygon texture coordinates",
+              make_polygon_attribute<normalized<GLushort, 2>>{}(1, 5) == make_normalized<GLushort>(std::span<const GLfloat, 2>{polygon_tex_coordinates<GLfloat>(1, 5).values()}));
+    }
+
+    void vertex_formats_free_test::test_packed()
+    {
+        using namespace opengl;
+
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(0.0f, 0.0f, 0.0f, 0.0f).bits == 0);
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(1.0f, 0.0f, 0.0f, 0.0f).bits == 0x1ffu);
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(0.0f, -1.0f, 0.0f, 0.0f).bits == (0x201u << 10));
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(0.0f, 0.0f, 1.0f, 0.0f).bits == (0x1ffu << 20));
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(0.0f, 0.0f, 0.0f).bits == (0x1u << 30));
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(0.0f, 0.0f, 0.0f, -1.0f).bits == (0x3u << 30));
+        STATIC_CHECK(make_packed_snorm_10_10_10_2(-1.0f, 0.0f, 0.0f, 1.0f, snorm_convention::asymmetric).bits == (0x200u | (0x3ffu << 10) | (0x3ffu << 20) | (0x1u << 30)));
+
+        STATIC_CHECK(is_legal_gl_buffer_value_type_v<vertex_type>);
+        STATIC_CHECK(sizeof(vertex_type) == 16);
+    }
+
+    void vertex_formats_free_test::test_direct_state_access()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const std::vector<vertex_type> vertices(4);
+        const vertex_buffer_object<vertex_type> vbo{ctx, vertices, std::nullopt};
+
+        driver.reset_call_counts();
+        const vertex_attribute_object vao{ctx, std::nullopt, vbo};
+        check(equality, "Converted to float", driver.num_calls<&GladGLContext::VertexArrayAttribFormat>(), 3uz);
+        check(equality, "Received as an integer", driver.num_calls<&GladGLContext::VertexArrayAttribIFormat>(), 1uz);
+        check(equality, "Locations bound", driver.num_calls<&GladGLContext::VertexArrayAttribBinding>(), 4uz);
+    }
+
+    void vertex_formats_free_test::test_bind_to_edit(opengl::opengl_version version)
+    {
+        using namespace opengl;
+
+        null_driver driver{version};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const std::vector<vertex_type> vertices(4);
+        const vertex_buffer_object<vertex_type> vbo{ctx, vertices, std::nullopt};
+
+        driver.reset_call_counts();
+        const vertex_attribute_object vao{ctx, std::nullopt, vbo};
+        check(equality, "Converted to float", driver.num_calls<&GladGLContext::VertexAttribPointer>(), 3uz);
+        check(equality, "Received as an integer", driver.num_calls<&GladGLContext::VertexAttribIPointer>(), 1uz);
+        check(equality, "Enabled", driver.num_calls<&GladGLContext::EnableVertexAttribArray>(), 4uz);
+    }
+}
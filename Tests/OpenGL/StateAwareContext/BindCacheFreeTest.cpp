@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "BindCacheFreeTest.hpp"
+#include "avocet/Core/AssetManagement/Image.hpp"
+#include "avocet/OpenGL/Context/NullDriver.hpp"
+#include "avocet/OpenGL/Geometry/Polygon.hpp"
+#include "avocet/OpenGL/StateAwareContext/CapableContext.hpp"
+#include "curlew/TestFramework/NullDriverContext.hpp"
+
+namespace avocet::testing
+{
+    namespace {
+        namespace agl = avocet::opengl;
+
+        using quad_type          = agl::quad<GLfloat, agl::dimensionality{2}>;
+        using textured_quad_type = agl::quad<GLfloat, agl::dimensionality{2}, agl::texture_coordinates<GLfloat>, agl::texture_coordinates<GLfloat>>;
+
+        [[nodiscard]]
+        agl::texture_2d_configurator make_texture2d_configurator(const unique_image& image) {
+            return {.common_config{.decoding{agl::sampling_decoding::none}, .parameter_setter{}, .label{}}, .data_view{image}};
+        }
+
+        [[nodiscard]]
+        textured_quad_type make_textured_quad(const agl::capable_context& ctx, const std::array<unique_image, 2>& images) {
+            const std::array configs{make_texture2d_configurator(images[0]), make_texture2d_configurator(images[1])};
+            return {ctx, [](auto vertices) { return vertices; }, configs, std::nullopt};
+        }
+
+        [[nodiscard]]
+        std::array<unique_image, 2> make_images() {
+            return {
+                unique_image{std::vector<unsigned char>{42}, discrete_extent{1, 1}, colour_channels{1}, alignment{1}},
+                unique_image{std::vector<unsigned char>{7},  discrete_extent{1, 1}, colour_channels{1}, alignment{1}}
+            };
+        }
+    }
+
+    [[nodiscard]]
+    std::filesystem::path bind_cache_free_test::source_file() const
+    {
+        return std::source_location::current().file_name();
+    }
+
+    void bind_cache_free_test::run_tests()
+    {
+        test_vertex_arrays();
+        test_textures();
+        test_invalidation_on_destruction();
+    }
+
+    void bind_cache_free_test::test_vertex_arrays()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const quad_type a{ctx, [](auto vertices) { return vertices; }, std::nullopt},
+                        b{ctx, [](auto vertices) { return vertices; }, std::nullopt};
+
+        a.draw();
+
+        driver.reset_call_counts();
+        a.draw();
+        b.draw();
+        b.draw();
+        a.draw();
+
+        check(equality, "Vertex arrays bound", driver.num_calls<&GladGLContext::BindVertexArray>(), 2uz);
+        check(equality, "Element buffers bound", driver.num_calls<&GladGLContext::BindBuffer>(), 0uz);
+        check(equality, "Draws", driver.num_calls<&GladGLContext::DrawElements>(), 4uz);
+    }
+
+    void bind_cache_free_test::test_textures()
+    {
+        using namespace opengl;
+
+        null_driver driver{};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const auto images{make_images()};
+        const auto q{make_textured_quad(ctx, images)};
+        constexpr std::array units{texture_unit{2}, texture_unit{3}};
+
+        driver.reset_call_counts();
+        for(int i{}; i < 3; ++i) q.draw(units);
+
+        check(equality, "Textures bound", driver.num_calls<&GladGLContext::BindTexture>(), 2uz);
+        check(equality, "Texture units activated", driver.num_calls<&GladGLContext::ActiveTexture>(), 2uz);
+        check("Vertex array bound at most once", driver.num_calls<&GladGLContext::BindVertexArray>() <= 1);
+        check(equality, "Draws", driver.num_calls<&GladGLContext::DrawElements>(), 3uz);
+
+        driver.reset_call_counts();
+        q.draw(std::array{texture_unit{3}, texture_unit{2}});
+        check(equality, "Textures swapped between units", driver.num_calls<&GladGLContext::BindTexture>(), 2uz);
+    }
+
+    void bind_cache_free_test::test_invalidation_on_destruction()
+    {
+        using namespace opengl;
+
+        // Without direct state access, resources are bound during construction, so exercising the cache more heavily
+        null_driver driver{opengl_version{4, 1}};
+        const auto ctx{curlew::make_null_driver_context(driver)};
+
+        const auto images{make_images()};
+        constexpr std::array units{texture_unit{0}, texture_unit{1}};
+
+        {
+            const auto q{make_textured_quad(ctx, images)};
+            q.draw(units);
+        }
+
+        // Names released by the destroyed quad may be handed out again, in which case stale cache entries would elide binds.
+        // Textures are bound to the active unit, here unit 1, when created, and so only unit 0 requires a bind.
+        const auto q{make_textured_quad(ctx, images)};
+        driver.reset_call_counts();
+        q.draw(units);
+
+        check(equality, "Textures bound", driver.num_calls<&GladGLContext::BindTexture>(), 1uz);
+        check(equality, "Texture units activated", driver.num_calls<&GladGLContext::ActiveTexture>(), 1uz);
+        check(equality, "Vertex arrays bound", driver.num_calls<&GladGLContext::BindVertexArray>(), 0uz);
+
+        const quad_type r{ctx, [](auto vertices) { return vertices; }, std::nullopt};
+        driver.reset_call_counts();
+        q.draw(units);
+        check(equality, "Vertex array rebound", driver.num_calls<&GladGLContext::BindVertexArray>(), 1uz);
+        check(equality, "Textures still bound", driver.num_calls<&GladGLContext::BindTexture>(), 0uz);
+    }
+}